@@ -25,7 +25,7 @@ from openvino.runtime.utils.data_helpers import (
 class InferRequest(_InferRequestWrapper):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None, shared_memory: bool = False) -> OVDict:
+    def infer(self, inputs: Any = None, shared_memory: bool = False, share_outputs: bool = False) -> OVDict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -62,12 +62,23 @@ class InferRequest(_InferRequestWrapper):
                               * inputs which data types are mismatched from Infer Request's inputs
                               * inputs that should be in `BF16` data type
                               * scalar inputs (i.e. `np.float_`/`int`/`float`)
+                              Copies of non-scalar inputs are reported with `RuntimeWarning`.
                               Keeps Tensor inputs "as-is".
                               Note: Use with extra care, shared data can be modified during runtime!
                               Note: Using `shared_memory` may result in the extra memory overhead.
 
                               Default value: False
         :type shared_memory: bool, optional
+        :param share_outputs: Enables `share_outputs` mode.
+
+                              If set to `False` results are copied from output Tensors.
+
+                              If set to `True` results are numpy views over output Tensors of
+                              the InferRequest, no data is copied.
+                              Note: Views are overwritten by the next inference on this InferRequest!
+
+                              Default value: False
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with port/int/str keys.
         :rtype: OVDict
         """
@@ -75,7 +86,7 @@ class InferRequest(_InferRequestWrapper):
             self,
             inputs,
             is_shared=shared_memory,
-        )))
+        ), share_outputs=share_outputs))
 
     def start_async(
         self,
@@ -122,6 +133,7 @@ class InferRequest(_InferRequestWrapper):
                               * inputs which data types are mismatched from Infer Request's inputs
                               * inputs that should be in `BF16` data type
                               * scalar inputs (i.e. `np.float_`/`int`/`float`)
+                              Copies of non-scalar inputs are reported with `RuntimeWarning`.
                               Keeps Tensor inputs "as-is".
                               Note: Use with extra care, shared data can be modified during runtime!
                               Note: Using `shared_memory` may result in extra memory overhead.
@@ -205,7 +217,8 @@ class CompiledModel(CompiledModelBase):
 
     def __call__(self,
                  inputs: Union[dict, list, tuple, Tensor, np.ndarray] = None,
-                 shared_memory: bool = True) -> OVDict:
+                 shared_memory: bool = True,
+                 share_outputs: bool = False) -> OVDict:
         """Callable infer wrapper for CompiledModel.
 
         Infers specified input(s) in synchronous mode.
@@ -250,12 +263,21 @@ class CompiledModel(CompiledModelBase):
                               * inputs which data types are mismatched from Infer Request's inputs
                               * inputs that should be in `BF16` data type
                               * scalar inputs (i.e. `np.float_`/`int`/`float`)
+                              Copies of non-scalar inputs are reported with `RuntimeWarning`.
                               Keeps Tensor inputs "as-is".
                               Note: Use with extra care, shared data can be modified during runtime!
                               Note: Using `shared_memory` may result in extra memory overhead.
 
                               Default value: True
         :type shared_memory: bool, optional
+        :param share_outputs: Enables `share_outputs` mode.
+
+                              If set to `True` results are numpy views over output Tensors of
+                              the InferRequest, no data is copied.
+                              Note: Views are overwritten by the next call!
+
+                              Default value: False
+        :type share_outputs: bool, optional
 
         :return: Dictionary of results from output tensors with port/int/str as keys.
         :rtype: OVDict
@@ -266,6 +288,7 @@ class CompiledModel(CompiledModelBase):
         return self._infer_request.infer(
             inputs,
             shared_memory=shared_memory,
+            share_outputs=share_outputs,
         )
 
 
@@ -336,6 +359,7 @@ class AsyncInferQueue(AsyncInferQueueBase):
                               * inputs which data types are mismatched from Infer Request's inputs
                               * inputs that should be in `BF16` data type
                               * scalar inputs (i.e. `np.float_`/`int`/`float`)
+                              Copies of non-scalar inputs are reported with `RuntimeWarning`.
                               Keeps Tensor inputs "as-is".
                               Note: Use with extra care, shared data can be modified during runtime!
                               Note: Using `shared_memory` may result in extra memory overhead.
@@ -4,6 +4,7 @@
 
 from functools import singledispatch
 from typing import Any, Dict, Union, Optional
+import warnings
 
 import numpy as np
 
@@ -29,6 +30,15 @@ def get_request_tensor(
         raise TypeError(f"Unsupported key type: {type(key)} for Tensor under key: {key}")
 
 
+def warn_on_copy(reason: str, key: Optional[ValidKeys] = None) -> None:
+    """Reports that data is copied although `shared_memory` mode was requested.
+
+    The default warnings filter reports each message once, so repeated inferences don't repeat it.
+    """
+    where = "" if key is None else f" under key: {key}"
+    warnings.warn(f"Input data{where} is copied in shared_memory mode: {reason}", RuntimeWarning)
+
+
 @singledispatch
 def value_to_tensor(
     value: Union[Tensor, np.ndarray, ScalarTypes],
@@ -67,11 +77,15 @@ def _(
             return Tensor(value.astype(tensor_dtype).reshape(tensor_shape), shared_memory=False)
     # WA for FP16-->BF16 edge-case, always copy.
     if tensor_type == Type.bf16:
+        if is_shared:
+            warn_on_copy("BF16 inputs are always copied.", key)
         tensor = Tensor(tensor_type, value.shape)
         tensor.data[:] = value.view(tensor_dtype)
         return tensor
     # If types are mismatched, convert and always copy.
     if tensor_dtype != value.dtype:
+        if is_shared:
+            warn_on_copy(f"data type {value.dtype} doesn't match {tensor_dtype} of the input.", key)
         return Tensor(value.astype(tensor_dtype), shared_memory=False)
     # Otherwise, use mode defined in the call.
     return Tensor(value, shared_memory=is_shared)
@@ -101,7 +115,10 @@ def to_c_style(value: Any, is_shared: bool = False) -> Any:
         if hasattr(value, "__array__"):
             return to_c_style(np.array(value, copy=False)) if is_shared else np.array(value, copy=True)
         return value
-    return value if value.flags["C_CONTIGUOUS"] else np.ascontiguousarray(value)
+    if value.flags["C_CONTIGUOUS"]:
+        return value
+    warn_on_copy("array is not C contiguous.")
+    return np.ascontiguousarray(value)
 
 
 ###
@@ -9,6 +9,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <queue>
 #include <string>
@@ -28,6 +29,10 @@ public:
 
         m_requests.reserve(jobs);
         m_user_ids.reserve(jobs);
+        // Completion lists never grow past the number of jobs, so plugin threads don't allocate in callbacks
+        m_completed.reserve(jobs);
+        m_processing.reserve(jobs);
+        m_result_slots.resize(jobs, 0);
 
         for (size_t handle = 0; handle < jobs; handle++) {
             // Create new "empty" InferRequestWrapper without pre-defined callback and
@@ -45,6 +50,8 @@ public:
     }
 
     bool _is_ready() {
+        // Hand finished requests of batched mode to the callback first, it returns them to idle queue
+        process_completions();
         // Check if any request has finished already
         py::gil_scoped_release release;
         // acquire the mutex to access m_errors and m_idle_handles
@@ -55,6 +62,9 @@ public:
     }
 
     size_t get_idle_request_id() {
+        if (m_batched_callback) {
+            return get_idle_request_id_batched();
+        }
         // Wait for any request to complete and return its id
         // release GIL to avoid deadlock on python callback
         py::gil_scoped_release release;
@@ -72,24 +82,165 @@ public:
     }
 
     void wait_all() {
-        // Wait for all request to complete
-        // release GIL to avoid deadlock on python callback
-        py::gil_scoped_release release;
-        for (auto&& request : m_requests) {
-            request.m_request.wait();
+        {
+            // Wait for all request to complete
+            // release GIL to avoid deadlock on python callback
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
         }
+        // all completions of batched mode are pending at this point, run the callback once for all of them
+        process_completions();
         // acquire the mutex to access m_errors
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_errors.size() > 0)
             throw m_errors.front();
     }
 
+    size_t get_idle_request_id_batched() {
+        // Plugin threads only record finished requests in m_completed, so this thread has to
+        // hand them to the callback before they become idle again.
+        while (true) {
+            process_completions();
+            py::gil_scoped_release release;
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] {
+                return !m_idle_handles.empty() || !m_completed.empty();
+            });
+            if (m_errors.size() > 0)
+                throw m_errors.front();
+            if (!m_idle_handles.empty())
+                return m_idle_handles.front();
+        }
+    }
+
+    // Runs batched callback once for all requests finished since the previous call and
+    // returns them to the idle queue. Must be called with GIL held.
+    void process_completions() {
+        if (!m_batched_callback) {
+            return;
+        }
+        {
+            // plugin threads never wait for GIL in batched mode, so the mutex can be taken while holding it
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_completed.empty())
+                return;
+            // both lists keep their capacity, swap doesn't allocate
+            m_processing.clear();
+            std::swap(m_processing, m_completed);
+        }
+        {
+            py::gil_scoped_release release;
+            for (auto handle : m_processing) {
+                // wait for request to make sure it returned from callback
+                m_requests[handle].m_request.wait();
+            }
+        }
+        py::list batch(m_processing.size());
+        for (size_t i = 0; i < m_processing.size(); i++) {
+            const auto handle = m_processing[i];
+            batch[i] = py::make_tuple(m_requests[handle], m_user_ids[handle]);
+        }
+        try {
+            m_batched_callback(batch);
+        } catch (const py::error_already_set& py_error) {
+            assert(py_error.type());
+            // acquire the mutex to access m_errors
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_errors.push(py_error);
+        }
+        {
+            // acquire the mutex to access m_idle_handles
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto handle : m_processing) {
+                m_idle_handles.push(handle);
+            }
+        }
+    }
+
+    // Copies outputs of the finished request to the row of preallocated arrays selected by the
+    // userdata passed to start_async. Python objects aren't touched, so GIL is not required.
+    void copy_results(size_t handle) {
+        const auto row = m_result_slots[handle];
+        for (size_t i = 0; i < m_result_buffers.size(); i++) {
+            const auto& buffer = m_result_buffers[i];
+            const auto tensor = m_requests[handle].m_request.get_output_tensor(i);
+            std::memcpy(buffer.data + row * buffer.row_size, tensor.data(), buffer.row_size);
+        }
+    }
+
+    void set_result_slot(size_t handle, const py::object& userdata) {
+        if (m_result_buffers.empty()) {
+            return;
+        }
+        if (!py::isinstance<py::int_>(userdata)) {
+            throw py::type_error("AsyncInferQueue with result buffers expects userdata to be an int row index!");
+        }
+        const auto row = userdata.cast<size_t>();
+        if (row >= m_result_buffers.front().rows) {
+            throw py::index_error("Row index " + std::to_string(row) + " is out of range of result buffers with " +
+                                  std::to_string(m_result_buffers.front().rows) + " rows!");
+        }
+        m_result_slots[handle] = row;
+    }
+
+    void set_result_buffers(const py::list& buffers) {
+        const auto& outputs = m_requests.front().m_outputs;
+        std::vector<ResultBuffer> result_buffers;
+        if (!buffers.empty()) {
+            if (buffers.size() != outputs.size()) {
+                throw py::value_error("Number of result buffers (" + std::to_string(buffers.size()) +
+                                      ") doesn't match number of model outputs (" + std::to_string(outputs.size()) +
+                                      ")!");
+            }
+            for (size_t i = 0; i < outputs.size(); i++) {
+                if (!py::isinstance<py::array>(buffers[i])) {
+                    throw py::type_error("Result buffer " + std::to_string(i) + " is not a numpy array!");
+                }
+                auto array = buffers[i].cast<py::array>();
+                if (outputs[i].get_partial_shape().is_dynamic()) {
+                    throw py::value_error("Result buffers are supported only for outputs with static shapes!");
+                }
+                const auto& type = outputs[i].get_element_type();
+                const auto dtype = Common::dtype_to_ov_type().find(std::string(py::str(array.dtype())));
+                if (dtype == Common::dtype_to_ov_type().end() || dtype->second != type) {
+                    throw py::type_error("Result buffer " + std::to_string(i) + " has data type " +
+                                         std::string(py::str(array.dtype())) + " which doesn't match output type " +
+                                         type.get_type_name() + "!");
+                }
+                if (!Common::array_helpers::is_contiguous(array) || !array.writeable() || array.ndim() < 1 ||
+                    array.shape(0) == 0) {
+                    throw py::value_error("Result buffer " + std::to_string(i) +
+                                          " should be a writeable C-contiguous array with at least one row!");
+                }
+                const auto rows = static_cast<size_t>(array.shape(0));
+                if (!result_buffers.empty() && rows != result_buffers.front().rows) {
+                    throw py::value_error("All result buffers should have the same number of rows!");
+                }
+                const auto row_size = m_requests.front().m_request.get_output_tensor(i).get_byte_size();
+                if (static_cast<size_t>(array.nbytes()) != rows * row_size) {
+                    throw py::value_error("Row of result buffer " + std::to_string(i) + " doesn't match shape " +
+                                          outputs[i].get_shape().to_string() + " of the output!");
+                }
+                auto data = static_cast<char*>(array.mutable_data());
+                result_buffers.push_back({std::move(array), data, rows, row_size});
+            }
+        }
+        // buffers are read by plugin threads, so they can be swapped only when there is no work in flight
+        finish_pending_requests();
+        m_result_buffers = std::move(result_buffers);
+    }
+
     void set_default_callbacks() {
         for (size_t handle = 0; handle < m_requests.size(); handle++) {
             // auto end_time = m_requests[handle].m_end_time; // TODO: pass it bellow? like in InferRequestWrapper
 
             m_requests[handle].m_request.set_callback([this, handle /* ... */](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    copy_results(handle);
+                }
                 {
                     // acquire the mutex to access m_idle_handles
                     std::lock_guard<std::mutex> lock(m_mutex);
@@ -115,6 +266,7 @@ public:
             m_requests[handle].m_request.set_callback([this, f_callback, handle](std::exception_ptr exception_ptr) {
                 *m_requests[handle].m_end_time = Time::now();
                 if (exception_ptr == nullptr) {
+                    copy_results(handle);
                     // Acquire GIL, execute Python function
                     py::gil_scoped_acquire acquire;
                     try {
@@ -151,6 +303,62 @@ public:
         }
     }
 
+    // Waits for requests in flight and passes their completions to the batched callback if it is set.
+    void finish_pending_requests() {
+        {
+            py::gil_scoped_release release;
+            for (auto&& request : m_requests) {
+                request.m_request.wait();
+            }
+        }
+        process_completions();
+    }
+
+    void set_batched_callbacks(py::function f_callback) {
+        // pending completions belong to the previous callback
+        finish_pending_requests();
+        m_batched_callback = f_callback;
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            // GIL is not acquired here: the request is only recorded as finished and the callback is run for
+            // a whole group of them by the thread which waits on the queue (see process_completions).
+            m_requests[handle].m_request.set_callback([this, handle](std::exception_ptr exception_ptr) {
+                *m_requests[handle].m_end_time = Time::now();
+                if (exception_ptr == nullptr) {
+                    copy_results(handle);
+                }
+                {
+                    // acquire the mutex to access m_completed
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_completed.push_back(handle);
+                }
+                // Notify locks in get_idle_request_id_batched()
+                m_cv.notify_one();
+
+                try {
+                    if (exception_ptr) {
+                        std::rethrow_exception(exception_ptr);
+                    }
+                } catch (const std::exception& e) {
+                    OPENVINO_THROW(e.what());
+                }
+            });
+        }
+    }
+
+    void set_callbacks(py::function f_callback) {
+        // finish pending batched completions before switching to per-request callbacks
+        finish_pending_requests();
+        m_batched_callback = py::function();
+        set_custom_callbacks(f_callback);
+    }
+
+    struct ResultBuffer {
+        py::array array;  // keeps data alive
+        char* data;
+        size_t rows;
+        size_t row_size;
+    };
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
@@ -159,6 +367,13 @@ public:
     std::mutex m_mutex;
     std::condition_variable m_cv;
     std::queue<py::error_already_set> m_errors;
+    // batched mode: requests finished by plugin threads and not yet passed to m_batched_callback
+    py::function m_batched_callback;
+    std::vector<size_t> m_completed;
+    std::vector<size_t> m_processing;
+    // optional preallocated arrays to collect outputs, row per start_async call
+    std::vector<ResultBuffer> m_result_buffers;
+    std::vector<size_t> m_result_slots;
 };
 
 void regclass_AsyncInferQueue(py::module m) {
@@ -187,6 +402,8 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
+            // Validate row of result buffers before the request leaves the idle queue
+            self.set_result_slot(handle, userdata);
             {
                 std::lock_guard<std::mutex> lock(self.m_mutex);
                 self.m_idle_handles.pop();
@@ -233,6 +450,8 @@ void regclass_AsyncInferQueue(py::module m) {
             // getIdleRequestId function has an intention to block InferQueue
             // until there is at least one idle (free to use) InferRequest
             auto handle = self.get_idle_request_id();
+            // Validate row of result buffers before the request leaves the idle queue
+            self.set_result_slot(handle, userdata);
             {
                 std::lock_guard<std::mutex> lock(self.m_mutex);
                 self.m_idle_handles.pop();
@@ -299,7 +518,7 @@ void regclass_AsyncInferQueue(py::module m) {
         )");
 
     cls.def("set_callback",
-            &AsyncInferQueue::set_custom_callbacks,
+            &AsyncInferQueue::set_callbacks,
             R"(
             Sets unified callback on all InferRequests from queue's pool.
             Signature of such function should have two arguments, where
@@ -318,6 +537,53 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batched_callback",
+            &AsyncInferQueue::set_batched_callbacks,
+            R"(
+            Sets callback which receives finished InferRequests in groups.
+            Completions are recorded without acquiring the GIL and the callback is called
+            once per group from the thread which runs start_async, get_idle_request_id,
+            is_ready or wait_all. Function has a single argument: list of
+            (InferRequest, userdata) tuples.
+
+            .. code-block:: python
+
+                def f(batch):
+                    for request, userdata in batch:
+                        print(request.output_tensors[0].data, userdata)
+
+                async_infer_queue.set_batched_callback(f)
+
+            Requests are returned to the pool after the callback, it replaces the one set by set_callback.
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+        )");
+
+    cls.def("set_result_buffers",
+            &AsyncInferQueue::set_result_buffers,
+            py::arg("buffers"),
+            R"(
+            Sets preallocated arrays to collect results of the inference.
+            Outputs of the finished InferRequest are copied to the row of each array
+            selected by userdata of start_async call, which must be an int in this mode.
+            Copying happens without the GIL, so no callback is required to gather results.
+
+            .. code-block:: python
+
+                results = np.zeros((len(images), *output.shape), dtype=np.float32)
+                async_infer_queue.set_result_buffers([results])
+                for i, image in enumerate(images):
+                    async_infer_queue.start_async({"data": image}, i)
+                async_infer_queue.wait_all()
+
+            Waits for all InferRequests in the pool before buffers are replaced.
+
+            :param buffers: List of C-contiguous arrays, one per output. First dimension is a number of rows,
+            the rest of the array should match the output. Empty list disables collection.
+            :type buffers: List[numpy.ndarray]
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
@@ -131,7 +131,17 @@ py::array as_contiguous(py::array& array, ov::element::Type type) {
     }
 }
 
-py::array array_from_tensor(ov::Tensor&& t) {
+py::array array_from_tensor(ov::Tensor&& t, bool is_shared) {
+    if (is_shared) {
+        // Create a view over the Tensor's memory, the array owns a copy of the Tensor
+        // which keeps plugin-owned data alive as long as the array exists.
+        auto ov_type = t.get_element_type();
+        auto dtype = Common::ov_type_to_dtype().at(ov_type);
+        if (ov_type.bitwidth() < Common::values::min_bitwidth) {
+            return py::array(dtype, t.get_byte_size(), t.data(), py::cast(t));
+        }
+        return py::array(dtype, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+    }
     switch (t.get_element_type()) {
     case ov::element::Type_t::f32: {
         return py::array_t<float>(t.get_shape(), t.data<float>());
@@ -343,10 +353,10 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(InferRequestWrapper& request) {
+py::dict outputs_to_dict(InferRequestWrapper& request, bool share_outputs) {
     py::dict res;
     for (const auto& out : request.m_outputs) {
-        res[py::cast(out)] = array_helpers::array_from_tensor(request.m_request.get_tensor(out));
+        res[py::cast(out)] = array_helpers::array_from_tensor(request.m_request.get_tensor(out), share_outputs);
     }
     return res;
 }
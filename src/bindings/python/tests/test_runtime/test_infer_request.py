@@ -466,6 +466,39 @@ def test_async_single_input(device, ov_type, numpy_dtype, shared_flag):
     assert np.array_equal(request.get_output_tensor().data, np.abs(tensor1.data))
 
 
+@pytest.mark.parametrize("share_outputs", [True, False])
+def test_infer_share_outputs(device, share_outputs):
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    request = compiled_model.create_infer_request()
+
+    data = np.arange(-5, 5, dtype=np.float32)
+    res = request.infer({0: data}, shared_memory=True, share_outputs=share_outputs)
+
+    assert np.array_equal(res[0], np.maximum(data, 0))
+    assert np.shares_memory(res[0], request.get_output_tensor().data) == share_outputs
+
+    # Views stay valid after the request is destroyed
+    del request
+    assert np.array_equal(res[0], np.maximum(data, 0))
+
+
+def test_infer_shared_memory_copy_warnings(device):
+    core = Core()
+    param = ops.parameter([2, 5], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    request = compiled_model.create_infer_request()
+
+    data = np.arange(-5, 5, dtype=np.float32).reshape(2, 5)
+    with pytest.warns(RuntimeWarning, match="not C contiguous"):
+        request.infer({0: np.asfortranarray(data)}, shared_memory=True)
+    with pytest.warns(RuntimeWarning, match="doesn't match"):
+        request.infer({0: data.astype(np.float64)}, shared_memory=True)
+
+
 @pytest.mark.parametrize("shared_flag", [True, False])
 def test_infer_queue(device, shared_flag):
     jobs = 8
@@ -496,6 +529,58 @@ def test_infer_queue(device, shared_flag):
     assert all(job["latency"] > 0 for job in jobs_done)
 
 
+def test_infer_queue_batched_callback(device):
+    jobs = 16
+    core = Core()
+    param = ops.parameter([10], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    results = {}
+    calls = []
+
+    def callback(batch):
+        calls.append(len(batch))
+        for request, job_id in batch:
+            results[job_id] = request.get_output_tensor().data.copy()
+
+    infer_queue.set_batched_callback(callback)
+    data = [np.arange(-5, 5, dtype=np.float32) * i for i in range(jobs)]
+    for i in range(jobs):
+        infer_queue.start_async({0: data[i]}, i)
+    infer_queue.wait_all()
+
+    assert sum(calls) == jobs
+    assert len(calls) <= jobs
+    for i in range(jobs):
+        assert np.array_equal(results[i], np.maximum(data[i], 0))
+
+
+def test_infer_queue_result_buffers(device):
+    jobs = 16
+    core = Core()
+    param = ops.parameter([2, 5], np.float32)
+    model = Model(ops.relu(param), [param])
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    results = np.zeros((jobs, 2, 5), dtype=np.float32)
+    infer_queue.set_result_buffers([results])
+
+    data = [np.arange(-5, 5, dtype=np.float32).reshape(2, 5) * i for i in range(jobs)]
+    for i in range(jobs):
+        infer_queue.start_async({0: data[i]}, i)
+    infer_queue.wait_all()
+
+    assert np.array_equal(results, np.maximum(np.stack(data), 0))
+
+    with pytest.raises(IndexError):
+        infer_queue.start_async({0: data[0]}, jobs)
+    with pytest.raises(TypeError):
+        infer_queue.set_result_buffers([np.zeros((jobs, 2, 5), dtype=np.int32)])
+    with pytest.raises(ValueError):
+        infer_queue.set_result_buffers([np.zeros((jobs, 5), dtype=np.float32)])
+
+
 def test_infer_queue_iteration(device):
     core = Core()
     param = ops.parameter([10])
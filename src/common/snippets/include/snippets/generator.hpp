@@ -138,6 +138,9 @@ public:
         bool m_optimize_single_evaluation = true;
         // True if we should check runtime info for nodes to call specific needed transformations
         bool m_need_fill_tail_register = false;
+        // True if the kernel must serve all shapes with the same broadcasting pattern: the vector and the scalar tail Loops
+        // are always emitted, and their work amounts are passed at runtime
+        bool m_shape_agnostic = false;
     };
     /**
      * @brief virtual method any specific implementation should implement
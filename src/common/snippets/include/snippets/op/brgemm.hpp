@@ -19,6 +19,23 @@ namespace op {
 class Brgemm : public MemoryAccess {
 public:
     OPENVINO_OP("Brgemm", "SnippetsOpset", MemoryAccess);
+
+    /**
+     * @interface PostOp
+     * @brief PostOp describes an elementwise operation of Brgemm epilogue that is applied on the accumulated tile
+     *        before it is stored: Linear computes alpha * x + beta, the activations use alpha and beta as their parameters
+     * @ingroup snippets
+     */
+    struct PostOp {
+        enum class Type { Linear, Relu, GeluErf, GeluTanh, Sigmoid, Tanh, Elu, Clip, Abs, Sqrt, Exp, HSwish,
+                          RoundHalfToEven, RoundHalfAwayFromZero };
+        PostOp(Type type, float alpha = 0.f, float beta = 0.f) : type(type), alpha(alpha), beta(beta) {}
+
+        Type type;
+        float alpha;
+        float beta;
+    };
+
     Brgemm(const Output<Node>& A, const Output<Node>& B,
            const size_t offset_a = 0lu, const size_t offset_b = 0lu, const size_t offset_c = 0lu);
     Brgemm() = default;
@@ -26,6 +43,14 @@ public:
     size_t get_offset_a() const { return get_input_offset(0); }
     size_t get_offset_b() const { return get_input_offset(1); }
     size_t get_offset_c() const { return get_output_offset(0); }
+    size_t get_offset_bias() const;
+
+    // The bias is broadcasted over M dimension and is added to the accumulated tile before post-ops. It's always the last input
+    bool has_bias() const { return m_with_bias; }
+    void set_bias(const Output<Node>& bias, const size_t offset_bias = 0lu);
+    const std::vector<PostOp>& get_post_ops() const { return m_post_ops; }
+    void set_post_ops(std::vector<PostOp> post_ops) { m_post_ops = std::move(post_ops); }
+    bool has_epilogue() const { return m_with_bias || !m_post_ops.empty(); }
 
     void validate_and_infer_types() override;
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
@@ -35,6 +60,12 @@ public:
 protected:
     ov::element::Type get_output_type() const;
     ov::PartialShape get_output_partial_shape(const std::vector<ov::PartialShape>& input_shapes) const;
+    void validate_bias() const;
+    // Copies bias input and post-ops to the cloned Brgemm
+    void copy_epilogue(const std::shared_ptr<Brgemm>& brgemm, const OutputVector& new_args) const;
+
+    std::vector<PostOp> m_post_ops {};
+    bool m_with_bias = false;
 };
 
 } // namespace op
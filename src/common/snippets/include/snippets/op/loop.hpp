@@ -99,6 +99,12 @@ public:
     // to skip pointer increments when outer Loop is empty, and work_amount == vector_size (one inner vector Loop)
     // true by default, the optimizations enabled if it's false;
     bool has_outer_loop;
+    // Used by shape-agnostic kernels: the Loop reads its work amount at runtime from the arguments of the dimension
+    // it iterates over (0 for the innermost one). The tail Loop processes the remainder of the vector Loop,
+    // the non-zero finalization offsets rewind the data pointers by the whole work amount of the dimension.
+    bool is_shape_agnostic = false;
+    size_t dimension = 0;
+    bool is_tail = false;
 
 private:
     std::vector<int64_t> ptr_increments;
@@ -120,6 +120,9 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ngraph::snippets::Generator> generator);
     void set_tile_rank(size_t newRank) {tileRank = newRank;}
+    // plugin requests a kernel that serves all the shapes with the broadcasting pattern of the current master shape
+    // (see Generator::GeneratorConfig::m_shape_agnostic), only the domains without domain sensitive ops are supported
+    void set_shape_agnostic(bool value) {shapeAgnostic = value;}
     void set_virtual_port_count(const size_t count);
     void set_buffer_needed(const bool need);
 
@@ -158,6 +161,7 @@ private:
 
     ov::PartialShape master_shape;
     size_t tileRank = 0; // set by plugin to specify the number of dimensions processed in a single kernel call
+    bool shapeAgnostic = false;
 
     /**
     * @interface SubgraphConfig
@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/pattern/matcher.hpp"
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface FuseBrgemmEpilogue
+ * @brief Fuses the chain of elementwise consumers of Brgemm into its epilogue, so they are applied on the accumulated tile
+ *        before it's stored and the Brgemm output isn't re-read by separate Loops. Fused ops:
+ *            - the first Add with [..., 1, N] Parameter is fused as bias;
+ *            - Add, Subtract, Multiply and Divide with scalar Constant are fused as linear post-ops;
+ *            - Relu, Gelu, Sigmoid, Tanh, Elu, Clamp, Abs, Sqrt, Exp and HSwish are fused as activation post-ops;
+ *            - Maximum and Minimum with scalar Constant and Round, which are produced by the decomposition of per-tensor
+ *              FakeQuantize, are fused as clip and round post-ops, so FakeQuantize with f32 output is fused completely.
+ *        Only Brgemm with f32 output is supported.
+ * @ingroup snippets
+ */
+class FuseBrgemmEpilogue: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("FuseBrgemmEpilogue", "0");
+    FuseBrgemmEpilogue();
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceDecomposition
+ * @brief The pass decomposes the body with last-axis ReduceSum, ReduceMean and ReduceMax ops (LayerNorm, RMSNorm and similar
+ *        normalization blocks) into explicit Snippets dialect: each reduction is accumulated in a vector register
+ *        (VectorBuffer + Add/Maximum) inside a Loop over the last dimension and is reduced by HorizonSum/HorizonMax after the Loop.
+ *        The reduced row values are kept in vector registers, so the consumers of the reductions are processed in the next Loop
+ *        which reads the inputs once again instead of storing the intermediate data to a Buffer.
+ *        The Loops are placed into one outer Loop over the second-to-last dimension.
+ *        Note:
+ *            - All the body ops should be elementwise, and the last dimension of each tensor should be either the reduced one or 1
+ *            - All the reductions are accumulated in the same Loop, so the reductions of the reduced values are not supported
+ *              and the inputs are read twice at most
+ *            - The reductions over the other axes (e.g. GroupNorm over the spatial dimensions) are not supported,
+ *              they are executed by the Reduce nodes of the plugins
+ * @param vector_size - the number of entities processed on one iteration of vector loop
+ * @ingroup snippets
+ */
+class ReduceDecomposition: public ngraph::pass::FunctionPass {
+public:
+    OPENVINO_RTTI("ReduceDecomposition", "0");
+    explicit ReduceDecomposition(size_t vector_size);
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+
+    static bool is_supported_reduce(const std::shared_ptr<const ov::Node>& node);
+    static bool is_supported_body(const std::shared_ptr<const ov::Model>& body);
+    // Each reduction holds its accumulator in a dedicated vector register during the whole kernel execution
+    static const size_t max_reduce_count;
+
+private:
+    size_t m_vector_size;
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
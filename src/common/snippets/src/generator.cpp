@@ -134,6 +134,12 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
         }
     };
     const auto& ops = m->get_ordered_ops();
+    if (config.m_shape_agnostic) {
+        for (const auto& op : ops) {
+            if (const auto& loop_end = ov::as_type_ptr<ngraph::snippets::op::LoopEnd>(op))
+                loop_end->is_shape_agnostic = true;
+        }
+    }
     for (auto op = ops.begin(); op < ops.end(); op++) {
         const auto& loop_begin = ov::as_type_ptr<ngraph::snippets::op::LoopBegin>(*op);
 
@@ -149,9 +155,11 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
             vector_loop.push_back(*op);
             const auto work_amount = vector_loop_end->get_work_amount();
             const auto increment = vector_loop_end->get_increment();
-            const auto tail_size = work_amount % increment;
-            const auto need_tail = tail_size != 0;
-            const auto need_vector_loop = work_amount >= increment;
+            // the work amount of shape-agnostic Loops is known only at runtime, so both Loops are emitted
+            // and the tail is processed by the scalar Loop
+            const auto tail_size = config.m_shape_agnostic ? 1 : work_amount % increment;
+            const auto need_tail = config.m_shape_agnostic || tail_size != 0;
+            const auto need_vector_loop = config.m_shape_agnostic || work_amount >= increment;
             // Note, that finalization_offsets could be modified inside optimize_single_evaluation,
             // so need to save them here to cover (evaluate_once vector with non-zero finalization_offsets + tail)
             std::vector<int64_t> tail_finalization_offsets = need_tail ? vector_loop_end->get_finalization_offsets() : std::vector<int64_t> {};
@@ -184,6 +192,9 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
                 tail_loop_end->update_ptr_increments(static_cast<int64_t>(tail_size));
                 tail_loop_end->set_work_amount(tail_size);
                 tail_loop_end->has_outer_loop = vector_loop_end->has_outer_loop;
+                tail_loop_end->is_shape_agnostic = vector_loop_end->is_shape_agnostic;
+                tail_loop_end->dimension = vector_loop_end->dimension;
+                tail_loop_end->is_tail = true;
 
                 if (config.m_optimize_single_evaluation) {
                     // tail loop is always executed once
@@ -249,6 +260,7 @@ Generator::opRegType Generator::get_op_reg_type(const std::shared_ptr<Node>& op)
              std::dynamic_pointer_cast<opset1::Convert>(op) ||
              std::dynamic_pointer_cast<opset1::Select>(op) ||
              std::dynamic_pointer_cast<op::VectorBuffer>(op) ||
+             std::dynamic_pointer_cast<op::Fill>(op) ||
              std::dynamic_pointer_cast<op::BroadcastMove>(op) ||
              std::dynamic_pointer_cast<op::Scalar>(op) ||
              std::dynamic_pointer_cast<op::HorizonMax>(op) ||
@@ -37,12 +37,49 @@ void Brgemm::validate_and_infer_types() {
     set_output_type(0,
                     get_output_type(),
                     utils::get_reordered_planar_shape(output_shape, output_layout));
+
+    NODE_VALIDATION_CHECK(this, get_input_size() == 2 + m_with_bias, "Brgemm expects 2 inputs and the optional bias");
+    if (m_with_bias)
+        validate_bias();
 }
 
 std::shared_ptr<Node> Brgemm::clone_with_new_inputs(const OutputVector& new_args) const {
     INTERNAL_OP_SCOPE(Brgemm_clone_with_new_inputs);
     check_new_args_count(this, new_args);
-    return std::make_shared<Brgemm>(new_args.at(0), new_args.at(1), get_offset_a(), get_offset_b(), get_offset_c());
+    const auto brgemm = std::make_shared<Brgemm>(new_args.at(0), new_args.at(1), get_offset_a(), get_offset_b(), get_offset_c());
+    copy_epilogue(brgemm, new_args);
+    return brgemm;
+}
+
+void Brgemm::set_bias(const Output<Node>& bias, const size_t offset_bias) {
+    OPENVINO_ASSERT(!m_with_bias, "Brgemm already has bias");
+    const auto idx = get_input_size();
+    set_argument(idx, bias);
+    m_input_ports.resize(get_input_size());
+    set_input_port_descriptor({0, offset_bias}, idx);
+    m_with_bias = true;
+}
+
+size_t Brgemm::get_offset_bias() const {
+    OPENVINO_ASSERT(m_with_bias, "Offset of bias must be only in Brgemm with bias on the last input");
+    return get_input_offset(get_input_size() - 1);
+}
+
+void Brgemm::validate_bias() const {
+    const auto bias_idx = get_input_size() - 1;
+    const auto& bias_shape = get_input_partial_shape(bias_idx);
+    const auto& output_shape = output(0).get_partial_shape();
+    NODE_VALIDATION_CHECK(this, get_input_element_type(bias_idx) == element::f32 && get_output_element_type(0) == element::f32,
+                          "Brgemm supports only f32 bias with f32 output");
+    NODE_VALIDATION_CHECK(this, bias_shape.is_static() && bias_shape.size() >= 2 &&
+                                *bias_shape.rbegin() == *output_shape.rbegin() && *++bias_shape.rbegin() == 1,
+                          "Brgemm bias must have static shape [..., 1, N]");
+}
+
+void Brgemm::copy_epilogue(const std::shared_ptr<Brgemm>& brgemm, const OutputVector& new_args) const {
+    if (m_with_bias)
+        brgemm->set_bias(new_args.back(), get_offset_bias());
+    brgemm->set_post_ops(m_post_ops);
 }
 
 ov::element::Type Brgemm::get_output_type() const {
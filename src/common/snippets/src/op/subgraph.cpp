@@ -21,7 +21,9 @@
 #include "snippets/pass/transform_convert.hpp"
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
+#include "snippets/pass/fuse_brgemm_epilogue.hpp"
 #include "snippets/pass/softmax_decomposition.hpp"
+#include "snippets/pass/reduce_decomposition.hpp"
 #include "snippets/pass/reset_buffer.hpp"
 #include "snippets/pass/insert_buffer.hpp"
 #include "snippets/pass/loop_fusion.hpp"
@@ -64,7 +66,8 @@ void snippets::op::Subgraph::init_config() {
             ov::is_type<ov::op::v1::Transpose>(op) ||
             ov::is_type<ov::op::v1::Softmax>(op) ||
             ov::is_type<ov::op::v8::Softmax>(op) ||
-            ov::is_type<ov::op::v0::MatMul>(op);
+            ov::is_type<ov::op::v0::MatMul>(op) ||
+            snippets::pass::ReduceDecomposition::is_supported_reduce(op);
     }
     // Domain sensitive ops are decomposed with explicit Loops. So, we should explicitly insert Loops in Subgraph if it contains these ops
     config.m_explicit_loop_insertion = config.m_has_domain_sensitive_ops;
@@ -233,7 +236,8 @@ auto snippets::op::Subgraph::constant_input_should_be_inside_body(const std::sha
     return ov::is_type<ov::op::v1::Transpose>(node) ||
            ov::is_type<ov::op::v1::Broadcast>(node) ||
            ov::is_type<ov::op::v3::Broadcast>(node) ||
-           ov::is_type<ov::op::v1::Reshape>(node);
+           ov::is_type<ov::op::v1::Reshape>(node) ||
+           snippets::pass::ReduceDecomposition::is_supported_reduce(node);
 }
 
 ///
@@ -532,9 +536,11 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     ngraph::pass::Manager manager;
     if (config.m_has_domain_sensitive_ops) {
         manager.register_pass<snippets::pass::MatMulToBrgemm>();
+        manager.register_pass<snippets::pass::FuseBrgemmEpilogue>();
         manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
         manager.register_pass<snippets::pass::InsertBuffer>(allocationRank);
         manager.register_pass<snippets::pass::SoftmaxDecomposition>(count, allocationRank);
+        manager.register_pass<snippets::pass::ReduceDecomposition>(count);
         manager.register_pass<snippets::pass::TransposeDecomposition>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
@@ -615,6 +621,7 @@ snippets::Schedule snippets::op::Subgraph::generate(
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::generate")
     NGRAPH_CHECK(m_generator != nullptr, "generate is called while generator is not set");
+    NGRAPH_CHECK(!shapeAgnostic || !config.m_has_domain_sensitive_ops, "shape-agnostic kernels don't support domain sensitive ops");
 
     pre_dialect.run_passes(body_ptr());
     convert_to_snippet_dialect();
@@ -642,9 +649,10 @@ snippets::Schedule snippets::op::Subgraph::generate(
     ngraph::snippets::Generator::GeneratorConfig generatorConfig;
     generatorConfig.m_save_lowered_code = config.m_has_domain_sensitive_ops;
     generatorConfig.m_need_fill_tail_register = config.m_has_domain_sensitive_ops;
-    generatorConfig.m_optimize_single_evaluation = std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
+    generatorConfig.m_optimize_single_evaluation = !shapeAgnostic && std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) {
         return ov::is_type<ngraph::snippets::op::Buffer>(op);
     });
+    generatorConfig.m_shape_agnostic = shapeAgnostic;
 
     // actual code emission
     ngraph::snippets::code ptr = m_generator->generate(body_ptr(), generatorConfig, compile_params);
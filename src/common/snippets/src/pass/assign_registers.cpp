@@ -60,7 +60,14 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
             // TODO [96351]: We should rewrite accumulator pattern using another way
             const auto input = op->get_input_node_shared_ptr(0); // input - it's accumulator math op: Add or Max
             for (size_t i = 0; i < input->get_input_size(); ++i) {
-                if (ov::is_type<op::VectorBuffer>(input->get_input_node_shared_ptr(i))) {
+                const auto parent = input->get_input_node_shared_ptr(i);
+                if (ov::is_type<op::VectorBuffer>(parent)) {
+                    manually_assigned_vecs[input->input(i).get_tensor_ptr()] =
+                        static_cast<Reg>(accumulator_reg);
+                } else if (ov::is_type<op::Fill>(parent) && ov::is_type<op::VectorBuffer>(parent->get_input_node_shared_ptr(0))) {
+                    // VectorBuffer might be initialized by Fill (ReduceDecomposition), so Fill works in the accumulator register as well
+                    manually_assigned_vecs[parent->input(0).get_tensor_ptr()] =
+                        static_cast<Reg>(accumulator_reg);
                     manually_assigned_vecs[input->input(i).get_tensor_ptr()] =
                         static_cast<Reg>(accumulator_reg);
                 }
@@ -227,6 +234,33 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         for (const auto& def : defined_gpr[i])
             live_intervals_gpr[std::make_pair(i, find_last_use(life_in_gpr, static_cast<int>(def)))] = def;
     }
+    // A vector register defined before a Loop and used inside the Loop must be alive till the end of the Loop,
+    // since it's read again on every iteration (for example, the row values calculated between the Loops in ReduceDecomposition)
+    std::vector<std::pair<int, int>> loop_intervals;
+    for (int i = 0; i < static_cast<int>(ops.size()); i++) {
+        if (const auto loop_begin = ov::as_type_ptr<op::LoopBegin>(ops[i])) {
+            const auto loop_end = std::find(ops.begin() + i, ops.end(), loop_begin->get_loop_end());
+            loop_intervals.emplace_back(i, static_cast<int>(std::distance(ops.begin(), loop_end)));
+        }
+    }
+    if (!loop_intervals.empty()) {
+        decltype(live_intervals_vec) extended_intervals_vec;
+        for (const auto& interval_reg : live_intervals_vec) {
+            auto interval = interval_reg.first;
+            bool extended = true;
+            while (extended) {
+                extended = false;
+                for (const auto& loop : loop_intervals) {
+                    if (interval.first < loop.first && interval.second > loop.first && interval.second < loop.second) {
+                        interval.second = loop.second;
+                        extended = true;
+                    }
+                }
+            }
+            extended_intervals_vec[interval] = interval_reg.second;
+        }
+        live_intervals_vec = std::move(extended_intervals_vec);
+    }
 
     auto linescan_assign_registers = [](const decltype(live_intervals_vec)& live_intervals,
                                         const std::set<Reg>& reg_pool) {
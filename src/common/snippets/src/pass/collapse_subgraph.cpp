@@ -9,6 +9,7 @@
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
+#include "snippets/pass/reduce_decomposition.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -170,14 +171,26 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
            is_supported_matmul(n) ||
-           is_supported_broadcast_op(n);
+           is_supported_broadcast_op(n) ||
+           ReduceDecomposition::is_supported_reduce(n);
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
-    auto supported = [&n](descriptor::Tensor& t) -> bool {
+    // Dynamic shapes are supported only by elementwise operations, which are executed by shape-agnostic kernels.
+    // The operations below rely on the static shapes during the decomposition
+    const bool is_shape_agnostic = !(ov::is_type<const opset1::Transpose>(n) ||
+                                     ov::is_type<const opset1::MatMul>(n) ||
+                                     ov::is_type<const opset1::Softmax>(n) ||
+                                     ov::is_type<const ov::op::v8::Softmax>(n) ||
+                                     ov::is_type<const opset1::Broadcast>(n) ||
+                                     ov::is_type<const ov::op::v3::Broadcast>(n) ||
+                                     ov::is_type<const opset1::FakeQuantize>(n) ||
+                                     ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n));
+    auto supported = [&n, is_shape_agnostic](descriptor::Tensor& t) -> bool {
+        const auto& pshape = t.get_partial_shape();
         // Todo: int32 isn't supported in general because i32 emitters are required for bit-exact i32 calculations in some cases
         //  So i32 is supported exclusively for transposes and broadcast
-        return t.get_partial_shape().is_static() &&
+        return (pshape.is_static() || (is_shape_agnostic && pshape.rank().is_static())) &&
                (TokenizeSnippets::supported_element_types.count(t.get_element_type()) != 0 ||
                 (t.get_element_type() == ngraph::element::i32 &&
                         (ov::is_type<const opset1::Transpose>(n) ||
@@ -193,7 +206,9 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // The reduction axes are moved into the body as a Constant, so only data input of reductions is checked
+    const auto data_inputs_end = ov::is_type<const ov::op::util::ArithmeticReductionKeepDims>(n) ? inputs.begin() + 1 : inputs.end();
+    return std::all_of(inputs.begin(), data_inputs_end, [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -575,7 +590,14 @@ TokenizeSnippets::TokenizeSnippets() {
         }
 
         // todo: move this plugin-specific constraint to the plugin callback
-        if (body_parameters.size() + body_results.size() + hidden_data_count + static_cast<size_t>(need_buffer) > 12) {
+        // Note: shape-agnostic kernels keep one more gpr for the pointer to the runtime arguments
+        const bool has_dynamic_shapes =
+            std::any_of(body_parameters.begin(), body_parameters.end(),
+                        [](const std::shared_ptr<opset1::Parameter>& p) { return p->get_partial_shape().is_dynamic(); }) ||
+            std::any_of(body_results.begin(), body_results.end(),
+                        [](const std::shared_ptr<opset1::Result>& r) { return r->get_input_partial_shape(0).is_dynamic(); });
+        const size_t max_data_ptr_count = has_dynamic_shapes ? 11 : 12;
+        if (body_parameters.size() + body_results.size() + hidden_data_count + static_cast<size_t>(need_buffer) > max_data_ptr_count) {
             const std::string message_reset = "new subgraph is created. Impossible to schedule subgraph with " +
             std::to_string(body_parameters.size()) + " inputs, " + std::to_string(body_results.size()) + " outputs and " +
             std::to_string(hidden_data_count) + " non-scalar constants and " + std::to_string(need_buffer) + "buffers.";
@@ -589,6 +611,9 @@ TokenizeSnippets::TokenizeSnippets() {
         for (size_t i = 0; i < body->get_parameters().size(); i++) {
             body->get_parameters()[i]->set_friendly_name(body_parameters[i]->get_friendly_name());
         }
+        // Reductions are decomposed together with the whole body, so all the body ops must be compatible with them
+        if (!ReduceDecomposition::is_supported_body(body))
+            return abort_with_strategy("New subgraph is created since the body can't be decomposed with reductions");
         auto subgraph = op::build_subgraph(node, external_inputs, body, subgraph_name);
         copy_runtime_info(replaced_nodes, subgraph);
         const auto& act_body = subgraph->body();
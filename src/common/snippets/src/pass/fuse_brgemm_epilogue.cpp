@@ -0,0 +1,165 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/itt.hpp"
+
+#include "snippets/pass/fuse_brgemm_epilogue.hpp"
+
+#include "snippets/snippets_isa.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+#include "ngraph/rt_info.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
+#include "openvino/opsets/opset7.hpp"
+
+#include <limits>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+namespace {
+using PostOp = op::Brgemm::PostOp;
+
+// Returns the input of binary eltwise that isn't connected to the fused chain
+Output<Node> get_other_input(const std::shared_ptr<Node>& eltwise, const Output<Node>& chain) {
+    return eltwise->input_value(0) == chain ? eltwise->input_value(1) : eltwise->input_value(0);
+}
+
+bool get_scalar_value(const Output<Node>& value, float& scalar) {
+    const auto constant = ov::as_type_ptr<opset1::Constant>(value.get_node_shared_ptr());
+    if (!constant || constant->get_output_element_type(0) != element::f32 || shape_size(constant->get_output_shape(0)) != 1)
+        return false;
+    scalar = constant->cast_vector<float>()[0];
+    return true;
+}
+
+bool is_bias(const std::shared_ptr<Node>& eltwise, const Output<Node>& chain) {
+    const auto add = ov::as_type_ptr<opset1::Add>(eltwise);
+    if (!add || add->get_output_partial_shape(0) != chain.get_partial_shape())
+        return false;
+    const auto bias = get_other_input(add, chain);
+    const auto& bias_shape = bias.get_partial_shape();
+    const auto& out_shape = chain.get_partial_shape();
+    // The bias Parameter is read by Brgemm directly, so it mustn't have other consumers that need Load
+    return ov::is_type<opset1::Parameter>(bias.get_node_shared_ptr()) && bias.get_target_inputs().size() == 1 &&
+           bias.get_element_type() == element::f32 && bias_shape.is_static() && bias_shape.size() == out_shape.size() &&
+           *bias_shape.rbegin() == *out_shape.rbegin() && *++bias_shape.rbegin() == 1;
+}
+
+bool get_post_op(const std::shared_ptr<Node>& eltwise, const Output<Node>& chain, std::vector<PostOp>& post_ops) {
+    if (eltwise->get_output_partial_shape(0) != chain.get_partial_shape() ||
+        eltwise->get_output_element_type(0) != element::f32)
+        return false;
+
+    float scalar = 0.f;
+    if (ov::is_type<opset1::Add>(eltwise) || ov::is_type<opset1::Multiply>(eltwise) ||
+        ov::is_type<opset1::Subtract>(eltwise) || ov::is_type<opset1::Divide>(eltwise)) {
+        // Subtract and Divide are fused only if the chain is the first input: x - c and x / c
+        const bool is_commutative = ov::is_type<opset1::Add>(eltwise) || ov::is_type<opset1::Multiply>(eltwise);
+        if (!get_scalar_value(get_other_input(eltwise, chain), scalar) || (!is_commutative && eltwise->input_value(0) != chain))
+            return false;
+        if (ov::is_type<opset1::Add>(eltwise)) {
+            post_ops.emplace_back(PostOp::Type::Linear, 1.f, scalar);
+        } else if (ov::is_type<opset1::Subtract>(eltwise)) {
+            post_ops.emplace_back(PostOp::Type::Linear, 1.f, -scalar);
+        } else if (ov::is_type<opset1::Multiply>(eltwise)) {
+            post_ops.emplace_back(PostOp::Type::Linear, scalar, 0.f);
+        } else if (scalar != 0.f) {
+            post_ops.emplace_back(PostOp::Type::Linear, 1.f / scalar, 0.f);
+        } else {
+            return false;
+        }
+    } else if (ov::is_type<opset1::Relu>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Relu);
+    } else if (ov::is_type<ov::op::v0::Gelu>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::GeluErf);
+    } else if (const auto gelu = ov::as_type_ptr<ov::op::v7::Gelu>(eltwise)) {
+        post_ops.emplace_back(gelu->get_approximation_mode() == ov::op::GeluApproximationMode::TANH ? PostOp::Type::GeluTanh
+                                                                                                     : PostOp::Type::GeluErf);
+    } else if (ov::is_type<opset1::Sigmoid>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Sigmoid);
+    } else if (ov::is_type<opset1::Tanh>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Tanh);
+    } else if (const auto elu = ov::as_type_ptr<opset1::Elu>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Elu, static_cast<float>(elu->get_alpha()));
+    } else if (const auto clamp = ov::as_type_ptr<opset1::Clamp>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Clip, static_cast<float>(clamp->get_min()), static_cast<float>(clamp->get_max()));
+    } else if (ov::is_type<opset1::Abs>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Abs);
+    } else if (ov::is_type<opset1::Sqrt>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Sqrt);
+    } else if (ov::is_type<opset1::Exp>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::Exp);
+    } else if (ov::is_type<ov::op::v4::HSwish>(eltwise)) {
+        post_ops.emplace_back(PostOp::Type::HSwish);
+    } else if (ov::is_type<opset1::Maximum>(eltwise) || ov::is_type<opset1::Minimum>(eltwise)) {
+        // The clamp of the decomposed FakeQuantize: Maximum(x, input_low) -> Minimum(x, input_high) is fused as one Clip
+        if (!get_scalar_value(get_other_input(eltwise, chain), scalar))
+            return false;
+        const auto lowest = std::numeric_limits<float>::lowest();
+        const auto highest = std::numeric_limits<float>::max();
+        if (ov::is_type<opset1::Maximum>(eltwise)) {
+            post_ops.emplace_back(PostOp::Type::Clip, scalar, highest);
+        } else if (!post_ops.empty() && post_ops.back().type == PostOp::Type::Clip && post_ops.back().beta == highest) {
+            post_ops.back().beta = scalar;
+        } else {
+            post_ops.emplace_back(PostOp::Type::Clip, lowest, scalar);
+        }
+    } else if (const auto round = ov::as_type_ptr<ov::op::v5::Round>(eltwise)) {
+        post_ops.emplace_back(round->get_mode() == ov::op::v5::Round::RoundMode::HALF_TO_EVEN ? PostOp::Type::RoundHalfToEven
+                                                                                              : PostOp::Type::RoundHalfAwayFromZero);
+    } else {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+FuseBrgemmEpilogue::FuseBrgemmEpilogue() {
+    MATCHER_SCOPE(FuseBrgemmEpilogue);
+    auto brgemm_pattern = ngraph::pattern::wrap_type<op::Brgemm>();
+
+    auto callback = [=](ngraph::pattern::Matcher& m) {
+        OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::FuseBrgemmEpilogue")
+        const auto brgemm = ov::as_type_ptr<op::Brgemm>(m.get_match_root());
+        if (!brgemm || brgemm->has_epilogue() || brgemm->is_dynamic() || brgemm->get_output_element_type(0) != element::f32)
+            return false;
+
+        std::vector<PostOp> post_ops;
+        std::shared_ptr<Node> bias = nullptr;
+        ov::NodeVector fused_ops = { brgemm };
+        auto chain = brgemm->output(0);
+        while (chain.get_target_inputs().size() == 1) {
+            const auto child = chain.get_target_inputs().begin()->get_node()->shared_from_this();
+            // Bias is added to the accumulated tile before the post-ops are applied, so it can be only the first fused op
+            if (fused_ops.size() == 1 && is_bias(child, chain)) {
+                bias = get_other_input(child, chain).get_node_shared_ptr();
+            } else if (!get_post_op(child, chain, post_ops)) {
+                break;
+            }
+            fused_ops.push_back(child);
+            chain = child->output(0);
+        }
+        if (fused_ops.size() == 1)
+            return false;
+
+        const auto fused_brgemm = std::make_shared<op::Brgemm>(brgemm->input_value(0), brgemm->input_value(1),
+                                                               brgemm->get_offset_a(), brgemm->get_offset_b(), brgemm->get_offset_c());
+        if (bias)
+            fused_brgemm->set_bias(bias);
+        fused_brgemm->set_post_ops(post_ops);
+        fused_brgemm->validate_and_infer_types();
+        fused_brgemm->set_friendly_name(brgemm->get_friendly_name());
+        ngraph::copy_runtime_info(fused_ops, fused_brgemm);
+        ngraph::replace_node(fused_ops.back(), fused_brgemm);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(brgemm_pattern, matcher_name);
+    register_matcher(m, callback);
+}
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
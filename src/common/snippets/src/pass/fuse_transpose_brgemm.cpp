@@ -40,12 +40,15 @@ FuseTransposeBrgemm::FuseTransposeBrgemm() {
     auto constant = pattern::wrap_type<opset1::Constant>();
     auto transpose = pattern::wrap_type<opset1::Transpose>({pattern::any_input(), constant}, transpose_is_supported);
     auto transpose_matcher = std::make_shared<pattern::Matcher>(transpose);
-    auto brgemm_any = pattern::wrap_type<op::Brgemm>({pattern::any_input(), pattern::any_input()});
+    // Brgemm may have bias on the 3rd input, so the input count isn't fixed in the patterns
+    auto brgemm_any = pattern::wrap_type<op::Brgemm>();
 
-    auto brgemm_in0 = pattern::wrap_type<op::Brgemm>({transpose, pattern::any_input()});
-    auto brgemm_in1 = pattern::wrap_type<op::Brgemm>({pattern::any_input(), transpose});
+    auto brgemm_in = pattern::wrap_type<op::Brgemm>([=](const Output<Node>& out) {
+        const auto brgemm = out.get_node_shared_ptr();
+        return transpose_matcher->match(brgemm->input_value(0)) || transpose_matcher->match(brgemm->input_value(1));
+    });
     auto brgemm_out0 = pattern::wrap_type<opset1::Transpose>({brgemm_any, constant});
-    auto brgemm_or_transpose = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{brgemm_in0, brgemm_in1, brgemm_out0});
+    auto brgemm_or_transpose = std::make_shared<ov::pass::pattern::op::Or>(OutputVector{brgemm_in, brgemm_out0});
 
     auto callback = [=](pattern::Matcher& m) {
         OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "FuseTransposeBrgemm")
@@ -60,7 +63,8 @@ FuseTransposeBrgemm::FuseTransposeBrgemm() {
                 in.replace_source_output(brgemm->output(0));
             utils::set_transpose_output_layout(brgemm_out, as_type_ptr<opset1::Transpose>(transpose_out.get_node_shared_ptr()));
         }
-        for (size_t i = 0; i < brgemm->get_input_size(); i++) {
+        // Transposes are fused only on the matrices inputs
+        for (size_t i = 0; i < 2; i++) {
             const auto& in_value = brgemm->input_value(i);
             if (transpose_matcher->match(in_value)) {
                 const auto& transpose = as_type_ptr<opset1::Transpose>(in_value.get_node_shared_ptr());
@@ -145,8 +145,9 @@ void insert_loops_explicitly(const ov::NodeVector& ops, const size_t vector_size
             std::vector<bool> apply_increments = InsertLoops::calculate_outer_apply_increments(body_shapes);
             std::vector<int64_t> outer_finalization_offsets(body_shapes.size(), 0);
             const auto& outer_loop_begin = op::insertLoopBegin(body_parameters);
-            op::insertLoopEnd(body_results, outer_loop_begin, outer_work_amount, 1lu,
+            const auto& outer_loop_end = op::insertLoopEnd(body_results, outer_loop_begin, outer_work_amount, 1lu,
                 apply_increments, outer_finalization_offsets);
+            outer_loop_end->dimension = 1;
         }
     };
 
@@ -270,7 +271,8 @@ bool InsertLoops::run_on_model(const std::shared_ptr<ov::Model> &model) {
             if (outer_work_amount > 1) {
                 std::vector<bool> apply_increments = InsertLoops::calculate_outer_apply_increments(ioShapes);
                 const auto& outer_loop_begin = op::insertLoopBegin(commonParams);
-                op::insertLoopEnd(commonResults, outer_loop_begin, outer_work_amount, 1lu, apply_increments);
+                const auto& outer_loop_end = op::insertLoopEnd(commonResults, outer_loop_begin, outer_work_amount, 1lu, apply_increments);
+                outer_loop_end->dimension = 1;
             }
         } else {
             insert_loops_explicitly(ops, m_vector_size);
@@ -74,8 +74,10 @@ ngraph::snippets::pass::InsertMoveBroadcast::InsertMoveBroadcast() {
             // We don't need to insert BroadcastMove after the following operations:
             // - Scalar has emitter with explicit broadcasting
             // - VectorBuffer has scalar output shape to avoid broadcast conflicts and manually shape insertion.
+            // - Fill of VectorBuffer initializes the whole vector register, so it has scalar output shape as well.
             return utils::is_scalar_constant(v.get_node_shared_ptr()) ||
-                   ov::is_type<ngraph::snippets::op::VectorBuffer>(v.get_node_shared_ptr());
+                   ov::is_type<ngraph::snippets::op::VectorBuffer>(v.get_node_shared_ptr()) ||
+                   ov::is_type<ngraph::snippets::op::Fill>(v.get_node_shared_ptr());
         };
         std::vector<ov::PartialShape> input_shapes;
         std::vector<bool> is_ignored;
@@ -22,12 +22,26 @@ auto is_supported_tensor(const ngraph::descriptor::Tensor& t) -> bool {
     return t.get_element_type() == ngraph::element::f32 && t.get_partial_shape().is_static() && t.get_shape().size() == 4;
 }
 
-// TODO: Add support of FQ, Reshape?
+// Only per-tensor FakeQuantize is supported: it's decomposed into the ops with scalar Constants which can be fused into brgemm epilogue
+auto is_supported_fq(const std::shared_ptr<ngraph::Node>& node) -> bool {
+    const auto fq = ngraph::as_type_ptr<ngraph::opset1::FakeQuantize>(node);
+    if (!fq || fq->get_output_element_type(0) != ngraph::element::f32)
+        return false;
+    for (size_t i = 1; i < fq->get_input_size(); ++i) {
+        const auto constant = ngraph::as_type_ptr<ngraph::opset1::Constant>(fq->get_input_node_shared_ptr(i));
+        if (!constant || ngraph::shape_size(constant->get_output_shape(0)) != 1)
+            return false;
+    }
+    return true;
+}
+
+// TODO: Add support of Reshape?
 auto is_supported_op(const std::shared_ptr<ngraph::Node>& node) -> bool {
     return ngraph::snippets::pass::TokenizeSnippets::AppropriateForSubgraph(node) &&
            (ngraph::is_type<ngraph::op::util::UnaryElementwiseArithmetic>(node) ||
             ngraph::is_type<ngraph::op::util::BinaryElementwiseArithmetic>(node) ||
-            ngraph::is_type<ngraph::op::v1::Select>(node));
+            ngraph::is_type<ngraph::op::v1::Select>(node) ||
+            is_supported_fq(node));
 }
 
 auto is_valid_transpose(const std::shared_ptr<ngraph::opset1::Transpose>& node, std::vector<int64_t> expected_order) -> bool {
@@ -105,7 +119,7 @@ auto tokenize_reshape_around_softmax(std::shared_ptr<ov::Node>& interm_op,
 };
 
 auto update_intermediate_supported_ops(std::shared_ptr<ov::Node>& interm_op, ngraph::NodeVector& ordered_ops) -> bool {
-    // TODO: Add Reshape, FQ support
+    // TODO: Add Reshape support
     while (is_supported_op(interm_op)) {
         // All supported intermediate ops have only one output port
         // To verify output element type is enough because all supported intermediate ops have the same output element type as input type
@@ -0,0 +1,438 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/remarks.hpp"
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/reduce_decomposition.hpp"
+#include "snippets/pass/reset_buffer.hpp"
+#include "snippets/pass/insert_loops.hpp"
+#include "snippets/pass/loop_helpers.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/utils.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+
+#include <functional>
+#include <set>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+namespace {
+// The kind of the tensor in the decomposed body:
+//  - Scalar - scalar Constant (or an op on scalar Constants), might be used anywhere;
+//  - Row - the last dimension is equal to 1 (reduced values and inputs broadcasted along the last dimension),
+//          the value is calculated once per row outside the inner Loops;
+//  - Full - the last dimension is equal to the reduced one, the value is calculated inside the inner Loops.
+enum class ValueKind { Scalar, Row, Full };
+
+auto is_reduce_max(const std::shared_ptr<const ov::Node>& node) -> bool {
+    return ov::is_type<ov::op::v1::ReduceMax>(node);
+}
+
+auto get_value_kind(const ov::Output<ov::Node>& value) -> ValueKind {
+    const auto node = value.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Constant>(node))
+        return ValueKind::Scalar;
+    const auto& pshape = value.get_partial_shape();
+    if (ov::is_scalar(pshape))
+        return ValueKind::Scalar;
+    return utils::get_inner_dim(pshape) == 1 ? ValueKind::Row : ValueKind::Full;
+}
+} // namespace
+
+const size_t ReduceDecomposition::max_reduce_count = 4;
+
+ReduceDecomposition::ReduceDecomposition(size_t vector_size) : m_vector_size(vector_size) {}
+
+bool ReduceDecomposition::is_supported_reduce(const std::shared_ptr<const ov::Node>& node) {
+    if (!ov::is_type<ov::op::v1::ReduceSum>(node) &&
+        !ov::is_type<ov::op::v1::ReduceMean>(node) &&
+        !ov::is_type<ov::op::v1::ReduceMax>(node))
+        return false;
+    const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(node);
+    const auto& pshape = node->get_input_partial_shape(0);
+    if (!reduce || !reduce->get_keep_dims() || pshape.rank().is_dynamic() || pshape.size() == 0 ||
+        !ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1)))
+        return false;
+    const auto& inner_dim = utils::get_inner_dim(pshape);
+    if (inner_dim.is_dynamic() || inner_dim.get_length() <= 1)
+        return false;
+    // Only the last dimension can be reduced at the moment
+    const auto axes = reduce->get_reduction_axes();
+    return axes.size() == 1 && *axes.begin() == pshape.size() - 1;
+}
+
+bool ReduceDecomposition::is_supported_body(const std::shared_ptr<const ov::Model>& body) {
+    const auto ops = body->get_ordered_ops();
+    size_t max_rank = 0;
+    for (const auto& parameter : body->get_parameters())
+        max_rank = std::max(max_rank, parameter->get_output_partial_shape(0).size());
+    size_t reduce_count = 0;
+    ov::Dimension reduced_dim;
+    // The ops which depend on the reduced values
+    std::set<const ov::Node*> reduce_consumers;
+    for (const auto& op : ops) {
+        const auto consumes_reduce = std::any_of(op->inputs().begin(), op->inputs().end(), [&](const ov::Input<ov::Node>& in) {
+            return reduce_consumers.count(in.get_source_output().get_node()) != 0;
+        });
+        if (is_supported_reduce(op)) {
+            // All the reductions are accumulated in one Loop, so the inputs are read twice: by the reductions and
+            // by their consumers. A reduction of the reduced values would need one more Loop over the inputs
+            if (consumes_reduce)
+                return false;
+            const auto& pshape = op->get_input_partial_shape(0);
+            const auto& inner_dim = utils::get_inner_dim(pshape);
+            // The reduction axis is set explicitly, so the input rank must not be changed by the canonicalization
+            if (pshape.size() != max_rank || (reduce_count++ != 0 && inner_dim != reduced_dim))
+                return false;
+            reduced_dim = inner_dim;
+        }
+        if (consumes_reduce || is_supported_reduce(op))
+            reduce_consumers.insert(op.get());
+    }
+    if (reduce_count == 0)
+        return true;
+    if (reduce_count > max_reduce_count)
+        return false;
+
+    for (const auto& op : ops) {
+        if (ov::is_type<ov::op::v0::Result>(op) || ov::is_type<ov::op::v0::Constant>(op))
+            continue;
+        // Reductions can be fused only with elementwise ops
+        if (ov::is_type<ov::op::v1::Softmax>(op) ||
+            ov::is_type<ov::op::v8::Softmax>(op) ||
+            ov::is_type<ov::op::v0::MatMul>(op) ||
+            ov::is_type<ov::op::v1::Transpose>(op) ||
+            ov::is_type<ov::op::v1::Broadcast>(op) ||
+            ov::is_type<ov::op::v3::Broadcast>(op) ||
+            ov::is_type<ov::op::v0::FakeQuantize>(op))
+            return false;
+        if (ov::is_type<ov::op::util::ArithmeticReductionKeepDims>(op) && !is_supported_reduce(op))
+            return false;
+        for (const auto& output : op->outputs()) {
+            const auto& pshape = output.get_partial_shape();
+            if (pshape.is_dynamic())
+                return false;
+            if (!ov::is_scalar(pshape) && utils::get_inner_dim(pshape) != 1 && utils::get_inner_dim(pshape) != reduced_dim)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool ReduceDecomposition::run_on_model(const std::shared_ptr<ov::Model>& body) {
+    RUN_ON_MODEL_SCOPE(ReduceDecomposition);
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceDecomposition")
+    const auto ops = body->get_ordered_ops();
+    if (std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& op) { return is_supported_reduce(op); }))
+        return false;
+    NGRAPH_CHECK(is_supported_body(body), "ReduceDecomposition got unsupported body");
+
+    /* ============= Master shape ================ */
+
+    ov::PartialShape master_shape;
+    for (const auto& op : ops) {
+        if (ov::is_type<ov::op::v0::Parameter>(op) || is_supported_reduce(op)) {
+            const auto& pshape = ov::is_type<ov::op::v0::Parameter>(op) ? op->get_output_partial_shape(0) : op->get_input_partial_shape(0);
+            if (master_shape.rank().is_dynamic() || master_shape.size() == 0)
+                master_shape = pshape;
+            else
+                NGRAPH_CHECK(ov::PartialShape::broadcast_merge_into(master_shape, pshape, ::ngraph::op::AutoBroadcastType::NUMPY),
+                             "ReduceDecomposition got not broadcastable shapes");
+        }
+    }
+    NGRAPH_CHECK(master_shape.is_static(), "ReduceDecomposition supports only static shapes");
+    const auto rank = master_shape.size();
+    const auto work_amount = static_cast<size_t>(utils::get_inner_dim(master_shape).get_length());
+    const auto outer_work_amount = rank > 1 ? static_cast<size_t>(utils::get_outer_dim(master_shape).get_length()) : 1lu;
+    const auto has_outer_loop = outer_work_amount > 1;
+
+    /* ======== Loop levels of the values ======== */
+
+    // A reduction can be calculated only when its input is fully processed, so the body is split into several Loops:
+    // the level of a value is the index of the Loop where the value is available.
+    std::map<ov::Node*, size_t> levels;
+    size_t max_level = 0;
+    for (const auto& op : ops) {
+        size_t level = 0;
+        for (const auto& input : op->input_values())
+            level = std::max(level, levels[input.get_node()]);
+        if (is_supported_reduce(op))
+            level = levels[op->get_input_node_ptr(0)] + 1;
+        levels[op.get()] = level;
+        max_level = std::max(max_level, level);
+    }
+
+    // Sinks of the Loop are the reductions accumulated inside the Loop and the Results stored inside the Loop
+    std::vector<ov::NodeVector> loop_reduces(max_level + 1), loop_results(max_level + 1), row_ops(max_level + 1), row_results(max_level + 1);
+    for (const auto& op : ops) {
+        if (is_supported_reduce(op)) {
+            loop_reduces[levels[op->get_input_node_ptr(0)]].push_back(op);
+        } else if (ov::is_type<ov::op::v0::Result>(op)) {
+            const auto kind = get_value_kind(op->input_value(0));
+            NGRAPH_CHECK(kind != ValueKind::Scalar, "ReduceDecomposition doesn't support scalar Results");
+            (kind == ValueKind::Full ? loop_results : row_results)[levels[op.get()]].push_back(op);
+        } else if (!ov::is_type<ov::op::v0::Parameter>(op) && !ov::is_type<ov::op::v0::Constant>(op) &&
+                   get_value_kind(op->output(0)) == ValueKind::Row) {
+            row_ops[levels[op.get()]].push_back(op);
+        }
+    }
+
+    // Full Parameters that are read by each Loop
+    const auto& parameters = body->get_parameters();
+    std::vector<std::set<size_t>> loop_parameters(max_level + 1);
+    std::vector<size_t> last_loop_of_parameter(parameters.size(), 0);
+    for (size_t level = 0; level <= max_level; ++level) {
+        std::set<ov::Node*> visited;
+        std::function<void(const ov::Output<ov::Node>&)> collect_parameters;
+        collect_parameters = [&](const ov::Output<ov::Node>& value) {
+            const auto node = value.get_node_shared_ptr();
+            if (get_value_kind(value) == ValueKind::Row || !visited.insert(node.get()).second)
+                return;
+            if (const auto parameter = ov::as_type_ptr<ov::op::v0::Parameter>(node)) {
+                const auto idx = static_cast<size_t>(body->get_parameter_index(parameter));
+                loop_parameters[level].insert(idx);
+                last_loop_of_parameter[idx] = level;
+            }
+            for (const auto& input : node->input_values())
+                collect_parameters(input);
+        };
+        for (const auto& reduce : loop_reduces[level])
+            collect_parameters(reduce->input_value(0));
+        for (const auto& result : loop_results[level])
+            collect_parameters(result->input_value(0));
+    }
+
+    /* ============ Body construction ============ */
+
+    // New values of the original Row outputs
+    std::map<ov::Output<ov::Node>, ov::Output<ov::Node>> row_values;
+    // The ops executed outside the inner Loops: the next Loop must be executed after all of them
+    ov::NodeVector outside_ops;
+    // The ops without inputs that should be executed inside the outer Loop
+    ov::NodeVector outer_loop_ops;
+    // The Parameters are passed through the Loops to keep data pointer increments in the order of the Loops execution
+    std::vector<ov::Output<ov::Node>> parameter_sources;
+    for (const auto& parameter : parameters)
+        parameter_sources.push_back(parameter->output(0));
+
+    auto mark_outside_loop = [&outside_ops](const std::shared_ptr<ov::Node>& node) {
+        node->get_rt_info()["outside_loop"] = true;
+        outside_ops.push_back(node);
+    };
+
+    // Clones the subgraph that calculates the value. Row values are already calculated,
+    // Full Parameters are replaced with the passed Loads (nullptr loop_begin means calculation outside Loops)
+    std::function<ov::Output<ov::Node>(const ov::Output<ov::Node>&, std::map<ov::Output<ov::Node>, ov::Output<ov::Node>>&,
+                                       const std::shared_ptr<op::LoopBegin>&)> clone_value;
+    clone_value = [&](const ov::Output<ov::Node>& value, std::map<ov::Output<ov::Node>, ov::Output<ov::Node>>& cloned,
+                      const std::shared_ptr<op::LoopBegin>& loop_begin) -> ov::Output<ov::Node> {
+        const auto row_it = row_values.find(value);
+        if (row_it != row_values.end())
+            return row_it->second;
+        const auto cloned_it = cloned.find(value);
+        if (cloned_it != cloned.end())
+            return cloned_it->second;
+        const auto node = value.get_node_shared_ptr();
+        NGRAPH_CHECK(!ov::is_type<ov::op::v0::Parameter>(node), "ReduceDecomposition: Parameter hasn't been loaded");
+        ov::OutputVector new_inputs;
+        for (const auto& input : node->input_values())
+            new_inputs.push_back(clone_value(input, cloned, loop_begin));
+        const auto new_node = node->clone_with_new_inputs(new_inputs);
+        ngraph::copy_runtime_info(node, new_node);
+        if (loop_begin) {
+            // Constants (Scalars) must be executed inside the Loop, since the register might be corrupted by the Loop body
+            if (new_inputs.empty())
+                new_node->add_control_dependency(loop_begin);
+        } else {
+            mark_outside_loop(new_node);
+            if (new_inputs.empty())
+                outer_loop_ops.push_back(new_node);
+        }
+        const auto new_value = new_node->output(value.get_index());
+        cloned[value] = new_value;
+        return new_value;
+    };
+
+    // Row Parameters are loaded once per row
+    for (const auto& parameter : parameters) {
+        if (get_value_kind(parameter->output(0)) != ValueKind::Row || parameter->output(0).get_target_inputs().empty())
+            continue;
+        const auto load = std::make_shared<op::Load>(parameter, 1lu);
+        mark_outside_loop(load);
+        row_values[parameter->output(0)] = load;
+    }
+
+    std::vector<std::shared_ptr<op::LoopEnd>> inner_loop_ends;
+    for (size_t level = 0; level <= max_level; ++level) {
+        /* ======= Row values available before the Loop ======= */
+        std::map<ov::Output<ov::Node>, ov::Output<ov::Node>> row_cloned;
+        for (const auto& op : row_ops[level])
+            row_values[op->output(0)] = clone_value(op->output(0), row_cloned, nullptr);
+        for (const auto& result : row_results[level]) {
+            const auto store = std::make_shared<op::Store>(row_values.at(result->input_value(0)), 1lu);
+            mark_outside_loop(store);
+            result->set_argument(0, store);
+        }
+
+        if (loop_reduces[level].empty() && loop_results[level].empty())
+            continue;
+
+        /* ============ Loop over the last dimension ============ */
+        const auto& param_indexes = loop_parameters[level];
+        NGRAPH_CHECK(!param_indexes.empty(), "ReduceDecomposition: inner Loop must read at least one Parameter");
+        ov::OutputVector loop_inputs;
+        for (const auto idx : param_indexes)
+            loop_inputs.push_back(parameter_sources[idx]);
+        const auto loop_begin = std::make_shared<op::LoopBegin>(loop_inputs);
+        for (const auto& op : outside_ops)
+            loop_begin->add_control_dependency(op);
+
+        std::map<ov::Output<ov::Node>, ov::Output<ov::Node>> loop_cloned;
+        size_t input_idx = 0;
+        for (const auto idx : param_indexes) {
+            loop_cloned[parameters[idx]->output(0)] = std::make_shared<op::Load>(loop_begin->output(input_idx++), m_vector_size);
+        }
+
+        ov::NodeVector accumulators, horizons;
+        for (const auto& reduce : loop_reduces[level]) {
+            const auto data = clone_value(reduce->input_value(0), loop_cloned, loop_begin);
+            const auto vector_buffer = std::make_shared<op::VectorBuffer>();
+            std::shared_ptr<ov::Node> accumulator, horizon;
+            // VectorBuffer is zero-initialized, so the maximum accumulator is refilled by the lowest float value
+            if (is_reduce_max(reduce)) {
+                const auto init = std::make_shared<op::Fill>(vector_buffer, 0, uint32_t(0xff7fffff));
+                accumulator = std::make_shared<ov::op::v1::Maximum>(data, init);
+                accumulator->input(0).get_rt_info()["set_fill"] = uint32_t(0xff7fffff);
+                horizon = std::make_shared<op::HorizonMax>(accumulator);
+                loop_begin->add_control_dependency(init);
+                mark_outside_loop(init);
+            } else {
+                accumulator = std::make_shared<ov::op::v1::Add>(data, vector_buffer);
+                accumulator->input(0).get_rt_info()["set_fill"] = uint32_t(0x00000000);
+                horizon = std::make_shared<op::HorizonSum>(accumulator);
+            }
+            loop_begin->add_control_dependency(vector_buffer);
+            mark_outside_loop(vector_buffer);
+            outer_loop_ops.push_back(vector_buffer);
+            accumulators.push_back(accumulator);
+            horizons.push_back(horizon);
+            ngraph::copy_runtime_info(reduce, {vector_buffer, accumulator, horizon});
+        }
+
+        ov::OutputVector loop_outputs;
+        std::vector<bool> apply_increments;
+        std::vector<int64_t> finalization_offsets;
+        std::vector<ov::Input<ov::Node>> stored_results;
+        for (const auto& result : loop_results[level]) {
+            const auto store = std::make_shared<op::Store>(clone_value(result->input_value(0), loop_cloned, loop_begin), m_vector_size);
+            loop_outputs.push_back(store);
+            stored_results.push_back(result->input(0));
+        }
+        // The Parameters read by the next Loops are passed through the Loop. Loop must have at least one output,
+        // so if there are no outputs, the first Parameter is passed through as well
+        std::vector<size_t> passed_parameters;
+        for (const auto idx : param_indexes) {
+            if (last_loop_of_parameter[idx] != level || (loop_outputs.empty() && passed_parameters.empty() && idx == *param_indexes.begin()))
+                passed_parameters.push_back(idx);
+        }
+        for (const auto idx : passed_parameters)
+            loop_outputs.push_back(loop_begin->output(std::distance(param_indexes.begin(), param_indexes.find(idx))));
+
+        // The data pointer of the Parameter is shifted back after the Loop if the Parameter is read by the next Loops.
+        // Otherwise, the pointer is moved to the next row (or shifted back if the row is broadcasted in the outer Loop)
+        auto get_finalization_offset = [&](const ov::PartialShape& shape, bool is_last_read) -> int64_t {
+            if (!is_last_read)
+                return ResetBufferState::calculate_required_finalization_offsets(work_amount, utils::get_inner_dim(shape).get_length());
+            return has_outer_loop ? InsertLoops::calculate_finalization_offsets(master_shape, {shape})[0] : 0;
+        };
+        for (const auto idx : param_indexes) {
+            const auto is_passed = std::find(passed_parameters.begin(), passed_parameters.end(), idx) != passed_parameters.end();
+            const auto& shape = parameters[idx]->get_output_partial_shape(0);
+            // The increments of the passed Parameters are applied to the Loop output, since it's the same data pointer
+            apply_increments.push_back(!is_passed && InsertLoops::calculate_inner_apply_increments(master_shape, {shape})[0]);
+            finalization_offsets.push_back(is_passed ? 0 : get_finalization_offset(shape, true));
+        }
+        for (const auto& result : stored_results) {
+            const auto& shape = result.get_partial_shape();
+            apply_increments.push_back(InsertLoops::calculate_inner_apply_increments(master_shape, {shape})[0]);
+            finalization_offsets.push_back(get_finalization_offset(shape, true));
+        }
+        for (const auto idx : passed_parameters) {
+            const auto& shape = parameters[idx]->get_output_partial_shape(0);
+            apply_increments.push_back(InsertLoops::calculate_inner_apply_increments(master_shape, {shape})[0]);
+            finalization_offsets.push_back(get_finalization_offset(shape, last_loop_of_parameter[idx] == level));
+        }
+
+        loop_outputs.push_back(loop_begin->output(loop_begin->get_output_size() - 1));
+        const auto loop_end = std::make_shared<op::LoopEnd>(loop_outputs, work_amount, m_vector_size, apply_increments, finalization_offsets);
+        loop_end->has_outer_loop = has_outer_loop;
+        inner_loop_ends.push_back(loop_end);
+
+        for (size_t i = 0; i < stored_results.size(); ++i)
+            stored_results[i].replace_source_output(loop_end->output(i));
+        for (size_t i = 0; i < passed_parameters.size(); ++i)
+            parameter_sources[passed_parameters[i]] = loop_end->output(stored_results.size() + i);
+
+        /* ========== Control dependency ============= */
+        for (const auto& accumulator : accumulators)
+            loop_end->add_control_dependency(accumulator);
+        for (size_t i = 0; i < horizons.size(); ++i) {
+            horizons[i]->add_control_dependency(loop_end);
+            mark_outside_loop(horizons[i]);
+            ov::Output<ov::Node> reduced = horizons[i];
+            const auto& reduce = loop_reduces[level][i];
+            if (ov::is_type<ov::op::v1::ReduceMean>(reduce)) {
+                const auto scale = ngraph::op::Constant::create(ov::element::f32, ngraph::Shape{}, {1.f / static_cast<float>(work_amount)});
+                const auto mean = std::make_shared<ov::op::v1::Multiply>(horizons[i], scale);
+                ngraph::copy_runtime_info(reduce, {scale, mean});
+                mark_outside_loop(scale);
+                mark_outside_loop(mean);
+                outer_loop_ops.push_back(scale);
+                reduced = mean;
+            }
+            row_values[reduce->output(0)] = reduced;
+        }
+    }
+
+    // The original ops aren't used anymore, so they are disconnected from the Parameters
+    // to avoid the side consumers of the data
+    for (const auto& op : ops) {
+        if (ov::is_type<ov::op::v0::Parameter>(op) || ov::is_type<ov::op::v0::Result>(op))
+            continue;
+        for (auto input : op->inputs())
+            input.get_source_output().remove_target_input(input);
+    }
+
+    /* ============== Outer loop ================= */
+    if (has_outer_loop) {
+        std::vector<ov::PartialShape> io_shapes;
+        for (const auto& parameter : parameters)
+            io_shapes.push_back(parameter->get_output_partial_shape(0));
+        const auto& results = body->get_results();
+        std::vector<ov::Input<ov::Node>> result_inputs;
+        for (const auto& result : results) {
+            io_shapes.push_back(result->get_input_partial_shape(0));
+            result_inputs.push_back(result->input(0));
+        }
+        const auto outer_loop_begin = op::insertLoopBegin(parameters);
+        const auto outer_loop_end = op::insertLoopEndBeforeInputs(result_inputs, outer_loop_begin, outer_work_amount, 1lu,
+                                                                  InsertLoops::calculate_outer_apply_increments(io_shapes));
+        outer_loop_end->dimension = 1;
+        for (const auto& op : outer_loop_ops)
+            op->add_control_dependency(outer_loop_begin);
+        for (const auto& loop_end : inner_loop_ends)
+            outer_loop_end->add_control_dependency(loop_end);
+    }
+
+    return true;
+}
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
@@ -63,6 +63,11 @@ ngraph::snippets::pass::ResetBufferState::ResetBufferState() {
         }
         for (size_t i = 0; i < o_size; ++i) {
             body_shapes[i_size + i] = loop_end->output(i).get_partial_shape();
+            // The output might have no consumers if it's just passed through the Loop (see ReduceDecomposition)
+            if (loop_end->output(i).get_target_inputs().empty()) {
+                io[i_size + i] = loop_end;
+                continue;
+            }
             // check for first target input is enough for Buffer searching because operations can have only single Buffer per each output port as op
             auto consumer = *loop_end->output(i).get_target_inputs().begin();
             auto port_idx = consumer.get_index();
@@ -79,6 +84,8 @@ ngraph::snippets::pass::ResetBufferState::ResetBufferState() {
 
         // If after Loop there is immediately Buffer, we should reset the Buffer ptr for the next calculations
         for (size_t i = 0; i < o_size; ++i) {
+            if (loop_end->output(i).get_target_inputs().empty())
+                continue;
             // check for first target input is enough for Buffer searching because operations can have only single Buffer per each output port as op
             const auto consumer = loop_end->output(i).get_target_inputs().begin()->get_node();
             if (const auto buffer = ov::as_type_ptr<ngraph::snippets::op::Buffer>(consumer->shared_from_this())) {
@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/fuse_brgemm_epilogue.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+using PostOpType = snippets::op::Brgemm::PostOp::Type;
+
+std::shared_ptr<opset1::Constant> scalar(float value) {
+    return opset1::Constant::create(element::f32, Shape{}, {value});
+}
+
+// Runs FuseBrgemmEpilogue and returns the Brgemm that produces the model output or nullptr if the output isn't Brgemm
+std::shared_ptr<snippets::op::Brgemm> fuse_epilogue(const std::shared_ptr<Function>& function) {
+    pass::Manager manager;
+    manager.register_pass<snippets::pass::FuseBrgemmEpilogue>();
+    manager.run_passes(function);
+    return ov::as_type_ptr<snippets::op::Brgemm>(function->get_results()[0]->get_input_node_shared_ptr(0));
+}
+} // namespace
+
+TEST(FuseBrgemmEpilogue, BiasScaleAndTanh) {
+    auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 16, 32});
+    auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 32, 24});
+    auto bias = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 1, 24});
+    auto brgemm = std::make_shared<snippets::op::Brgemm>(data0, data1);
+    auto add = std::make_shared<opset1::Add>(brgemm, bias);
+    auto multiply = std::make_shared<opset1::Multiply>(add, scalar(0.125f));
+    auto tanh = std::make_shared<opset1::Tanh>(multiply);
+    auto function = std::make_shared<Function>(NodeVector{tanh}, ParameterVector{data0, data1, bias});
+
+    const auto fused = fuse_epilogue(function);
+    ASSERT_NE(fused, nullptr);
+    // Parameters, Brgemm and Result
+    ASSERT_EQ(function->get_ops().size(), 5);
+    ASSERT_TRUE(fused->has_bias());
+    ASSERT_EQ(fused->input_value(2), bias->output(0));
+    const auto& post_ops = fused->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 2);
+    EXPECT_EQ(post_ops[0].type, PostOpType::Linear);
+    EXPECT_EQ(post_ops[0].alpha, 0.125f);
+    EXPECT_EQ(post_ops[0].beta, 0.f);
+    EXPECT_EQ(post_ops[1].type, PostOpType::Tanh);
+}
+
+TEST(FuseBrgemmEpilogue, DecomposedFakeQuantize) {
+    // Decomposed per-tensor FakeQuantize with f32 output:
+    // round((clamp(x, il, ih) - il) * (levels - 1) / (ih - il)) * (oh - ol) / (levels - 1) + ol
+    auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 16, 32});
+    auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 32, 24});
+    auto brgemm = std::make_shared<snippets::op::Brgemm>(data0, data1);
+    auto maximum = std::make_shared<opset1::Maximum>(brgemm, scalar(-5.f));
+    auto minimum = std::make_shared<opset1::Minimum>(maximum, scalar(5.f));
+    auto input_scale = std::make_shared<opset1::Multiply>(minimum, scalar(25.5f));
+    auto input_shift = std::make_shared<opset1::Subtract>(input_scale, scalar(-127.5f));
+    auto round = std::make_shared<ov::op::v5::Round>(input_shift, ov::op::v5::Round::RoundMode::HALF_TO_EVEN);
+    auto output_scale = std::make_shared<opset1::Multiply>(round, scalar(1.f / 25.5f));
+    auto output_shift = std::make_shared<opset1::Add>(output_scale, scalar(-5.f));
+    auto function = std::make_shared<Function>(NodeVector{output_shift}, ParameterVector{data0, data1});
+
+    const auto fused = fuse_epilogue(function);
+    ASSERT_NE(fused, nullptr);
+    ASSERT_EQ(function->get_ops().size(), 4);
+    ASSERT_FALSE(fused->has_bias());
+    const auto& post_ops = fused->get_post_ops();
+    ASSERT_EQ(post_ops.size(), 6);
+    EXPECT_EQ(post_ops[0].type, PostOpType::Clip);
+    EXPECT_EQ(post_ops[0].alpha, -5.f);
+    EXPECT_EQ(post_ops[0].beta, 5.f);
+    EXPECT_EQ(post_ops[1].type, PostOpType::Linear);
+    EXPECT_EQ(post_ops[2].type, PostOpType::Linear);
+    EXPECT_EQ(post_ops[2].beta, 127.5f);
+    EXPECT_EQ(post_ops[3].type, PostOpType::RoundHalfToEven);
+    EXPECT_EQ(post_ops[4].type, PostOpType::Linear);
+    EXPECT_EQ(post_ops[5].type, PostOpType::Linear);
+    EXPECT_EQ(post_ops[5].beta, -5.f);
+}
+
+TEST(FuseBrgemmEpilogue, NotFusedPerChannelScale) {
+    auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 16, 32});
+    auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 2, 32, 24});
+    auto brgemm = std::make_shared<snippets::op::Brgemm>(data0, data1);
+    auto scale = opset1::Constant::create(element::f32, Shape{1, 1, 1, 24}, std::vector<float>(24, 2.f));
+    auto multiply = std::make_shared<opset1::Multiply>(brgemm, scale);
+    auto function = std::make_shared<Function>(NodeVector{multiply}, ParameterVector{data0, data1});
+
+    ASSERT_EQ(fuse_epilogue(function), nullptr);
+    ASSERT_FALSE(brgemm->has_epilogue());
+}
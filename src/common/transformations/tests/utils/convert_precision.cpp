@@ -1212,6 +1212,60 @@ TEST(TransformationTests, ConvertPrecision_ConstantConversion_U32ToI32) {
     constant_convert_test(element::Type_t::u32, element::Type_t::i32, 42, 42);
 }
 
+TEST(TransformationTests, ConvertPrecision_ConstantConversion_F32ToF16Clamp) {
+    // the size covers the vector loop and a non-vector tail
+    const size_t size = 100003;
+    std::vector<float> values(size), expected(size);
+    for (size_t i = 0; i < size; ++i) {
+        switch (i % 3) {
+        case 0:
+            values[i] = 100000.f;
+            expected[i] = 65504.f;
+            break;
+        case 1:
+            values[i] = -100000.f;
+            expected[i] = -65504.f;
+            break;
+        default:
+            values[i] = static_cast<float>(i % 1024) * 0.5f;
+            expected[i] = values[i];
+        }
+    }
+    constant_convert_test<float, float>(element::f32, element::f16, values, expected);
+}
+
+TEST(TransformationTests, ConvertPrecision_ConstantConversion_F32ToBF16) {
+    const size_t size = 1003;
+    std::vector<float> values(size), expected(size);
+    for (size_t i = 0; i < size; ++i) {
+        values[i] = (static_cast<float>(i) - 500.f) * 1.001f;
+        expected[i] = static_cast<float>(bfloat16(values[i]));
+    }
+    constant_convert_test<float, float>(element::f32, element::bf16, values, expected);
+}
+
+TEST(TransformationTests, ConvertPrecision_ConstantConversion_I64ToI32Clamp) {
+    const size_t size = 1003;
+    std::vector<int64_t> values(size);
+    std::vector<int32_t> expected(size);
+    for (size_t i = 0; i < size; ++i) {
+        switch (i % 3) {
+        case 0:
+            values[i] = std::numeric_limits<int64_t>::max() - static_cast<int64_t>(i);
+            expected[i] = std::numeric_limits<int32_t>::max();
+            break;
+        case 1:
+            values[i] = std::numeric_limits<int64_t>::min() + static_cast<int64_t>(i);
+            expected[i] = std::numeric_limits<int32_t>::min();
+            break;
+        default:
+            values[i] = static_cast<int64_t>(i) - 500;
+            expected[i] = static_cast<int32_t>(values[i]);
+        }
+    }
+    constant_convert_test<int64_t, int32_t>(element::i64, element::i32, values, expected);
+}
+
 TEST(TransformationTests, ConvertPrecision_ConstantConversion_BoolToU8) {
     constant_convert_test(element::Type_t::boolean, element::Type_t::u8, true, 1);
     constant_convert_test(element::Type_t::boolean, element::Type_t::u8, false, 0);
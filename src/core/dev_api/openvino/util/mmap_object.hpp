@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @brief Read-only memory of a file mapped to the process address space.
+ * The mapping is released together with the object.
+ */
+class OPENVINO_API MappedMemory {
+public:
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+    virtual ~MappedMemory() = default;
+};
+
+/**
+ * @brief Maps the whole file to memory. Pages are loaded lazily on the first access.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, ov::Exception is thrown if the file can not be mapped
+ */
+OPENVINO_API std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file with the wide char name to memory. Pages are loaded lazily on the first access.
+ * @param path Path to the file
+ * @return Reference to the mapped memory, ov::Exception is thrown if the file can not be mapped
+ */
+OPENVINO_API std::shared_ptr<ov::MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace ov
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -115,6 +116,15 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
 
 #endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
 
+// Converts f32 to f16 saturating values out of the f16 range to its max/lowest values (NaN is preserved).
+void convert_from_f32_to_f16_with_clamp(const float* arg, float16* out, size_t count);
+
+// Converts f32 to bf16 with the same rounding as bfloat16(float).
+void convert_from_f32_to_bf16(const float* arg, bfloat16* out, size_t count);
+
+// Converts i64 to i32 saturating values out of the i32 range to its max/lowest values.
+void convert_from_i64_to_i32_with_clamp(const int64_t* arg, int32_t* out, size_t count);
+
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
@@ -4,14 +4,46 @@
 
 #include "ngraph/runtime/reference/convert.hpp"
 
-#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+#include <algorithm>
+#include <limits>
 
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include "jit_generator.hpp"
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
 namespace {
+void convert_from_f32_to_f16_with_clamp_ref(const float* arg, float16* out, size_t count) {
+    const float f16_max = static_cast<float>(std::numeric_limits<float16>::max());
+    const float f16_lowest = static_cast<float>(std::numeric_limits<float16>::lowest());
+    for (size_t i = 0; i < count; ++i) {
+        if (arg[i] > f16_max) {
+            out[i] = f16_max;
+        } else if (arg[i] < f16_lowest) {
+            out[i] = f16_lowest;
+        } else {
+            out[i] = static_cast<float16>(arg[i]);
+        }
+    }
+}
+
+void convert_from_f32_to_bf16_ref(const float* arg, bfloat16* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<bfloat16>(arg[i]);
+    }
+}
+
+void convert_from_i64_to_i32_with_clamp_ref(const int64_t* arg, int32_t* out, size_t count) {
+    const int64_t i32_max = std::numeric_limits<int32_t>::max();
+    const int64_t i32_lowest = std::numeric_limits<int32_t>::lowest();
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<int32_t>(std::min(std::max(arg[i], i32_lowest), i32_max));
+    }
+}
+
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 template <typename src_t, typename dst_t>
 void jit_convert_vec(jit::Generator&, const Xbyak::RegExp&, const Xbyak::RegExp&);
 
@@ -99,6 +131,98 @@ void jit_convert_vec<float16, int8_t>(jit::Generator& gen, const Xbyak::RegExp&
     gen.movq(gen.qword[dst], p32vec_lo);        // save the result
 }
 
+void jit_convert_vec_prepare_f32_to_f16_with_clamp(jit::Generator& gen) {
+    auto upper_bound = gen.ymm5;
+    auto lower_bound = gen.ymm6;
+    auto addr = gen.r15;
+
+    static const float bounds[2] = {static_cast<float>(std::numeric_limits<float16>::max()),
+                                    static_cast<float>(std::numeric_limits<float16>::lowest())};
+
+    gen.mov(addr, (size_t)bounds);                  // get bounds[] address
+    gen.vbroadcastss(upper_bound, gen.dword[addr]);  // save f16 max to ymm register
+    gen.vbroadcastss(lower_bound, gen.dword[addr + sizeof(float)]);  // save f16 lowest to ymm register
+}
+
+void jit_convert_vec_f32_to_f16_with_clamp(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto upper_bound = gen.ymm5;
+    auto lower_bound = gen.ymm6;
+    auto f16vec = gen.xmm3;
+    auto f32vec = gen.ymm4;
+
+    gen.vmovups(f32vec, gen.yword[src]);
+    // NaN is taken from the second operand, so NaN inputs are propagated as is
+    gen.vminps(f32vec, upper_bound, f32vec);
+    gen.vmaxps(f32vec, lower_bound, f32vec);
+    gen.vcvtps2ph(f16vec, f32vec, 0);
+    gen.vmovdqu(gen.xword[dst], f16vec);
+}
+
+void jit_convert_vec_prepare_f32_to_bf16(jit::Generator& gen) {
+    auto lsb_mask = gen.ymm1;
+    auto addr = gen.r15;
+
+    static const uint32_t mask = 0x00010000;
+
+    gen.mov(addr, (size_t)&mask);                 // get mask address
+    gen.vpbroadcastd(lsb_mask, gen.dword[addr]);  // save the mask of the bf16 lsb to ymm register
+}
+
+// Rounds like ov::bfloat16(float) does, so the result matches the scalar conversion bit to bit.
+// vcvtneps2bf16 (AVX512-BF16) isn't used: it quiets NaN and rounds the ties differently.
+void jit_convert_vec_f32_to_bf16(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto lsb_mask = gen.ymm1;
+    auto rounding = gen.ymm2;
+    auto bf16vec_hi = gen.xmm3;
+    auto f32vec = gen.ymm4;
+    auto bf16vec_lo = gen.xmm4;
+
+    gen.vmovdqu(f32vec, gen.yword[src]);
+    gen.vpand(rounding, f32vec, lsb_mask);
+    gen.vpsrld(rounding, rounding, 1);
+    gen.vpaddd(f32vec, f32vec, rounding);
+    gen.vpsrld(f32vec, f32vec, 16);
+    gen.vextracti128(bf16vec_hi, f32vec, 1);
+    gen.vpackusdw(bf16vec_lo, bf16vec_lo, bf16vec_hi);  // the values are 16 bit, so no saturation happens
+    gen.vmovdqu(gen.xword[dst], bf16vec_lo);
+}
+
+void jit_convert_vec_prepare_i64_to_i32_with_clamp(jit::Generator& gen) {
+    auto order = gen.ymm1;
+    auto upper_bound = gen.ymm5;
+    auto lower_bound = gen.ymm6;
+    auto addr = gen.r15;
+
+    static const int64_t bounds[2] = {std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::lowest()};
+    static const int32_t offsets[8] = {0, 2, 4, 6, 1, 3, 5, 7};
+
+    gen.mov(addr, (size_t)bounds);                                     // get bounds[] address
+    gen.vpbroadcastq(upper_bound, gen.qword[addr]);                    // save i32 max to ymm register
+    gen.vpbroadcastq(lower_bound, gen.qword[addr + sizeof(int64_t)]);  // save i32 lowest to ymm register
+    gen.mov(addr, (size_t)offsets);                                    // get offsets[] address
+    gen.vmovdqu(order, gen.yword[addr]);                               // save offsets[] to ymm register
+}
+
+void jit_convert_vec_i64_to_i32_with_clamp(jit::Generator& gen, const Xbyak::RegExp& src, const Xbyak::RegExp& dst) {
+    auto order = gen.ymm1;
+    auto mask = gen.ymm2;
+    auto i64vec = gen.ymm4;
+    auto i32vec = gen.xmm4;
+    auto upper_bound = gen.ymm5;
+    auto lower_bound = gen.ymm6;
+
+    // 8 values are processed by two halves of 4 values
+    for (size_t half = 0; half < 2; half++) {
+        gen.vmovdqu(i64vec, gen.yword[src + half * 4 * sizeof(int64_t)]);
+        gen.vpcmpgtq(mask, i64vec, upper_bound);
+        gen.vblendvpd(i64vec, i64vec, upper_bound, mask);
+        gen.vpcmpgtq(mask, lower_bound, i64vec);
+        gen.vblendvpd(i64vec, i64vec, lower_bound, mask);
+        gen.vpermd(i64vec, order, i64vec);  // gather the low dwords in the low half
+        gen.vmovdqu(gen.xword[dst + half * 4 * sizeof(int32_t)], i32vec);
+    }
+}
+
 class jit_convert_array : public jit::Generator {
     typedef struct context {
         struct {
@@ -146,12 +270,14 @@ class jit_convert_array : public jit::Generator {
         test(reg_sz, reg_sz);
         jz(exit);
 
-        // allocate array for 8 floats on stack
-        sub(rsp, vlen * sizeof(float));
+        // allocate array for 8 elements of the widest type on stack
+        const uint32_t tail_size = vlen * static_cast<uint32_t>(std::max(ctx.src.type_size, ctx.dst.type_size));
+        sub(rsp, tail_size);
         mov(r8, rsp);
 
         vpxor(ymm4, ymm4, ymm4);
-        vmovups(yword[r8], ymm4);
+        for (uint32_t offset = 0; offset < tail_size; offset += 32)
+            vmovups(yword[r8 + offset], ymm4);
 
         // Tail conversion
         (this->*ctx.src.copy)(r8, reg_src, reg_sz);
@@ -159,7 +285,7 @@ class jit_convert_array : public jit::Generator {
         (this->*ctx.dst.copy)(reg_dst, r8, reg_sz);
 
         // Free the array on stack
-        add(rsp, vlen * sizeof(float));
+        add(rsp, tail_size);
 
         L(exit);
 
@@ -189,6 +315,48 @@ public:
         }
         return nullptr;
     }
+
+    static fn_t get_f32_to_bf16() {
+        if (is_x64() && mayiuse(avx) && mayiuse(avx2)) {
+            static const jit_convert_array::context_t context{{sizeof(float), &jit::Generator::copy<float>},
+                                                              {sizeof(bfloat16), &jit::Generator::copy<bfloat16>},
+                                                              jit_convert_vec_f32_to_bf16,
+                                                              jit_convert_vec_prepare_f32_to_bf16};
+
+            static jit_convert_array generator(context);
+
+            return (fn_t)generator.getCode();
+        }
+        return nullptr;
+    }
+
+    static fn_t get_i64_to_i32_with_clamp() {
+        if (is_x64() && mayiuse(avx) && mayiuse(avx2)) {
+            static const jit_convert_array::context_t context{{sizeof(int64_t), &jit::Generator::copy<int64_t>},
+                                                              {sizeof(int32_t), &jit::Generator::copy<int32_t>},
+                                                              jit_convert_vec_i64_to_i32_with_clamp,
+                                                              jit_convert_vec_prepare_i64_to_i32_with_clamp};
+
+            static jit_convert_array generator(context);
+
+            return (fn_t)generator.getCode();
+        }
+        return nullptr;
+    }
+
+    static fn_t get_f32_to_f16_with_clamp() {
+        if (is_x64() && mayiuse(avx) && mayiuse(avx2) && mayiuse(fp16)) {
+            static const jit_convert_array::context_t context{{sizeof(float), &jit::Generator::copy<float>},
+                                                              {sizeof(float16), &jit::Generator::copy<float16>},
+                                                              jit_convert_vec_f32_to_f16_with_clamp,
+                                                              jit_convert_vec_prepare_f32_to_f16_with_clamp};
+
+            static jit_convert_array generator(context);
+
+            return (fn_t)generator.getCode();
+        }
+        return nullptr;
+    }
 };
 
 template <typename TI, typename TO>
@@ -204,8 +372,11 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
         }
     }
 }
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
 }  // namespace
 
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+
 template <>
 void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count) {
     convert_impl(arg, out, count);
@@ -231,8 +402,41 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count) {
     convert_impl(arg, out, count);
 }
 
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
+
+void convert_from_f32_to_f16_with_clamp(const float* arg, float16* out, size_t count) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+    if (auto converter = jit_convert_array::get_f32_to_f16_with_clamp()) {
+        jit_convert_array::args_t args = {arg, out, count};
+        converter(&args);
+        return;
+    }
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
+    convert_from_f32_to_f16_with_clamp_ref(arg, out, count);
+}
+
+void convert_from_f32_to_bf16(const float* arg, bfloat16* out, size_t count) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+    if (auto converter = jit_convert_array::get_f32_to_bf16()) {
+        jit_convert_array::args_t args = {arg, out, count};
+        converter(&args);
+        return;
+    }
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
+    convert_from_f32_to_bf16_ref(arg, out, count);
+}
+
+void convert_from_i64_to_i32_with_clamp(const int64_t* arg, int32_t* out, size_t count) {
+#if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
+    if (auto converter = jit_convert_array::get_i64_to_i32_with_clamp()) {
+        jit_convert_array::args_t args = {arg, out, count};
+        converter(&args);
+        return;
+    }
+#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
+    convert_from_i64_to_i32_with_clamp_ref(arg, out, count);
+}
+
 }  // namespace reference
 }  // namespace runtime
 }  // namespace ngraph
-
-#endif  // OPENVINO_ARCH_X86 || OPENVINO_ARCH_X86_64
@@ -6,6 +6,7 @@
 
 #include <xbyak/xbyak_util.h>
 
+#include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -199,6 +200,38 @@ void Generator::copy<uint32_t>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src,
     pop(rsi);
 }
 
+template <>
+void Generator::copy<uint64_t>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src, const Xbyak::Reg64& size) {
+    push(rsi);
+    push(r15);
+
+    xor_(rsi, rsi);
+
+    foreach (rsi, 1, size, [&, this](const Xbyak::Reg64& idx) {
+        mov(r15, qword[src + idx * sizeof(uint64_t)]);
+        mov(qword[dst + idx * sizeof(uint64_t)], r15);
+    })
+        ;
+
+    pop(r15);
+    pop(rsi);
+}
+
+template <>
+void Generator::copy<int32_t>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src, const Xbyak::Reg64& size) {
+    copy<uint32_t>(dst, src, size);
+}
+
+template <>
+void Generator::copy<int64_t>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src, const Xbyak::Reg64& size) {
+    copy<uint64_t>(dst, src, size);
+}
+
+template <>
+void Generator::copy<bfloat16>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src, const Xbyak::Reg64& size) {
+    copy<uint16_t>(dst, src, size);
+}
+
 template <>
 void Generator::copy<float16>(const Xbyak::Reg64& dst, const Xbyak::Reg64& src, const Xbyak::Reg64& size) {
     copy<uint16_t>(dst, src, size);
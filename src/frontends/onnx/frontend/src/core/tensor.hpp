@@ -108,10 +108,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -236,17 +239,12 @@ private:
                                           std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data()) {
+            return make_ng_constant_from_external_data(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
-        if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -266,6 +264,9 @@ private:
                                           !std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data()) {
+            return make_ng_constant_from_external_data(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         auto data = get_data<T>();
         auto data_size = data.size();
@@ -282,6 +283,37 @@ private:
         return constant;
     }
 
+    // External data is stored in the raw little-endian layout of the element type,
+    // so Constant can point directly into the mapped file instead of copying it.
+    std::shared_ptr<ngraph::op::Constant> make_ng_constant_from_external_data(const element::Type& type) const {
+        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        const auto expected_size = shape_size(m_shape) * type.size();
+        size_t data_size = 0;
+        if (m_mmap_cache) {
+            const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+            auto external_data = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            data_size = external_data->size();
+            if (data_size == expected_size) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+            }
+        } else {
+            auto external_data = load_external_data();
+            data_size = external_data.size();
+            if (data_size == expected_size) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
+            }
+        }
+        if (data_size != expected_size) {
+            throw error::invalid_external_data(
+                "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                "' in the model");
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -339,6 +371,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
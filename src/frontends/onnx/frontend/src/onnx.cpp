@@ -26,7 +26,7 @@ std::shared_ptr<Function> import_onnx_model(std::istream& stream, const std::str
     const auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(onnx_common::parse_from_istream(stream));
     ov::frontend::ExtensionHolder extensions;
     extensions.conversions.push_back(legacy_conversion_extension);
-    return detail::import_onnx_model(model_proto, model_path, std::move(extensions));
+    return detail::import_onnx_model(model_proto, model_path, nullptr, std::move(extensions));
 }
 
 std::shared_ptr<Function> import_onnx_model(const std::string& file_path) {
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <ie_core.hpp>
 #include <ngraph/ngraph.hpp>
+#include <openvino/runtime/core.hpp>
 #include <set>
 #include <streambuf>
 #include <string>
@@ -72,6 +73,29 @@ TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromStringException) {
     }
 }
 
+TEST(ONNX_Reader_Tests, ImportModelWithExternalDataMmap) {
+    const auto path = CommonTestUtils::getModelFromTestModelZoo(
+        std::string(ONNX_TEST_MODELS) + "external_data/external_data_two_tensors_data_in_the_same_file.onnx");
+
+    auto get_constants = [&path](bool enable_mmap) {
+        ov::Core core;
+        core.set_property(ov::enable_mmap(enable_mmap));
+        const auto model = core.read_model(path);
+        std::vector<std::vector<int32_t>> values;
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+                values.push_back(constant->cast_vector<int32_t>());
+            }
+        }
+        return values;
+    };
+
+    // Both initializers point into the same mapped file
+    const auto mapped = get_constants(true);
+    ASSERT_FALSE(mapped.empty());
+    ASSERT_EQ(mapped, get_constants(false));
+}
+
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 TEST(ONNX_Reader_Tests, ImportModelWithExternalDataFromWstringNamedFile) {
     InferenceEngine::Core ie;
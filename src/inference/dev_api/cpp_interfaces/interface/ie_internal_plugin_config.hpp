@@ -110,6 +110,62 @@ DECLARE_CONFIG_VALUE(ENABLE);
 DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
 DECLARE_CONFIG_VALUE(DISABLE);
 
+/**
+ * @brief Defines the placement of the CPU plugin cached weights on the NUMA nodes running the streams
+ *      @param AUTO - replicate the weights fitting the last level cache, interleave the bigger ones
+ *      @param REPLICATE - a copy of the weights per NUMA node (default)
+ *      @param INTERLEAVE - a single copy with the memory pages interleaved over all the NUMA nodes
+ *      @param FIRST_TOUCH - a single copy on the NUMA node of the stream which creates it
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(AUTO);
+DECLARE_CONFIG_VALUE(REPLICATE);
+DECLARE_CONFIG_VALUE(INTERLEAVE);
+DECLARE_CONFIG_VALUE(FIRST_TOUCH);
+
+/**
+ * @brief Read-only metric of the CPU compiled model, reports the placement of the cached weights
+ *        as a std::map<std::string, std::string>: weights key -> comma-separated NUMA<id> or INTERLEAVE
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_PLACEMENT);
+
+/**
+ * @brief Enables the global layout planning of the CPU graph on top of the greedy layout selection (YES/NO).
+ *        It's off by default until its cost model is validated on the real workloads.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_PLANNER);
+
+/**
+ * @brief Read-only metric of the CPU compiled model, reports the estimated number of the reorders eliminated
+ *        by the global layout planning comparing to the greedy layout selection, as an int
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SAVED_REORDERS);
+
+/**
+ * @brief Enables the radix select TopK implementation for the large axes and top_k (YES/NO, YES by default).
+ *        Disabling it brings back the sorting algorithms, e.g. to compare the performance.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_TOPK_RADIX_SELECT);
+
+/**
+ * @brief Minimal share of zeros in the FP32 FullyConnected weights to run the sparse FP32 kernel, a float in the
+ *        range [0.0f, 1.0f] (1.0f by default, which disables the kernel).
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SPARSE_FP32_KERNEL_RATE);
+
+/**
+ * @brief Read-only metric of the CPU compiled model, reports how many times the Snippet nodes of all the streams
+ *        took a generated kernel from the kernel caches instead of generating it, as an int
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SNIPPETS_KERNEL_CACHE_HITS);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -46,6 +46,8 @@ public:
 
     int get_numa_node_id() override;
 
+    int get_stream_core_type() override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -166,6 +166,15 @@ public:
      */
     virtual int get_numa_node_id() = 0;
 
+    /**
+     * @brief Return the core type of current stream
+     * @return The column of the processor type table (MAIN_CORE_PROC, EFFICIENT_CORE_PROC, ...) the stream runs on,
+     *         or ALL_PROC if the streams aren't bound to the core types
+     */
+    virtual int get_stream_core_type() {
+        return ALL_PROC;
+    }
+
     /**
      * @brief Execute the task in the current thread using streams executor configuration and constraints
      * @param task A task to start
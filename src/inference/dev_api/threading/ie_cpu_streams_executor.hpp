@@ -48,6 +48,8 @@ public:
 
     int GetNumaNodeId() override;
 
+    int get_stream_core_type() override;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -0,0 +1,42 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for the properties of the HETERO device
+ *        To use in set_property, compile_model, import_model, get_property methods
+ *
+ * @file openvino/runtime/hetero/properties.hpp
+ */
+#pragma once
+
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+/**
+ * @defgroup ov_runtime_hetero_prop_cpp_api HETERO specific properties
+ * @ingroup ov_runtime_cpp_api
+ * Set of HETERO specific properties.
+ */
+
+/**
+ * @brief Namespace with HETERO specific properties
+ */
+namespace hetero {
+
+/**
+ * @brief The number of infer requests of each subgraph, which are shared by all the infer requests of the compiled
+ * model. The stages of consecutive infer requests are executed in parallel on different devices and the tensors
+ * between the subgraphs in host memory are passed without copying. 0 (default) disables the pipelined mode, which is
+ * not used for the models with dynamic shapes or states.
+ * @ingroup ov_runtime_hetero_prop_cpp_api
+ *
+ * @code
+ * core.compile_model(model, "HETERO:GPU,CPU", ov::hetero::pipeline_requests(2));
+ * @endcode
+ */
+static constexpr Property<uint32_t> pipeline_requests{"HETERO_PIPELINE_REQUESTS"};
+
+}  // namespace hetero
+}  // namespace ov
@@ -4,6 +4,7 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -12,6 +13,7 @@
 #include <vector>
 
 #include "dev/threading/parallel_custom_arena.hpp"
+#include "dev/threading/streams_dispatcher.hpp"
 #include "dev/threading/thread_affinity.hpp"
 #include "openvino/itt.hpp"
 #include "openvino/runtime/system_conf.hpp"
@@ -324,6 +326,7 @@ struct CPUStreamsExecutor::Impl {
             _usedNumaNodes = numaNodes;
         }
         _config._streams = _config._streams == 0 ? 1 : _config._streams;
+        _dispatcher = StreamsDispatcher{_config._streams};
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
         if (!is_cpu_map_available() && ThreadBindingType::HYBRID_AWARE == config._threadBindingType) {
             const auto core_types = custom::info::core_types();
@@ -357,32 +360,77 @@ struct CPUStreamsExecutor::Impl {
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                auto& stream = *(_streams.local());
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _dispatcher.set_core_type(streamId, get_stream_core_type(stream._streamId));
+                    _hybridDispatch = _dispatcher.is_hybrid();
+                }
                 for (bool stopped = false; !stopped;) {
                     Task task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
+                        // on the hybrid CPU the tasks are left to the idle streams running on the faster cores
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            if (_hybridDispatch ? _dispatcher.can_take(streamId, _taskQueue.size())
+                                                : !_taskQueue.empty()) {
+                                return true;
+                            }
+                            // the queue is drained before stopping, the tasks this stream can't take are left
+                            // to the other streams
+                            return (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
+                        if (stopped) {
+                            // the stopped stream is not idle anymore, so the slower streams take the rest of the tasks
+                            if (_hybridDispatch) {
+                                _dispatcher.on_stream_stop(streamId);
+                                _queueCondVar.notify_all();
+                            }
+                        } else if (!_taskQueue.empty()) {
                             task = std::move(_taskQueue.front());
                             _taskQueue.pop();
+                            _dispatcher.on_task_start(streamId);
+                            // the slower idle streams may take the rest of the tasks now
+                            if (_hybridDispatch && !_taskQueue.empty()) {
+                                _queueCondVar.notify_all();
+                            }
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        const auto start = std::chrono::steady_clock::now();
+                        Execute(task, stream);
+                        const auto duration =
+                            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _dispatcher.on_task_end(streamId, duration);
                     }
                 }
             });
         }
     }
 
+    // The core type (the column of the processor type table) of the stream according to the streams info table
+    int get_stream_core_type(int streamId) const {
+        if (!is_cpu_map_available() || _config._streams_info_table.empty() || _config._stream_ids.empty()) {
+            return ALL_PROC;
+        }
+        const auto stream_id = std::min(streamId, static_cast<int>(_config._stream_ids.size()) - 1);
+        return _config._streams_info_table[_config._stream_ids[stream_id]][PROC_TYPE];
+    }
+
     void Enqueue(Task task) {
+        bool hybridDispatch = false;
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            hybridDispatch = _hybridDispatch;
+        }
+        // the task has to be taken by the specific stream, so all the idle streams check the queue
+        if (hybridDispatch) {
+            _queueCondVar.notify_all();
+        } else {
+            _queueCondVar.notify_one();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -425,6 +473,9 @@ struct CPUStreamsExecutor::Impl {
     std::queue<Task> _taskQueue;
     bool _isStopped = false;
     std::vector<int> _usedNumaNodes;
+    // distributes the queued tasks between the worker streams according to the core types, guarded by _mutex
+    StreamsDispatcher _dispatcher{0};
+    bool _hybridDispatch = false;
     ov::threading::ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
     // stream id mapping to the core type
@@ -448,6 +499,11 @@ int CPUStreamsExecutor::get_numa_node_id() {
     return stream->_numaNodeId;
 }
 
+int CPUStreamsExecutor::get_stream_core_type() {
+    auto stream = _impl->_streams.local();
+    return _impl->get_stream_core_type(stream->_streamId);
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const ov::threading::IStreamsExecutor::Config& config)
     : _impl{new Impl{config}} {}
 
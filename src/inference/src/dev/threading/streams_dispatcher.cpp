@@ -0,0 +1,100 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dev/threading/streams_dispatcher.hpp"
+
+#include <algorithm>
+
+#include "openvino/runtime/system_conf.hpp"
+
+namespace ov {
+namespace threading {
+
+namespace {
+// The weight of the last task in the moving average of the task execution time
+constexpr double task_time_weight = 0.125;
+
+// Expected order of the core types by the performance, it's used until the execution time of each core type is known
+int get_core_type_rank(int core_type) {
+    switch (core_type) {
+    case MAIN_CORE_PROC:
+        return 0;
+    case HYPER_THREADING_PROC:
+        return 1;
+    case EFFICIENT_CORE_PROC:
+        return 2;
+    default:
+        return 0;
+    }
+}
+}  // namespace
+
+StreamsDispatcher::StreamsDispatcher(int streams)
+    : _core_types(std::max(streams, 0), ALL_PROC),
+      _idle(std::max(streams, 0), true) {}
+
+void StreamsDispatcher::set_core_type(int stream, int core_type) {
+    _core_types.at(stream) = core_type;
+}
+
+bool StreamsDispatcher::is_hybrid() const {
+    return std::any_of(_core_types.begin(), _core_types.end(), [&](int core_type) {
+        return core_type != _core_types.front();
+    });
+}
+
+bool StreamsDispatcher::is_faster(int lhs, int rhs) const {
+    const auto lhs_type = _core_types[lhs];
+    const auto rhs_type = _core_types[rhs];
+    if (lhs_type != rhs_type) {
+        const auto lhs_time = get_task_time(lhs_type);
+        const auto rhs_time = get_task_time(rhs_type);
+        if (lhs_time > 0 && rhs_time > 0 && lhs_time != rhs_time) {
+            return lhs_time < rhs_time;
+        }
+        const auto lhs_rank = get_core_type_rank(lhs_type);
+        const auto rhs_rank = get_core_type_rank(rhs_type);
+        if (lhs_rank != rhs_rank) {
+            return lhs_rank < rhs_rank;
+        }
+    }
+    // the streams with the same performance take the tasks in the order of the indices
+    return lhs < rhs;
+}
+
+bool StreamsDispatcher::can_take(int stream, size_t queued_tasks) const {
+    if (queued_tasks == 0) {
+        return false;
+    }
+    // the queued tasks are taken by the fastest idle streams, one task per stream
+    size_t faster_idle_streams = 0;
+    for (int other = 0; other < static_cast<int>(_idle.size()); other++) {
+        if (other != stream && _idle[other] && is_faster(other, stream)) {
+            faster_idle_streams++;
+        }
+    }
+    return faster_idle_streams < queued_tasks;
+}
+
+void StreamsDispatcher::on_task_start(int stream) {
+    _idle.at(stream) = false;
+}
+
+void StreamsDispatcher::on_task_end(int stream, double duration) {
+    _idle.at(stream) = true;
+    auto& task_time = _task_time[_core_types[stream]];
+    task_time = task_time == 0 ? duration : task_time + task_time_weight * (duration - task_time);
+}
+
+void StreamsDispatcher::on_stream_stop(int stream) {
+    _idle.at(stream) = false;
+}
+
+double StreamsDispatcher::get_task_time(int core_type) const {
+    const auto found = _task_time.find(core_type);
+    return found == _task_time.end() ? 0 : found->second;
+}
+
+}  // namespace threading
+}  // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace ov {
+namespace threading {
+
+/**
+ * @brief      Dispatches the tasks of the shared queue between the streams running on the different core types
+ *             of the hybrid CPU. The execution time of the tasks is tracked per core type, and the queued tasks
+ *             are taken by the idle streams of the fastest core types first, so the streams on Efficient-cores
+ *             get the tasks only if all the faster streams are busy.
+ *             The dispatcher isn't thread safe, the calls are expected to be guarded by the queue mutex.
+ * @ingroup    ov_dev_api_threading
+ */
+class StreamsDispatcher {
+public:
+    /**
+     * @brief      Constructor
+     * @param[in]  streams  Number of the worker streams
+     */
+    explicit StreamsDispatcher(int streams);
+
+    /**
+     * @brief      Sets the core type of the worker stream
+     * @param[in]  stream  The worker stream index
+     * @param[in]  core_type  The column of the processor type table (MAIN_CORE_PROC, EFFICIENT_CORE_PROC, ...)
+     */
+    void set_core_type(int stream, int core_type);
+
+    /**
+     * @brief      Whether the worker streams run on more than one core type
+     */
+    bool is_hybrid() const;
+
+    /**
+     * @brief      Whether the idle stream takes one of the queued tasks or leaves them to the faster idle streams
+     * @param[in]  stream  The worker stream index
+     * @param[in]  queued_tasks  Number of the tasks in the queue
+     */
+    bool can_take(int stream, size_t queued_tasks) const;
+
+    /**
+     * @brief      Marks the stream busy
+     * @param[in]  stream  The worker stream index
+     */
+    void on_task_start(int stream);
+
+    /**
+     * @brief      Marks the stream idle and updates the average task execution time of its core type
+     * @param[in]  stream  The worker stream index
+     * @param[in]  duration  The task execution time, in microseconds
+     */
+    void on_task_end(int stream, double duration);
+
+    /**
+     * @brief      Marks the stream stopped, the queued tasks are left to the other streams
+     * @param[in]  stream  The worker stream index
+     */
+    void on_stream_stop(int stream);
+
+    /**
+     * @brief      Returns the average task execution time of the core type, or 0 if no task was executed on it
+     * @param[in]  core_type  The column of the processor type table
+     */
+    double get_task_time(int core_type) const;
+
+private:
+    // Whether the stream lhs is expected to execute a task faster than the stream rhs
+    bool is_faster(int lhs, int rhs) const;
+
+    std::vector<int> _core_types;
+    std::vector<bool> _idle;
+    // moving average of the task execution time per core type
+    std::map<int, double> _task_time;
+};
+
+}  // namespace threading
+}  // namespace ov
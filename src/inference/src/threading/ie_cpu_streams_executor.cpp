@@ -41,6 +41,10 @@ int CPUStreamsExecutor::GetNumaNodeId() {
     return _impl->get_numa_node_id();
 }
 
+int CPUStreamsExecutor::get_stream_core_type() {
+    return _impl->get_stream_core_type();
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const Config& config) : _impl{new Impl(config)} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {}
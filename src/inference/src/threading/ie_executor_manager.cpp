@@ -78,6 +78,10 @@ public:
         return m_executor->get_numa_node_id();
     }
 
+    int get_stream_core_type() override {
+        return m_executor->get_stream_core_type();
+    }
+
     void Execute(Task task) override {
         m_executor->execute(task);
     }
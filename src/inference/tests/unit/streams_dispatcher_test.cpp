@@ -0,0 +1,103 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/test_common.hpp>
+
+#include "dev/threading/streams_dispatcher.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+using namespace testing;
+using namespace ov;
+using namespace ov::threading;
+
+namespace {
+
+// the simulated hybrid CPU: 2 streams on Performance-cores, 1 stream on logical Performance-cores, 2 on Efficient-cores
+StreamsDispatcher make_hybrid_dispatcher() {
+    const std::vector<int> core_types = {MAIN_CORE_PROC,
+                                         MAIN_CORE_PROC,
+                                         HYPER_THREADING_PROC,
+                                         EFFICIENT_CORE_PROC,
+                                         EFFICIENT_CORE_PROC};
+    StreamsDispatcher dispatcher(static_cast<int>(core_types.size()));
+    for (size_t i = 0; i < core_types.size(); i++) {
+        dispatcher.set_core_type(static_cast<int>(i), core_types[i]);
+    }
+    return dispatcher;
+}
+
+TEST(StreamsDispatcherTests, SingleCoreType) {
+    StreamsDispatcher dispatcher(3);
+    for (int i = 0; i < 3; i++) {
+        dispatcher.set_core_type(i, MAIN_CORE_PROC);
+    }
+    EXPECT_FALSE(dispatcher.is_hybrid());
+    EXPECT_FALSE(dispatcher.can_take(0, 0));
+    EXPECT_TRUE(dispatcher.can_take(0, 1));
+    EXPECT_FALSE(dispatcher.can_take(2, 1));
+    EXPECT_TRUE(dispatcher.can_take(2, 3));
+}
+
+TEST(StreamsDispatcherTests, FasterCoresFirst) {
+    auto dispatcher = make_hybrid_dispatcher();
+    EXPECT_TRUE(dispatcher.is_hybrid());
+    // a single task is taken by the first stream on Performance-cores
+    EXPECT_TRUE(dispatcher.can_take(0, 1));
+    EXPECT_FALSE(dispatcher.can_take(1, 1));
+    EXPECT_FALSE(dispatcher.can_take(3, 1));
+    // Efficient-cores take the tasks only if there are more tasks than the idle faster streams
+    EXPECT_FALSE(dispatcher.can_take(3, 3));
+    EXPECT_TRUE(dispatcher.can_take(3, 4));
+    EXPECT_FALSE(dispatcher.can_take(4, 4));
+
+    // the busy streams don't take the tasks from the slower ones
+    dispatcher.on_task_start(0);
+    dispatcher.on_task_start(1);
+    EXPECT_TRUE(dispatcher.can_take(2, 1));
+    EXPECT_FALSE(dispatcher.can_take(3, 1));
+    dispatcher.on_task_start(2);
+    EXPECT_TRUE(dispatcher.can_take(3, 1));
+    EXPECT_FALSE(dispatcher.can_take(4, 1));
+}
+
+TEST(StreamsDispatcherTests, StoppedStreams) {
+    auto dispatcher = make_hybrid_dispatcher();
+    EXPECT_FALSE(dispatcher.can_take(3, 1));
+    // the stopped faster streams don't keep the queued tasks from the slower ones
+    dispatcher.on_stream_stop(0);
+    dispatcher.on_stream_stop(1);
+    dispatcher.on_stream_stop(2);
+    EXPECT_TRUE(dispatcher.can_take(3, 1));
+    EXPECT_FALSE(dispatcher.can_take(4, 1));
+}
+
+TEST(StreamsDispatcherTests, MeasuredTaskTime) {
+    auto dispatcher = make_hybrid_dispatcher();
+    EXPECT_EQ(dispatcher.get_task_time(MAIN_CORE_PROC), 0);
+
+    dispatcher.on_task_start(0);
+    dispatcher.on_task_end(0, 100.0);
+    dispatcher.on_task_start(3);
+    dispatcher.on_task_end(3, 300.0);
+    EXPECT_EQ(dispatcher.get_task_time(MAIN_CORE_PROC), 100.0);
+    EXPECT_EQ(dispatcher.get_task_time(EFFICIENT_CORE_PROC), 300.0);
+    // the stream on logical cores has no measurement yet, the expected order is used for it
+    EXPECT_TRUE(dispatcher.can_take(0, 1));
+    EXPECT_FALSE(dispatcher.can_take(2, 2));
+
+    // the Efficient-cores turn out to be faster than the Performance-cores for this workload
+    for (int i = 0; i < 32; i++) {
+        dispatcher.on_task_start(0);
+        dispatcher.on_task_end(0, 1000.0);
+        dispatcher.on_task_start(2);
+        dispatcher.on_task_end(2, 1200.0);
+    }
+    EXPECT_GT(dispatcher.get_task_time(MAIN_CORE_PROC), dispatcher.get_task_time(EFFICIENT_CORE_PROC));
+    EXPECT_TRUE(dispatcher.can_take(3, 1));
+    EXPECT_FALSE(dispatcher.can_take(0, 1));
+}
+
+}  // namespace
@@ -16,6 +16,37 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    if (_heteroInferRequest->isPipelined()) {
+        // the stages acquire the sub-requests from the pools shared by all the requests of the network
+        for (std::size_t stage = 0; stage < _heteroInferRequest->numStages(); ++stage) {
+            struct StageExecutor : ITaskExecutor {
+                StageExecutor(HeteroInferRequest& inferRequest, std::size_t stage)
+                    : _inferRequest(inferRequest),
+                      _stage(stage) {}
+                void run(Task task) override {
+                    _task = std::move(task);
+                    _inferRequest.StartStage(_stage, [this](std::exception_ptr exceptionPtr) mutable {
+                        _exceptionPtr = exceptionPtr;
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    });
+                };
+                HeteroInferRequest& _inferRequest;
+                std::size_t _stage;
+                std::exception_ptr _exceptionPtr;
+                Task _task;
+            };
+
+            auto stageExecutor = std::make_shared<StageExecutor>(*_heteroInferRequest, stage);
+            _pipeline.emplace_back(stageExecutor, [stageExecutor] {
+                if (nullptr != stageExecutor->_exceptionPtr) {
+                    std::rethrow_exception(stageExecutor->_exceptionPtr);
+                }
+            });
+        }
+        _syncPipeline = _pipeline;
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
@@ -49,6 +80,7 @@ StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     try {
         waitStatus = AsyncInferRequestThreadSafeDefault::Wait(millis_timeout);
     } catch (const InferenceEngine::Exception&) {
+        // the sub-requests of the pipelined mode are released only when they are completed
         for (auto&& requestDesc : _heteroInferRequest->_inferRequests) {
             requestDesc._request->Wait(InferRequest::RESULT_READY);
         }
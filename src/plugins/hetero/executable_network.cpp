@@ -32,6 +32,8 @@
 
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/hetero/properties.hpp"
+#include "internal_properties.hpp"
 #include "ie_ngraph_utils.hpp"
 #include "ie_plugin_config.hpp"
 #include "ie_algorithm.hpp"
@@ -752,11 +754,96 @@ void HeteroExecutableNetwork::Export(std::ostream& heteroModel) {
     }
 }
 
+HeteroPipeline::Ptr HeteroExecutableNetwork::GetPipeline() {
+    auto itPipelineRequests = _hetero_config.find(ov::hetero::pipeline_requests.name());
+    const size_t pipelineRequests =
+        itPipelineRequests != _hetero_config.end() ? ParsePipelineRequests(itPipelineRequests->second) : 0;
+    if (pipelineRequests == 0) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock{_pipelineMutex};
+    if (_pipelineChecked) {
+        return _pipeline;
+    }
+    _pipelineChecked = true;
+
+    // the tensors of the network are allocated by the HETERO request, so their shapes have to be static
+    for (auto&& subnetwork : _networks) {
+        for (auto&& nodes : {subnetwork._network->getInputs(), subnetwork._network->getOutputs()}) {
+            for (auto&& node : nodes) {
+                if (node->get_output_partial_shape(0).is_dynamic()) {
+                    return nullptr;
+                }
+            }
+        }
+    }
+
+    auto pipeline = std::make_shared<HeteroPipeline>();
+    auto itPerfCount = _device_config.find(CONFIG_KEY(PERF_COUNT));
+    pipeline->_perfCount = itPerfCount != _device_config.end() && itPerfCount->second == YES;
+    std::unordered_map<std::string, size_t> producers;
+    for (size_t id = 0; id < _networks.size(); ++id) {
+        for (auto&& outputInfo : _networks[id]._network->GetOutputsInfo()) {
+            producers[outputInfo.first] = id;
+        }
+    }
+
+    // the sub-request of a stage is released by the last stage which reads its outputs
+    std::vector<size_t> lastConsumers(_networks.size());
+    pipeline->_stages.resize(_networks.size());
+    for (size_t id = 0; id < _networks.size(); ++id) {
+        lastConsumers[id] = id;
+        auto& stage = pipeline->_stages[id];
+        for (auto&& inputInfo : _networks[id]._network->GetInputsInfo()) {
+            const auto& name = inputInfo.first;
+            if (InferenceEngine::details::contains(_networkInputs, name)) {
+                stage._inputs.push_back({name, -1, {}, false});
+                continue;
+            }
+            auto itName = _blobNameMap.find(name);
+            const auto& producerOutput = itName != _blobNameMap.end() ? itName->second : name;
+            auto itProducer = producers.find(producerOutput);
+            if (itProducer == producers.end()) {
+                IE_THROW() << "Internal error: there is no subgraph which computes " << producerOutput;
+            }
+            stage._inputs.push_back({name,
+                                     static_cast<int>(itProducer->second),
+                                     producerOutput,
+                                     InferenceEngine::details::contains(_networkOutputs, producerOutput)});
+            lastConsumers[itProducer->second] = std::max(lastConsumers[itProducer->second], id);
+        }
+        for (auto&& outputInfo : _networks[id]._network->GetOutputsInfo()) {
+            if (InferenceEngine::details::contains(_networkOutputs, outputInfo.first)) {
+                stage._networkOutputs.push_back(outputInfo.first);
+            }
+        }
+    }
+    for (size_t id = 0; id < _networks.size(); ++id) {
+        pipeline->_stages[lastConsumers[id]]._releasedStages.push_back(id);
+    }
+
+    for (auto&& subnetwork : _networks) {
+        auto pool = std::make_shared<HeteroStagePool>(subnetwork._network, pipelineRequests);
+        // the states of the shared sub-requests would be shared by the infer requests
+        if (!pool->at(0)->QueryState().empty()) {
+            return nullptr;
+        }
+        pipeline->_pools.push_back(pool);
+    }
+
+    _pipeline = pipeline;
+    return _pipeline;
+}
+
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     const std::vector<std::shared_ptr<const ov::Node>>& inputs,
     const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
     if (!this->_plugin || !_plugin->IsNewAPI())
         return nullptr;
+    if (auto pipeline = GetPipeline()) {
+        return std::make_shared<HeteroInferRequest>(inputs, outputs, pipeline);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -770,6 +857,9 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                            OutputsDataMap networkOutputs) {
+    if (auto pipeline = GetPipeline()) {
+        return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, pipeline);
+    }
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -793,6 +883,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         auto it = _hetero_config.find(name);
         IE_ASSERT(it != _hetero_config.end());
         result = it->second == YES;
+    } else if (name == ov::hetero::pipeline_requests.name()) {
+        auto it = _hetero_config.find(name);
+        IE_ASSERT(it != _hetero_config.end());
+        result = ParsePipelineRequests(it->second);
     } else if (name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _device_config.find(name);
         IE_ASSERT(it != _device_config.end());
@@ -813,7 +907,20 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
             ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::loaded_from_cache.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::device::properties.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO}};
+            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RO},
+            ov::PropertyName{ov::hetero::pipeline_requests.name(), ov::PropertyMutability::RO}};
+    } else if (ov::hetero::pipeline_max_running_stages == name || ov::hetero::pipeline_shared_tensors == name ||
+               ov::hetero::pipeline_copied_tensors == name) {
+        std::lock_guard<std::mutex> lock{_pipelineMutex};
+        if (!_pipeline) {
+            return decltype(ov::hetero::pipeline_max_running_stages)::value_type{0};
+        }
+        if (ov::hetero::pipeline_max_running_stages == name) {
+            return decltype(ov::hetero::pipeline_max_running_stages)::value_type{_pipeline->_maxRunningStages.load()};
+        } else if (ov::hetero::pipeline_shared_tensors == name) {
+            return decltype(ov::hetero::pipeline_shared_tensors)::value_type{_pipeline->_sharedTensors.load()};
+        }
+        return decltype(ov::hetero::pipeline_copied_tensors)::value_type{_pipeline->_copiedTensors.load()};
     } else if (EXEC_NETWORK_METRIC_KEY(SUPPORTED_METRICS) == name) {
         std::vector<std::string> heteroMetrics = {ov::model_name.name(),
                                                   METRIC_KEY(SUPPORTED_METRICS),
@@ -826,6 +933,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     ov::hetero::pipeline_requests.name(),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, heteroConfigKeys);
     } else if (ov::device::properties == name) {
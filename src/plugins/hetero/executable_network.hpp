@@ -13,6 +13,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -21,6 +22,7 @@
 #include "async_infer_request.hpp"
 #include "ie_icore.hpp"
 #include "infer_request.hpp"
+#include "pipeline.hpp"
 #include "plugin.hpp"
 
 namespace HeteroPlugin {
@@ -56,6 +58,12 @@ public:
     void Export(std::ostream& modelFile) override;
 
 private:
+    /**
+     * @brief Returns the pools of sub-requests shared by the infer requests if the pipelined mode is enabled
+     * and supported by the network, nullptr otherwise
+     */
+    HeteroPipeline::Ptr GetPipeline();
+
     struct NetworkDesc {
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
@@ -69,6 +77,10 @@ private:
     Configs _device_config;
     std::unordered_map<std::string, std::string> _blobNameMap;
     bool _loadedFromCache = false;
+
+    mutable std::mutex _pipelineMutex;
+    HeteroPipeline::Ptr _pipeline;
+    bool _pipelineChecked = false;
 };
 
 }  // namespace HeteroPlugin
@@ -6,9 +6,13 @@
 
 #include <ie_blob.h>
 #include <ie_layouts.h>
+#include <ie_remote_blob.hpp>
 
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
+#include <future>
 #include <ie_algorithm.hpp>
 #include <map>
 #include <string>
@@ -39,6 +43,22 @@ HeteroInferRequest::HeteroInferRequest(
     CreateInferRequest(subgraphInputToOutputBlobNames);
 }
 
+HeteroInferRequest::HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                       const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                       const HeteroPipeline::Ptr& pipeline)
+    : IInferRequestInternal(inputs, outputs),
+      _pipeline(pipeline) {
+    CreatePipelinedRequest();
+}
+
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                       const HeteroPipeline::Ptr& pipeline)
+    : IInferRequestInternal(networkInputs, networkOutputs),
+      _pipeline(pipeline) {
+    CreatePipelinedRequest();
+}
+
 void HeteroInferRequest::CreateInferRequest(
     const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
@@ -85,7 +105,131 @@ void HeteroInferRequest::CreateInferRequest(
     }
 }
 
+void HeteroInferRequest::CreatePipelinedRequest() {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        IE_THROW() << "Internal error: no information about network's output/input";
+    }
+
+    // the request owns the inputs and the outputs of the network, they are bound to the sub-requests acquired
+    // for each inference, while the intermediate tensors are owned by the sub-requests of the producers
+    for (auto&& input : _networkInputs) {
+        auto blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+        _inputs[input.first] = blob;
+    }
+    for (auto&& output : _networkOutputs) {
+        auto blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+        _outputs[output.first] = blob;
+    }
+    _stageRequests.resize(_pipeline->_stages.size(), 0);
+    _acquired.resize(_pipeline->_stages.size(), false);
+    _stagePerfCounts.resize(_pipeline->_stages.size());
+    for (auto&& pool : _pipeline->_pools) {
+        pool->attach();
+    }
+}
+
+HeteroInferRequest::~HeteroInferRequest() {
+    if (isPipelined()) {
+        for (auto&& pool : _pipeline->_pools) {
+            pool->detach();
+        }
+    }
+}
+
+void HeteroInferRequest::BindStage(size_t stage, SoIInferRequestInternal& request) {
+    const auto& desc = _pipeline->_stages[stage];
+    for (auto&& input : desc._inputs) {
+        Blob::Ptr blob;
+        if (input._producer < 0) {
+            blob = _inputs.at(input._name);
+        } else if (input._producedAsNetworkOutput) {
+            blob = _outputs.at(input._producerOutput);
+        } else {
+            auto& producer = _pipeline->_pools[input._producer]->at(_stageRequests[input._producer]);
+            blob = producer->GetBlob(input._producerOutput);
+        }
+
+        // the tensors in host memory are shared by the stages, the others are copied to host
+        if (blob->is<RemoteBlob>()) {
+            auto hostBlob = make_blob_with_precision(blob->getTensorDesc());
+            hostBlob->allocate();
+            blob_copy(blob, hostBlob);
+            blob = hostBlob;
+            ++_pipeline->_copiedTensors;
+        } else if (input._producer >= 0) {
+            ++_pipeline->_sharedTensors;
+        }
+        request->SetBlob(input._name, blob);
+    }
+    for (auto&& output : desc._networkOutputs) {
+        request->SetBlob(output, _outputs.at(output));
+    }
+}
+
+void HeteroInferRequest::ReleaseStage(size_t stage) {
+    if (_acquired[stage]) {
+        _acquired[stage] = false;
+        _pipeline->_pools[stage]->release(_stageRequests[stage]);
+    }
+}
+
+void HeteroInferRequest::StartStage(size_t stage, std::function<void(std::exception_ptr)> callback) {
+    _pipeline->_pools[stage]->acquire([this, stage, callback](size_t id) {
+        _stageRequests[stage] = id;
+        _acquired[stage] = true;
+        auto& request = _pipeline->_pools[stage]->at(id);
+        bool running = false;
+        try {
+            if (stage == 0) {
+                execDataPreprocessing(_inputs);
+            }
+            BindStage(stage, request);
+            request->SetCallback([this, stage, callback](std::exception_ptr exceptionPtr) {
+                --_pipeline->_runningStages;
+                // the sub-requests are released as soon as their outputs are consumed by the following stages,
+                // so their counters are saved before: the sub-request may be reused by another HETERO request
+                // when GetPerformanceCounts is called
+                if (nullptr != exceptionPtr) {
+                    for (size_t i = 0; i < numStages(); ++i) {
+                        ReleaseStage(i);
+                    }
+                } else {
+                    if (_pipeline->_perfCount) {
+                        _stagePerfCounts[stage] =
+                            _pipeline->_pools[stage]->at(_stageRequests[stage])->GetPerformanceCounts();
+                    }
+                    for (auto released : _pipeline->_stages[stage]._releasedStages) {
+                        ReleaseStage(released);
+                    }
+                }
+                callback(exceptionPtr);
+            });
+            const auto runningStages = ++_pipeline->_runningStages;
+            running = true;
+            auto maxRunningStages = _pipeline->_maxRunningStages.load();
+            while (runningStages > maxRunningStages &&
+                   !_pipeline->_maxRunningStages.compare_exchange_weak(maxRunningStages, runningStages)) {
+            }
+            request->StartAsync();
+        } catch (...) {
+            if (running) {
+                --_pipeline->_runningStages;
+            }
+            for (size_t i = 0; i <= stage; ++i) {
+                ReleaseStage(i);
+            }
+            callback(std::current_exception());
+        }
+    });
+}
+
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (isPipelined()) {
+        IInferRequestInternal::SetBlob(name, blob);
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +238,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (isPipelined()) {
+        return IInferRequestInternal::GetBlob(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -103,6 +250,10 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (isPipelined()) {
+        IInferRequestInternal::SetBlob(name, blob, info);
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -111,6 +262,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (isPipelined()) {
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -119,6 +273,21 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (isPipelined()) {
+        for (size_t stage = 0; stage < numStages(); ++stage) {
+            std::promise<void> promise;
+            auto future = promise.get_future();
+            StartStage(stage, [&promise](std::exception_ptr exceptionPtr) {
+                if (nullptr != exceptionPtr) {
+                    promise.set_exception(exceptionPtr);
+                } else {
+                    promise.set_value();
+                }
+            });
+            future.get();
+        }
+        return;
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -128,6 +297,7 @@ void HeteroInferRequest::InferImpl() {
 }
 
 std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInferRequest::QueryState() {
+    // the pipelined mode is used for the networks without states only
     memoryStates = {};
     for (auto&& desc : _inferRequests) {
         auto& r = desc._request;
@@ -141,6 +311,15 @@ std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInfe
 
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
+    if (isPipelined()) {
+        // the counters of the sub-requests used by the last inference, which were saved when the stages completed
+        for (size_t i = 0; i < numStages(); i++) {
+            for (auto&& r : _stagePerfCounts[i]) {
+                perfMap[std::string("subgraph") + std::to_string(i) + ": " + r.first] = r.second;
+            }
+        }
+        return perfMap;
+    }
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
         for (auto&& r : perfMapRequest) {
@@ -15,6 +15,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "pipeline.hpp"
+
 namespace HeteroPlugin {
 
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
@@ -38,6 +40,20 @@ public:
                        const SubRequestsList& inferRequests,
                        const std::unordered_map<std::string, std::string>& blobNameMap);
 
+    /**
+     * @brief Creates the request of the pipelined mode: the sub-requests are acquired from the pools of the stages
+     * for each inference, so the stages of consecutive requests overlap
+     */
+    HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                       InferenceEngine::OutputsDataMap networkOutputs,
+                       const HeteroPipeline::Ptr& pipeline);
+
+    HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
+                       const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
+                       const HeteroPipeline::Ptr& pipeline);
+
+    ~HeteroInferRequest();
+
     void InferImpl() override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) override;
@@ -54,13 +70,35 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    bool isPipelined() const {
+        return _pipeline != nullptr;
+    }
+    size_t numStages() const {
+        return _pipeline->_stages.size();
+    }
+    /**
+     * @brief Runs the subgraph of the stage on a sub-request acquired from the pool, the callback is called
+     * on completion or error
+     */
+    void StartStage(size_t stage, std::function<void(std::exception_ptr)> callback);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::SoIInferRequestInternal> _subRequestFromBlobName;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void CreatePipelinedRequest();
+    void BindStage(size_t stage, InferenceEngine::SoIInferRequestInternal& request);
+    void ReleaseStage(size_t stage);
+
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+
+    HeteroPipeline::Ptr _pipeline;
+    // ids of the sub-requests acquired from the pools of the stages by the current inference
+    std::vector<size_t> _stageRequests;
+    std::vector<bool> _acquired;
+    std::vector<std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>> _stagePerfCounts;
 };
 
 }  // namespace HeteroPlugin
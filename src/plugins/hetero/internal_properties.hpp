@@ -13,5 +13,15 @@ namespace hetero {
  */
 static constexpr Property<std::string, PropertyMutability::RO> caching_device_properties{"CACHING_DEVICE_PROPERTIES"};
 
+/**
+ * @brief Read-only properties of the compiled model with the statistics of the pipelined mode: the maximal number
+ * of the sub-requests which were running at once, and the number of the tensors between the subgraphs which were
+ * passed to the consumers without copying or were copied to host memory
+ */
+static constexpr Property<uint32_t, PropertyMutability::RO> pipeline_max_running_stages{
+    "HETERO_PIPELINE_MAX_RUNNING_STAGES"};
+static constexpr Property<uint32_t, PropertyMutability::RO> pipeline_shared_tensors{"HETERO_PIPELINE_SHARED_TENSORS"};
+static constexpr Property<uint32_t, PropertyMutability::RO> pipeline_copied_tensors{"HETERO_PIPELINE_COPIED_TENSORS"};
+
 }  // namespace hetero
 }  // namespace ov
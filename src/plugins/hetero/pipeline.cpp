@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "pipeline.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/hetero/properties.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+HeteroStagePool::HeteroStagePool(const SoExecutableNetworkInternal& network, size_t size) {
+    for (size_t id = 0; id < size; ++id) {
+        SoIInferRequestInternal request = {network->CreateInferRequest(), network._so};
+        request->setModelInputsOutputs(network->getInputs(), network->getOutputs());
+        _requests.emplace_back(std::move(request));
+        _free.push_back(size - 1 - id);
+    }
+}
+
+void HeteroStagePool::acquire(Task task) {
+    size_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_free.empty()) {
+            if (_waiting.size() >= _attached) {
+                OPENVINO_THROW("Internal error: ", _waiting.size(), " requests are already waiting for the ",
+                               _attached, " HETERO infer requests of the stage");
+            }
+            _waiting.emplace_back(std::move(task));
+            return;
+        }
+        id = _free.back();
+        _free.pop_back();
+    }
+    task(id);
+}
+
+void HeteroStagePool::release(size_t id) {
+    Task task;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_waiting.empty()) {
+            _free.push_back(id);
+            return;
+        }
+        // the sub-request is handed over to the first waiting HETERO request
+        task = std::move(_waiting.front());
+        _waiting.pop_front();
+    }
+    task(id);
+}
+
+void HeteroStagePool::attach() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    ++_attached;
+}
+
+void HeteroStagePool::detach() {
+    std::lock_guard<std::mutex> lock{_mutex};
+    --_attached;
+}
+
+uint32_t HeteroPlugin::ParsePipelineRequests(const std::string& value) {
+    const bool isUnsigned = !value.empty() && std::all_of(value.begin(), value.end(), [](char c) {
+        return std::isdigit(static_cast<unsigned char>(c));
+    });
+    // the values of more than 10 digits don't fit uint32_t anyway
+    if (!isUnsigned || value.size() > 10 || std::stoull(value) > std::numeric_limits<uint32_t>::max()) {
+        OPENVINO_THROW("Wrong value ",
+                       value,
+                       " for property key ",
+                       ov::hetero::pipeline_requests.name(),
+                       ". Expected only unsigned integer numbers");
+    }
+    return static_cast<uint32_t>(std::stoull(value));
+}
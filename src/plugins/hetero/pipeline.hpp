@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief The infer requests of a subgraph, which are shared by the HETERO infer requests in the pipelined mode.
+ * A HETERO infer request acquires a free sub-request for each stage and waits in the queue of the pool if there is none,
+ * so the number of the HETERO requests in flight at each stage is bounded by the size of the pool.
+ * A HETERO request is at one stage at a time, so it waits at most once in the queue of a pool: the queue is bounded
+ * by the number of the HETERO requests attached to the pool.
+ */
+class HeteroStagePool {
+public:
+    using Ptr = std::shared_ptr<HeteroStagePool>;
+    using Task = std::function<void(size_t)>;
+
+    HeteroStagePool(const InferenceEngine::SoExecutableNetworkInternal& network, size_t size);
+
+    /**
+     * @brief Runs the task with the id of the acquired sub-request, immediately if there is a free one
+     * or in the thread which releases the sub-request otherwise
+     */
+    void acquire(Task task);
+    void release(size_t id);
+
+    void attach();
+    void detach();
+
+    InferenceEngine::SoIInferRequestInternal& at(size_t id) {
+        return _requests.at(id);
+    }
+    size_t size() const {
+        return _requests.size();
+    }
+
+private:
+    std::vector<InferenceEngine::SoIInferRequestInternal> _requests;
+    std::vector<size_t> _free;
+    std::deque<Task> _waiting;
+    size_t _attached = 0;
+    std::mutex _mutex;
+};
+
+/**
+ * @brief The data flow between the subgraphs, which is resolved once for the executable network
+ */
+struct HeteroStageDesc {
+    struct Input {
+        std::string _name;
+        // the stage and the output name of the producer, the producer is -1 for the inputs of the network
+        int _producer;
+        std::string _producerOutput;
+        bool _producedAsNetworkOutput;
+    };
+
+    std::vector<Input> _inputs;
+    // the outputs of the network computed by the stage
+    std::vector<std::string> _networkOutputs;
+    // the stages whose outputs are not read any more when the stage completes, their sub-requests are released
+    std::vector<size_t> _releasedStages;
+};
+
+struct HeteroPipeline {
+    using Ptr = std::shared_ptr<HeteroPipeline>;
+
+    std::vector<HeteroStageDesc> _stages;
+    std::vector<HeteroStagePool::Ptr> _pools;
+    // the performance counters of the sub-requests are saved before they are released
+    bool _perfCount = false;
+
+    // the statistics of the pipelined mode, which are reported by the internal properties
+    std::atomic<uint32_t> _runningStages{0};
+    std::atomic<uint32_t> _maxRunningStages{0};
+    std::atomic<uint32_t> _sharedTensors{0};
+    std::atomic<uint32_t> _copiedTensors{0};
+};
+
+/**
+ * @brief Parses the value of ov::hetero::pipeline_requests, throws if it is not an unsigned integer
+ */
+uint32_t ParsePipelineRequests(const std::string& value);
+
+}  // namespace HeteroPlugin
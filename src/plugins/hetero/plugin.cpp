@@ -18,7 +18,9 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/hetero/properties.hpp"
 #include "internal_properties.hpp"
+#include "pipeline.hpp"
 #include "openvino/util/common_util.hpp"
 // clang-format on
 
@@ -31,6 +33,7 @@ namespace {
 
 const std::vector<std::string>& getHeteroSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  ov::hetero::pipeline_requests.name(),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name()};
 
@@ -70,6 +73,7 @@ Configs any_copy(const ov::AnyMap& params) {
 Engine::Engine() {
     _pluginName = "HETERO";
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[ov::hetero::pipeline_requests.name()] = "0";
     _device_config[CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)] = YES;
 }
 
@@ -93,6 +97,9 @@ ParsedConfig<ov::AnyMap> Engine::MergeConfigs(const ov::AnyMap& user_config) con
         };
 
         try_merge_property(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+        if (try_merge_property(ov::hetero::pipeline_requests.name())) {
+            ParsePipelineRequests(hetero_config[ov::hetero::pipeline_requests.name()]);
+        }
 
         // if we have not found TARGET_FALLBACK in user_config, let's try to find device::priorities
         // Note: we can have conflicts here like
@@ -175,7 +182,10 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
 void Engine::SetConfig(const Configs& user_config) {
     for (auto&& kvp : user_config) {
         const auto& name = kvp.first;
-        if (ov::util::contains(getHeteroSupportedConfigKeys(), name))
+        if (name == ov::hetero::pipeline_requests.name()) {
+            ParsePipelineRequests(kvp.second);
+            _config[name] = kvp.second;
+        } else if (ov::util::contains(getHeteroSupportedConfigKeys(), name))
             _config[name] = kvp.second;
         else if (ov::util::contains(getHeteroDeviceSupportedConfigKeys(), name))
             _device_config[name] = kvp.second;
@@ -228,7 +238,8 @@ Parameter Engine::GetMetric(const std::string& name, const ov::AnyMap& user_opti
             ov::PropertyName{ov::caching_properties.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::device::full_name.name(), ov::PropertyMutability::RO},
             ov::PropertyName{ov::device::capabilities.name(), ov::PropertyMutability::RO},
-            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW}};
+            ov::PropertyName{ov::device::priorities.name(), ov::PropertyMutability::RW},
+            ov::PropertyName{ov::hetero::pipeline_requests.name(), ov::PropertyMutability::RW}};
     } else if (ov::caching_properties == name) {
         return decltype(ov::caching_properties)::value_type{ov::hetero::caching_device_properties.name()};
     } else if (ov::hetero::caching_device_properties == name) {
@@ -291,6 +302,10 @@ Parameter Engine::GetConfig(const std::string& name, const ov::AnyMap& options)
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == ov::hetero::pipeline_requests.name()) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return decltype(ov::hetero::pipeline_requests)::value_type{ParsePipelineRequests(it->second)};
     } else if (name == ov::device::priorities) {
         std::string targetFallback = GetTargetFallback(options);
         auto priorities = ov::util::from_string(targetFallback, ov::device::priorities);
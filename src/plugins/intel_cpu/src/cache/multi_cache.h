@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -84,5 +85,30 @@ using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
 using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
+/**
+ * @brief Thread safe MultiCache that is shared by the graphs of all the streams of the compiled model.
+ *
+ * @attention The lock is held while the value is created, so the concurrent requests of the same key wait
+ *            for the value instead of creating it again, but the values of different keys are created sequentially too.
+ */
+
+class SharedMultiCache {
+public:
+    explicit SharedMultiCache(size_t capacity) : _cache(capacity) {}
+
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _cache.getOrCreate<KeyType, BuilderType, ValueType>(key, std::move(builder));
+    }
+
+private:
+    std::mutex _mutex;
+    MultiCache _cache;
+};
+
+using SharedMultiCachePtr = std::shared_ptr<SharedMultiCache>;
+
 }   // namespace intel_cpu
 }   // namespace ov
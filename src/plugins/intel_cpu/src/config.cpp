@@ -143,6 +143,20 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             } else {
                 fcSparseWeiDecompressionRate = val_f;
             }
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SPARSE_FP32_KERNEL_RATE) {
+            float val_f = 0.0f;
+            try {
+                val_f = std::stof(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_FP32_KERNEL_RATE
+                                    << ". Expected only float numbers";
+            }
+            if (val_f < 0.f || val_f > 1.f) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SPARSE_FP32_KERNEL_RATE
+                                    << ". Sparse rate must be in range [0.0f,1.0f]";
+            } else {
+                fcSparseFP32KernelRate = val_f;
+            }
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -239,6 +253,34 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE
                             << ". Expected values: ENABLE/DISABLE/IGNORE_CALLBACK";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY) {
+            if (val == PluginConfigInternalParams::AUTO)
+                weightsNumaPolicy = WeightsNumaPolicy::Auto;
+            else if (val == PluginConfigInternalParams::REPLICATE)
+                weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+            else if (val == PluginConfigInternalParams::INTERLEAVE)
+                weightsNumaPolicy = WeightsNumaPolicy::Interleave;
+            else if (val == PluginConfigInternalParams::FIRST_TOUCH)
+                weightsNumaPolicy = WeightsNumaPolicy::FirstTouch;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                            << ". Expected values: AUTO/REPLICATE/INTERLEAVE/FIRST_TOUCH";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAYOUT_PLANNER) {
+            if (val == PluginConfigParams::YES)
+                enableLayoutPlanner = true;
+            else if (val == PluginConfigParams::NO)
+                enableLayoutPlanner = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_PLANNER
+                            << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT) {
+            if (val == PluginConfigParams::YES)
+                enableTopKRadixSelect = true;
+            else if (val == PluginConfigParams::NO)
+                enableTopKRadixSelect = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT
+                            << ". Expected only YES/NO";
         } else if (key == ov::hint::execution_mode.name()) {
             if (val == "PERFORMANCE") {
                 executionMode = ov::hint::ExecutionMode::PERFORMANCE;
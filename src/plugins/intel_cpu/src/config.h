@@ -40,14 +40,26 @@ struct Config {
         Disable,
     };
 
+    // Placement of the cached weights on the multi-socket hosts
+    enum class WeightsNumaPolicy {
+        Auto,           // replicate the weights fitting the last level cache, interleave the bigger ones
+        Replicate,      // a copy per NUMA node running the streams (default)
+        Interleave,     // a single copy with the pages spread over all the NUMA nodes
+        FirstTouch,     // a single copy on the NUMA node of the stream which creates it
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+    bool enableLayoutPlanner = false;
+    bool enableTopKRadixSelect = true;
     std::string dumpToDot = {};
     std::string device_id = {};
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
+    float fcSparseFP32KernelRate = 1.0f;
 #if defined(OPENVINO_ARCH_X86_64)
     size_t rtCacheCapacity = 5000ul;
 #else
@@ -23,6 +23,16 @@ namespace intel_cpu {
 
 namespace {
 constexpr size_t gpr_size = 8;
+
+// The label which shape-agnostic LoopBegin jumps to if the Loop has no iterations at runtime.
+// It's defined by the corresponding LoopEnd right before the finalization offsets are applied
+std::string get_loop_skip_label(const ngraph::snippets::op::LoopBegin* loop_begin) {
+    return "snippets_loop_skip_" + std::to_string(reinterpret_cast<uintptr_t>(loop_begin));
+}
+
+size_t get_loop_args_offset(size_t dimension) {
+    return GET_RUNTIME_OFF(loop_args) + dimension * sizeof(jit_snippets_loop_args);
+}
 } // namespace
 
 inline static void transform_idxs_to_regs(const std::vector<size_t>& idxs, std::vector<Reg64>& regs) {
@@ -160,6 +170,10 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
         data_layout.push_back(get_data_layout(out, io_shapes[i]));
         io_data_size.push_back(out.get_element_type().size());
     }
+    // Shape-agnostic kernel reads the strides from runtime args, so they can't be reordered at compile time
+    if (jcp.is_shape_agnostic &&
+        std::any_of(data_layout.begin(), data_layout.end(), [](const std::vector<size_t>& layout) { return !layout.empty(); }))
+        IE_THROW() << "KernelEmitter doesn't support non-default data layouts in shape-agnostic mode";
     // Initialize pools of gp and vec registers
     gp_regs_pool.resize(16);
     vec_regs_pool.resize(16);
@@ -198,9 +212,10 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
     for (const auto& abstract_to_physical : gpr_map_pool.first)
         data_ptr_regs_idx.push_back(abstract_to_physical.second);
     // However we can use reg_indexes_idx and reg_const_params_idx for other operations since we won't need them
-    // after offsets calculation
+    // after offsets calculation. The only exception is shape-agnostic kernel: Loops read runtime args via reg_const_params
     gpr_map_pool.second.push_back(reg_indexes_idx);
-    gpr_map_pool.second.push_back(reg_const_params_idx);
+    if (!jcp.is_shape_agnostic)
+        gpr_map_pool.second.push_back(reg_const_params_idx);
     map_abstract_registers(gpr_map_pool, vec_map_pool, body);
 }
 
@@ -310,6 +325,44 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params, boo
         init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
     }
 }
+
+void KernelEmitter::init_data_pointers_at_runtime(size_t num_inputs, size_t num_params, bool is_buffer_needed,
+                                                  const Reg64& reg_indexes, const Reg64& reg_const_params,
+                                                  const std::vector<Reg64>& data_ptr_regs) const {
+    // Note that we don't need offset for the last dim, since it's handled directly by Tile emitter
+    const size_t offset_rank = jcp.master_shape.size() - 1;
+    if (offset_rank > SNIPPETS_MAX_HARNESS_DIMS)
+        IE_THROW() << "KernelEmitter got unsupported master shape rank in shape-agnostic mode: " << jcp.master_shape.size();
+    // Shape-agnostic subgraphs have at most 11 data pointers, so there is always a spare gpr
+    const auto spare_gpr = std::find_if(gp_regs_pool.begin(), gp_regs_pool.end(),
+                                        [this](size_t reg) {
+                                            return std::find(data_ptr_regs_idx.begin(), data_ptr_regs_idx.end(), reg) ==
+                                                   data_ptr_regs_idx.end();
+                                        });
+    if (spare_gpr == gp_regs_pool.end())
+        IE_THROW() << "KernelEmitter has no spare gpr to calculate data offsets in shape-agnostic mode";
+    Reg64 reg_tmp = Reg64(static_cast<int>(*spare_gpr));
+    if (is_buffer_needed) {
+        h->mov(data_ptr_regs[num_params], h->ptr[reg_const_params + GET_OFF(buffer_scratchpad_ptr)]);
+    }
+    for (size_t i = 0; i < num_params; i++) {
+        if (i < num_inputs)
+            h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+        else
+            h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
+    }
+    // From now on reg_const_params points to the runtime args, Loops read work amounts and finalization offsets from there
+    h->mov(reg_const_params, h->ptr[reg_const_params + GET_OFF(runtime_args)]);
+    for (size_t i = 0; i < num_params; i++) {
+        for (size_t j = 0; j < offset_rank; j++) {
+            h->mov(reg_tmp, h->ptr[reg_const_params + GET_RUNTIME_OFF(data_offsets) +
+                                   (i * SNIPPETS_MAX_HARNESS_DIMS + j) * sizeof(int64_t)]);
+            h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+            h->add(data_ptr_regs[i], reg_tmp);
+        }
+    }
+}
+
 void KernelEmitter::emit_impl(const std::vector<size_t>& in,
                               const std::vector<size_t>& out) const {
     h->preamble();
@@ -319,7 +372,10 @@ void KernelEmitter::emit_impl(const std::vector<size_t>& in,
     std::vector<Reg64> data_ptr_regs;
     transform_idxs_to_regs(data_ptr_regs_idx, data_ptr_regs);
 
-    init_data_pointers(num_inputs, num_inputs + num_outputs, is_buffer_needed, reg_indexes, reg_const_params, data_ptr_regs);
+    if (jcp.is_shape_agnostic)
+        init_data_pointers_at_runtime(num_inputs, num_inputs + num_outputs, is_buffer_needed, reg_indexes, reg_const_params, data_ptr_regs);
+    else
+        init_data_pointers(num_inputs, num_inputs + num_outputs, is_buffer_needed, reg_indexes, reg_const_params, data_ptr_regs);
     for (const auto& c : body) {
         const auto& emitter = c.first;
         std::vector<size_t> in_regs, out_regs;
@@ -343,8 +399,14 @@ LoopBeginEmitter::LoopBeginEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl:
     if (!loop_end)
         IE_THROW() << "LoopBeginEmitter invoked with invalid configuration: the last output must be LoopEnd";
     work_amount = loop_begin->get_work_amount();
+    wa_increment = loop_end->get_increment();
     evaluate_once = loop_begin->get_evaluate_once();
     num_inputs = loop_begin->get_input_size();
+    is_shape_agnostic = loop_end->is_shape_agnostic;
+    dimension = loop_end->dimension;
+    is_tail = loop_end->is_tail;
+    if (is_shape_agnostic && dimension >= SNIPPETS_MAX_TILE_RANK)
+        IE_THROW() << "LoopBeginEmitter got shape-agnostic Loop over unsupported dimension " << dimension;
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
 
@@ -367,8 +429,15 @@ void LoopBeginEmitter::emit_impl(const std::vector<size_t>& in,
     // todo: In dynamic case we will also need to set broadcasting info here
     Reg64 reg_work_amount = Reg64(out.back());
     Label for_body;
-    // save previous register state (if there is an outer loop that uses this reg for example)
-    if (!evaluate_once) {
+    if (is_shape_agnostic) {
+        // Kernel keeps the pointer to the runtime arguments in abi_param2
+        const auto offset = get_loop_args_offset(dimension) +
+                            (is_tail ? offsetof(jit_snippets_loop_args, tail_work_amount) : offsetof(jit_snippets_loop_args, work_amount));
+        h->mov(reg_work_amount, h->ptr[abi_param2 + offset]);
+        h->cmp(reg_work_amount, wa_increment);
+        h->jl(get_loop_skip_label(loop_begin.get()).c_str(), Xbyak::CodeGenerator::T_NEAR);
+    } else if (!evaluate_once) {
+        // save previous register state (if there is an outer loop that uses this reg for example)
         h->mov(reg_work_amount, work_amount);
     }
     // Note: loop address is not calculated at this point, so need to call calcJmpAddress() which is protected
@@ -395,6 +464,8 @@ LoopEndEmitter::LoopEndEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::imp
     ptr_increments = loop_end->get_ptr_increments();
     finalization_offsets = loop_end->get_finalization_offsets();
     evaluate_once = loop_end->get_evaluate_once();
+    is_shape_agnostic = loop_end->is_shape_agnostic;
+    dimension = loop_end->dimension;
     for (int i = 0; i < num_inputs; i++)
         io_data_size.push_back(static_cast<int64_t>(loop_begin->get_input_element_type(i).size()));
     for (int i = 0; i < num_outputs; i++)
@@ -442,6 +513,19 @@ void LoopEndEmitter::emit_impl(const std::vector<size_t>& in,
         h->jge(loop_begin->begin_address);
     }
 
+    if (is_shape_agnostic) {
+        h->L(get_loop_skip_label(loop_begin.get()).c_str());
+        for (int idx = 0; idx < data_ptr_regs.size(); idx++) {
+            if (finalization_offsets[idx] == 0)
+                continue;
+            const auto size_log2 = static_cast<size_t>(std::log2(io_data_size[idx]));
+            const auto offset = get_loop_args_offset(dimension) + offsetof(jit_snippets_loop_args, finalization_offsets) +
+                                size_log2 * sizeof(int64_t);
+            h->add(data_ptr_regs[idx], h->ptr[abi_param2 + offset]);
+        }
+        return;
+    }
+
     for (int idx = 0; idx < data_ptr_regs.size(); idx++) {
         if (finalization_offsets[idx] != 0)
             h->add(data_ptr_regs[idx], finalization_offsets[idx] * io_data_size[idx]);
@@ -781,6 +865,10 @@ BrgemmEmitter::BrgemmEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
 
     m_with_comp = brgemm_node->is_with_compensations();
     m_with_scratch = brgemm_node->is_with_scratchpad();
+    m_with_bias = brgemm_node->has_bias();
+    const bool with_epilogue = brgemm_node->has_epilogue();
+    if (with_epilogue)
+        m_post_ops_attr.set_post_ops(get_post_ops(brgemm_node->get_post_ops()));
 
     m_N_blk = brg1Prc == Precision::FP32 ? m_N :
               brg1Prc == Precision::BF16 ? 32 : 64;
@@ -810,6 +898,7 @@ BrgemmEmitter::BrgemmEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
                 brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
                 brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1Prc));
                 brgemmCtx.beta = beta;
+                brgemmCtx.is_with_epilogue = with_epilogue && (k || m_K_tail == 0);
 
                 // don't create brgemm kernels for empty tiles
                 if (M_ != 0 && K_ != 0 && N_ != 0) {
@@ -826,26 +915,97 @@ BrgemmEmitter::BrgemmEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
     m_store_offset_c = brgemm_node->get_offset_c();
     if (m_with_scratch)
         m_load_offset_scratch = brgemm_node->get_offset_scratch();
+    if (m_with_bias)
+        m_load_offset_bias = brgemm_node->get_offset_bias();
+}
+
+dnnl::post_ops BrgemmEmitter::get_post_ops(const std::vector<ngraph::snippets::op::Brgemm::PostOp>& post_ops) {
+    using PostOpType = ngraph::snippets::op::Brgemm::PostOp::Type;
+    dnnl::post_ops ops;
+    for (const auto& post_op : post_ops) {
+        switch (post_op.type) {
+            case PostOpType::Linear:
+                ops.append_eltwise(dnnl::algorithm::eltwise_linear, post_op.alpha, post_op.beta);
+                break;
+            case PostOpType::Relu:
+                ops.append_eltwise(dnnl::algorithm::eltwise_relu, post_op.alpha, 0.f);
+                break;
+            case PostOpType::GeluErf:
+                ops.append_eltwise(dnnl::algorithm::eltwise_gelu_erf, 0.f, 0.f);
+                break;
+            case PostOpType::GeluTanh:
+                ops.append_eltwise(dnnl::algorithm::eltwise_gelu_tanh, 0.f, 0.f);
+                break;
+            case PostOpType::Sigmoid:
+                ops.append_eltwise(dnnl::algorithm::eltwise_logistic, 0.f, 0.f);
+                break;
+            case PostOpType::Tanh:
+                ops.append_eltwise(dnnl::algorithm::eltwise_tanh, 0.f, 0.f);
+                break;
+            case PostOpType::Elu:
+                ops.append_eltwise(dnnl::algorithm::eltwise_elu, post_op.alpha, 0.f);
+                break;
+            case PostOpType::Clip:
+                ops.append_eltwise(dnnl::algorithm::eltwise_clip, post_op.alpha, post_op.beta);
+                break;
+            case PostOpType::Abs:
+                ops.append_eltwise(dnnl::algorithm::eltwise_abs, 0.f, 0.f);
+                break;
+            case PostOpType::Sqrt:
+                ops.append_eltwise(dnnl::algorithm::eltwise_sqrt, 0.f, 0.f);
+                break;
+            case PostOpType::Exp:
+                ops.append_eltwise(dnnl::algorithm::eltwise_exp, 0.f, 0.f);
+                break;
+            case PostOpType::HSwish:
+                // ov uses hardswish with hardcoded alpha and beta
+                ops.append_eltwise(dnnl::algorithm::eltwise_hardswish, 1.f / 6.f, 0.5f);
+                break;
+            case PostOpType::RoundHalfToEven:
+                ops.append_eltwise(dnnl::algorithm::eltwise_round_half_to_even, 0.f, 0.f);
+                break;
+            case PostOpType::RoundHalfAwayFromZero:
+                ops.append_eltwise(dnnl::algorithm::eltwise_round_half_away_from_zero, 0.f, 0.f);
+                break;
+            default:
+                IE_THROW() << "BrgemmEmitter got unsupported post-op";
+        }
+    }
+    return ops;
 }
 
 std::set<std::vector<element::Type>> BrgemmEmitter::get_supported_precisions(const std::shared_ptr<ngraph::Node>& node) {
     const auto brgemm = as_type_ptr<ov::intel_cpu::BrgemmCPU>(node);
     OPENVINO_ASSERT(brgemm, "BrgemmEmitter::get_supported_precisions() expects BrgemmCPU node");
+    std::set<std::vector<element::Type>> precisions;
     switch (brgemm->get_type()) {
         case BrgemmCPU::Type::Floating:
-            return {{element::f32, element::f32}};
+            precisions = {{element::f32, element::f32}};
+            break;
         case BrgemmCPU::Type::WithDataRepacking:
-            return {{element::u8, element::i8},
-                    {element::bf16, element::bf16}};
+            precisions = {{element::u8, element::i8},
+                          {element::bf16, element::bf16}};
+            break;
         case BrgemmCPU::Type::WithCompensations:
-            return {{element::i8, element::i8, element::f32}};
+            precisions = {{element::i8, element::i8, element::f32}};
+            break;
         case BrgemmCPU::Type::AMX:
-            return {{element::i8, element::i8, element::u8},
-                    {element::u8, element::i8, element::u8},
-                    {element::bf16, element::bf16, element::u8}};
+            precisions = {{element::i8, element::i8, element::u8},
+                          {element::u8, element::i8, element::u8},
+                          {element::bf16, element::bf16, element::u8}};
+            break;
         default:
             OPENVINO_THROW("BrgemmEmitter got BrgemmCPU node with unsupported type");
     }
+    if (brgemm->has_bias()) {
+        std::set<std::vector<element::Type>> precisions_with_bias;
+        for (auto input_precisions : precisions) {
+            input_precisions.push_back(element::f32);
+            precisions_with_bias.insert(input_precisions);
+        }
+        return precisions_with_bias;
+    }
+    return precisions;
 }
 
 void BrgemmEmitter::initBrgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>& brgKernel, bool use_amx) const {
@@ -859,6 +1019,16 @@ void BrgemmEmitter::initBrgemm(brgemmCtx& ctx, std::unique_ptr<brgemm_kernel_t>&
     if (status != dnnl_success)
         IE_THROW() << "BrgemmEmitter cannot initialize brgemm descriptor due to invalid params";
 
+    if (ctx.is_with_epilogue) {
+        // The epilogue is applied on the accumulated f32 tile, and the result is stored in place of it
+        const dnnl::memory::desc dst_md({static_cast<dnnl_dim_t>(ctx.M), static_cast<dnnl_dim_t>(ctx.N)}, dnnl::memory::data_type::f32,
+                                        {static_cast<dnnl_dim_t>(ctx.LDC), 1});
+        status = brgemm_desc_set_postops(&brgDesc, m_post_ops_attr.get(), dst_md.get(), static_cast<int>(ctx.LDC),
+                                         m_with_bias ? data_type::f32 : data_type::undef);
+        if (status != dnnl_success)
+            IE_THROW() << "BrgemmEmitter cannot set post-ops to brgemm descriptor";
+    }
+
     ctx.is_with_amx = use_amx;
     status = brgemm_init_tiles(brgDesc, ctx.palette);
     if (use_amx)
@@ -879,12 +1049,16 @@ void BrgemmEmitter::emit_impl(const std::vector<size_t>& in,
         Xbyak::Reg64 input_0(static_cast<int>(in[0]));
         Xbyak::Reg64 input_1(static_cast<int>(in[1]));
         Xbyak::Reg64 input_2(static_cast<int>(0));  // scratch. Default reg index is 0 if there isn't scratch
+        Xbyak::Reg64 bias(static_cast<int>(0));  // bias is always the last input. Default reg index is 0 if there isn't bias
+        if (in.size() != get_inputs_num()) {
+            IE_THROW() << "BRGEMM Emitter expects " << get_inputs_num() << " inputs, but got " << in.size();
+        }
         if (m_with_scratch) {
-            if (in.size() != 3) {
-                IE_THROW() << "BRGEMM Emitter expects 3 inputs if there are compensations/wsp";
-            }
             input_2 = Xbyak::Reg64(static_cast<int>(in[2]));
         }
+        if (m_with_bias) {
+            bias = Xbyak::Reg64(static_cast<int>(in.back()));
+        }
         Xbyak::Reg64 output_0(static_cast<int>(out[0]));
 
         for (size_t mb = 0; mb < div_up(m_M, m_M_blk); mb++) {
@@ -905,6 +1079,8 @@ void BrgemmEmitter::emit_impl(const std::vector<size_t>& in,
                         const size_t in1_offset = m_load_offset_b + (k * K0_step1 + n * N0_step0) * io_data_size[1];
                         const size_t in2_offset = m_load_offset_scratch + (m_with_comp ? n * N0_step1 * sizeof(int32_t) : 0);
                         const size_t out0_offset = m_store_offset_c + (n * N0_step1 + mb * m_M_blk * brgemmCtx.LDC) * io_data_size[2];
+                        // bias is broadcasted over M dimension
+                        const size_t bias_offset = m_load_offset_bias + n * N0_step1 * sizeof(float);
 
                         emit_brgemm_kernel_call(m_brgKernels0[getBrgIdx(mIdx, k, n)].get(),
                                                 brgemmCtx,
@@ -912,10 +1088,12 @@ void BrgemmEmitter::emit_impl(const std::vector<size_t>& in,
                                                 input_1,
                                                 input_2,
                                                 output_0,
+                                                bias,
                                                 in0_offset,
                                                 in1_offset,
                                                 in2_offset,
-                                                out0_offset);
+                                                out0_offset,
+                                                bias_offset);
                     }
                 }
             }
@@ -926,9 +1104,10 @@ void BrgemmEmitter::emit_impl(const std::vector<size_t>& in,
 }
 
 void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, const brgemmCtx& ctx,
-                                            Reg64 addr_A, Reg64 addr_B, Reg64 scratch, Reg64 addr_C,
+                                            Reg64 addr_A, Reg64 addr_B, Reg64 scratch, Reg64 addr_C, Reg64 bias,
                                             const size_t in0_kernel_offset, const size_t in1_kernel_offset,
-                                            const size_t in2_kernel_offset, const size_t out0_kernel_offset) const {
+                                            const size_t in2_kernel_offset, const size_t out0_kernel_offset,
+                                            const size_t bias_kernel_offset) const {
     if (ctx.is_with_amx) {
         Xbyak::Operand gprs_to_save[] = {h->r8, h->r9, h->r10, h->r11, h->rax,
                                          h->rcx, h->rdx, h->rdi, h->rsi, h->rbp, h->rbx};
@@ -991,7 +1170,8 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
                                                               const void*,
                                                               void*,
                                                               void*,
-                                                              int)>(kernel_execute);
+                                                              int,
+                                                              const void*)>(kernel_execute);
     h->mov(h->rbp, reinterpret_cast<uintptr_t>(brgemm_kernel_overload));
     // todo: several of addr_{A, B, C} could be also abi_paramX, so one of them could be corrupted
     //  if moving directly h->uni_vmovq(abi_paramX, adr_X). Save them to vector regs to avoid corruption.
@@ -1001,6 +1181,8 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
     h->uni_vmovq(Xmm(2), addr_C);
     if (m_with_scratch)
         h->uni_vmovq(Xmm(3), scratch);
+    if (m_with_bias)
+        h->uni_vmovq(Xmm(4), bias);
     // todo: Windows ABI : requires different num of arguments passed in regs and on the stack. Need to align.
     const auto data_ptr_reg = [&](Xmm xmm, Xbyak::Reg64 reg, size_t bytes_offset) {
         h->uni_vmovq(reg, xmm);
@@ -1015,7 +1197,7 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
     // Before function call we should allocate stack area for
     //  - register parameters - ABI parameters (shadow space)
     //  - stack parameters - remaining parameters
-    const size_t num_args_passed_on_stack = 6;  // count of function brgemm_kernel_overload() parameters
+    const size_t num_args_passed_on_stack = 7;  // count of function brgemm_kernel_overload() parameters
     size_t abi_param_count = sizeof(abi_param_regs) / sizeof(abi_param_regs[0]);
     h->sub(h->rsp, num_args_passed_on_stack * gpr_size);
 
@@ -1026,15 +1208,27 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
     } else {
         h->mov(h->qword[h->rsp + (abi_param_count + 0) * gpr_size], reinterpret_cast<uintptr_t>(nullptr));
     }
-    h->mov(abi_not_param1, static_cast<int>(m_with_comp));
+    h->mov(abi_not_param1, static_cast<int>(m_with_comp || ctx.is_with_epilogue));
     h->mov(h->qword[h->rsp + (abi_param_count + 1) * gpr_size], abi_not_param1);
+    if (m_with_bias) {
+        data_ptr_reg(Xmm(4), abi_not_param1, bias_kernel_offset);
+    } else {
+        h->mov(abi_not_param1, reinterpret_cast<uintptr_t>(nullptr));
+    }
+    h->mov(h->qword[h->rsp + (abi_param_count + 2) * gpr_size], abi_not_param1);
 #else
     if (m_with_scratch) {
         data_ptr_reg(Xmm(3), abi_param5, in2_kernel_offset);
     } else {
         h->mov(abi_param5, reinterpret_cast<uintptr_t>(nullptr));
     }
-    h->mov(abi_param6, static_cast<int>(m_with_comp));
+    h->mov(abi_param6, static_cast<int>(m_with_comp || ctx.is_with_epilogue));
+    // The 7th parameter (bias) is passed on the stack
+    if (m_with_bias) {
+        data_ptr_reg(Xmm(4), h->rax, bias_kernel_offset);
+    } else {
+        h->mov(h->rax, reinterpret_cast<uintptr_t>(nullptr));
+    }
 #endif
 
     // align stack on 16-byte as ABI requires
@@ -1043,8 +1237,17 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
     h->and_(h->rbx, 0xf);
     h->sub(h->rsp, h->rbx);
 
+#ifndef _WIN32
+    // keep the stack aligned on 16-byte after the stack parameter is pushed
+    h->sub(h->rsp, 2 * gpr_size);
+    h->mov(h->qword[h->rsp], h->rax);
+#endif
+
     h->call(h->rbp);
 
+#ifndef _WIN32
+    h->add(h->rsp, 2 * gpr_size);
+#endif
     h->add(h->rsp, h->rbx);
 
 #ifdef _WIN32
@@ -1072,7 +1275,7 @@ void BrgemmEmitter::emit_brgemm_kernel_call(const brgemm_kernel_t *brg_kernel, c
 }
 
 void BrgemmEmitter::kernel_execute(const brgemm_kernel_t *brg_kernel,
-                                   const void *A, const void *B, void *C, void *scratch, int with_comp) {
+                                   const void *A, const void *B, void *C, void *scratch, int do_post_ops, const void *bias) {
     brgemm_kernel_params_t brgemm_p;
 
     brgemm_p.batch = nullptr;  // default value
@@ -1081,9 +1284,10 @@ void BrgemmEmitter::kernel_execute(const brgemm_kernel_t *brg_kernel,
     brgemm_p.ptr_C = C;
     brgemm_p.ptr_D = C;
     brgemm_p.ptr_buf = scratch;
-    brgemm_p.ptr_bias = nullptr;
-    brgemm_p.do_post_ops = static_cast<size_t>(with_comp);
-    brgemm_p.do_apply_comp = static_cast<size_t>(with_comp);
+    brgemm_p.ptr_bias = bias;
+    // compensations are applied as post-ops, so the flag is set for both epilogue and compensations
+    brgemm_p.do_post_ops = static_cast<size_t>(do_post_ops);
+    brgemm_p.do_apply_comp = static_cast<size_t>(do_post_ops);
     brgemm_p.skip_accm = 0;
     brgemm_p.BS = 1;  // default value
     assert(brg_kernel);
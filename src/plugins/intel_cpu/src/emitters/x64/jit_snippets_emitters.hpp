@@ -24,16 +24,35 @@ namespace intel_cpu {
 #define SNIPPETS_MAX_HARNESS_DIMS 5
 #define SNIPPETS_MAX_TILE_RANK 2
 #define SNIPPETS_DYNAMIC_MASTER_SHAPE_RANK 6
+#define SNIPPETS_MAX_DATA_SIZE_LOG2 4
 #define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+#define GET_RUNTIME_OFF(field) offsetof(jit_snippets_runtime_args, field)
+// Shape dependent parameters of the shape-agnostic kernels, they are updated by the plugin on every new input shape
+struct jit_snippets_loop_args {
+    int64_t work_amount = 0;
+    int64_t tail_work_amount = 0;
+    // the rewind of the data pointers by the whole work amount, in bytes, indexed by log2 of the data size
+    int64_t finalization_offsets[SNIPPETS_MAX_DATA_SIZE_LOG2] = {};
+};
+
+struct jit_snippets_runtime_args {
+    // data pointer offsets in bytes per unit of the scheduler indexes
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS][SNIPPETS_MAX_HARNESS_DIMS] = {};
+    jit_snippets_loop_args loop_args[SNIPPETS_MAX_TILE_RANK] = {};
+};
+
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    const jit_snippets_runtime_args *runtime_args = nullptr;
 };
 
 struct jit_snippets_compile_args {
     std::vector<size_t> master_shape{};
     size_t tile_rank = 0;
+    // if true, the data offsets and the loop work amounts are read from jit_snippets_call_args::runtime_args
+    bool is_shape_agnostic = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (for example, KernelEmitter)
@@ -86,6 +105,7 @@ private:
     void emit_impl(const std::vector<size_t>& in,
                    const std::vector<size_t>& out) const override;
     void init_data_pointers(size_t, size_t, bool, const Xbyak::Reg64&, const Xbyak::Reg64&, const std::vector<Xbyak::Reg64>&) const;
+    void init_data_pointers_at_runtime(size_t, size_t, bool, const Xbyak::Reg64&, const Xbyak::Reg64&, const std::vector<Xbyak::Reg64>&) const;
 
     jit_snippets_compile_args jcp;
     std::vector<size_t> gp_regs_pool;
@@ -126,6 +146,10 @@ private:
     size_t num_inputs = 0;
     bool evaluate_once = false;
     size_t work_amount = 0; // need to store work_amount explicitly, since two loops can work on the same dim (e.g. vector + scalar)
+    size_t wa_increment = 0;
+    bool is_shape_agnostic = false;
+    size_t dimension = 0;
+    bool is_tail = false;
 };
 
 class LoopEndEmitter : public jit_emitter {
@@ -154,6 +178,8 @@ private:
     size_t wa_increment = 0;
     size_t work_amount = 0;
     bool evaluate_once = false;
+    bool is_shape_agnostic = false;
+    size_t dimension = 0;
     std::vector<int64_t> ptr_increments;
     std::vector<int64_t> finalization_offsets;
 };
@@ -321,7 +347,7 @@ class BrgemmEmitter : public jit_emitter {
 public:
     BrgemmEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n);
 
-    size_t get_inputs_num() const override { return m_with_scratch ? 3 : 2; }
+    size_t get_inputs_num() const override { return 2 + static_cast<size_t>(m_with_scratch) + static_cast<size_t>(m_with_bias); }
     static std::set<std::vector<element::Type>> get_supported_precisions(const std::shared_ptr<ngraph::Node>& node = nullptr);
 
 private:
@@ -335,16 +361,21 @@ private:
         char palette[64];
         bool is_with_amx;
         bool is_with_comp;
+        // The epilogue (bias and post-ops) is applied only by the kernels that compute the last K block
+        bool is_with_epilogue;
         float beta;
     };
     void initBrgemm(brgemmCtx& ctx, std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& brgKernel, bool use_amx) const;
     size_t getBrgIdx(size_t mIdx, size_t kIdx, size_t nIdx) const;
+    static dnnl::post_ops get_post_ops(const std::vector<ngraph::snippets::op::Brgemm::PostOp>& post_ops);
 
     void emit_brgemm_kernel_call(const dnnl::impl::cpu::x64::brgemm_kernel_t* brg_kernel, const brgemmCtx& ctx,
-                                 Xbyak::Reg64 addr_A, Xbyak::Reg64 addr_B, Xbyak::Reg64 scratch, Xbyak::Reg64 addr_C,
+                                 Xbyak::Reg64 addr_A, Xbyak::Reg64 addr_B, Xbyak::Reg64 scratch, Xbyak::Reg64 addr_C, Xbyak::Reg64 bias,
                                  const size_t in0_kernel_offset, const size_t in1_kernel_offset,
-                                 const size_t in2_kernel_offset, const size_t out0_kernel_offset) const;
-    static void kernel_execute(const dnnl::impl::cpu::x64::brgemm_kernel_t *brg_kernel, const void *A, const void *B, void *C, void *scratch, int with_comp);
+                                 const size_t in2_kernel_offset, const size_t out0_kernel_offset,
+                                 const size_t bias_kernel_offset) const;
+    static void kernel_execute(const dnnl::impl::cpu::x64::brgemm_kernel_t *brg_kernel, const void *A, const void *B, void *C, void *scratch,
+                               int do_post_ops, const void *bias);
 
     static constexpr size_t BRGEMM_KERNELS_NUM = 8;
     static constexpr size_t matmulOptimalM = 32;
@@ -358,10 +389,13 @@ private:
 
     bool m_with_scratch = false;
     bool m_with_comp = false;
+    bool m_with_bias = false;
+    dnnl::primitive_attr m_post_ops_attr;
 
     size_t m_load_offset_a = 0lu;
     size_t m_load_offset_b = 0lu;
     size_t m_load_offset_scratch = 0lu;
+    size_t m_load_offset_bias = 0lu;
     size_t m_store_offset_c = 0lu;
 };
 
@@ -25,6 +25,7 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
@@ -70,7 +71,9 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _numaNodesWeights{cfg.weightsNumaPolicy},
+    _snippetsCache{std::make_shared<SharedMultiCache>(cfg.rtCacheCapacity)} {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -147,15 +150,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
                 }
-                auto state_store = memoryNode->getStore();
-                auto state_name = memoryNode->getId();
-
-                // Remove suffix with pair ID. Internal information.
-                auto suffix_idx = state_name.find("/id=");
-                if (suffix_idx != std::string::npos)
-                    state_name = state_name.substr(0, suffix_idx);
-
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(memoryNode->makeState());
             }
         }
     }
@@ -164,10 +159,12 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
     int streamId = 0;
     int numaNodeId = 0;
+    int coreType = ov::ALL_PROC;
     auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
     if (nullptr != streamsExecutor) {
         streamId = streamsExecutor->GetStreamId();
         numaNodeId = streamsExecutor->GetNumaNodeId();
+        coreType = streamsExecutor->get_stream_core_type();
     }
     auto graphLock = GraphGuard::Lock(_graphs[streamId % _graphs.size()]);
     if (!graphLock._graph.IsReady()) {
@@ -185,7 +182,8 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag, coreType,
+                                                         _snippetsCache);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -280,11 +278,31 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    if (name == CONFIG_KEY_INTERNAL(CPU_SNIPPETS_KERNEL_CACHE_HITS)) {
+        // the requests may be executed by the graphs of any stream
+        size_t hits = 0;
+        for (auto&& graph : _graphs) {
+            GraphGuard::Lock graphLock{graph};
+            if (graph.IsReady())
+                hits += graph.getSnippetKernelCacheHits();
+        }
+        return static_cast<int>(hits);
+    }
+
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
     const auto& config = graph.getConfig();
 
+    if (name == CONFIG_KEY_INTERNAL(CPU_WEIGHTS_PLACEMENT)) {
+        return _numaNodesWeights.getPlacement();
+    }
+
+    if (name == CONFIG_KEY_INTERNAL(CPU_SAVED_REORDERS)) {
+        return static_cast<int>(graph.getSavedReordersCount());
+    }
+
     if (isLegacyAPI()) {
         return GetMetricLegacy(name, graph);
     }
@@ -69,6 +69,8 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // the snippets kernels compiled by the graph of one stream are reused by the graphs of the other streams
+    SharedMultiCachePtr                         _snippetsCache;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -17,6 +17,7 @@
 #include "graph.h"
 #include "graph_dumper.h"
 #include "graph_optimizer.h"
+#include "graph_layout_planner.h"
 #include "dnnl_extension_utils.h"
 #include "extension_mngr.h"
 #include "memory_solver.hpp"
@@ -453,6 +454,21 @@ void Graph::InitDescriptors() {
         DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
         node->selectOptimalPrimitiveDescriptor();
     }
+
+    // Split takes the strided in-place views only if a consumer accepts them, so it's selected again when the consumers are known
+    for (auto &node : graphNodes) {
+        if (node->getType() == Type::Split && node->getSelectedPrimitiveDescriptor())
+            node->selectOptimalPrimitiveDescriptor();
+    }
+
+    if (!getConfig().enableLayoutPlanner)
+        return;
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "PlanLayouts");
+    const auto planned = GraphLayoutPlanner(graphNodes, graphEdges).run();
+    savedReorders = planned.greedyReorders > planned.plannedReorders ? planned.greedyReorders - planned.plannedReorders : 0;
+    DEBUG_LOG("Layout planner: ", planned.greedyReorders, " reorders after the greedy selection, ",
+              planned.plannedReorders, " after the planning");
 }
 
 void Graph::InitOptimalPrimitiveDescriptors() {
@@ -733,18 +749,21 @@ void Graph::AllocateWithReuse() {
         // Constant data are filled once on load.
         // So we need it untouchable during all execution time
         // -1 is a place holder for a max timestamp.
-        bool isConst = false, isOutput = false, isInput = false;
+        bool isConst = false, isOutput = false, isInput = false, isState = false;
         for (auto &edge : edge_clusters[i]) {
             isConst  |= isConstOutput(edge);
             isOutput |= edge->getChild()->getType() == Type::Output;
             isInput  |= edge->getParent()->getType() == Type::Input;
+            // The output of the dynamic state may point to the state storage itself,
+            // so its memory manager must not be shared with any other tensor
+            isState  |= edge->getParent()->getType() == Type::MemoryInput && edge->getParent()->isDynamicNode();
         }
 
         if (reuse_io_tensors) {
-            if (isInput | isConst) box.start = 0;
-            if (isOutput | isConst) box.finish = -1;
+            if (isInput | isConst | isState) box.start = 0;
+            if (isOutput | isConst | isState) box.finish = -1;
         } else {
-            if (isInput  | isOutput | isConst) {
+            if (isInput  | isOutput | isConst | isState) {
                 box.start = 0;
                 box.finish = -1;
             }
@@ -1269,6 +1288,15 @@ void Graph::Infer(InferRequestBase* request) {
     if (infer_count != -1) infer_count++;
 }
 
+size_t Graph::getSnippetKernelCacheHits() const {
+    size_t hits = 0;
+    for (const auto& node : graphNodes) {
+        if (const auto snippet = std::dynamic_pointer_cast<node::Snippet>(node))
+            hits += snippet->getKernelCacheHits();
+    }
+    return hits;
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
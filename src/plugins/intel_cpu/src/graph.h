@@ -79,6 +79,19 @@ public:
         return graphEdges;
     }
 
+    /**
+     * @brief Returns the estimated number of the reorders eliminated by the layout planner
+     * comparing to the greedy selection of the primitive descriptors
+     */
+    size_t getSavedReordersCount() const {
+        return savedReorders;
+    }
+
+    /**
+     * @brief Returns how many times the Snippet nodes took a generated kernel from the caches
+     */
+    size_t getSnippetKernelCacheHits() const;
+
     std::map<std::string, NodePtr>& GetInputNodesMap() {
         return inputNodesMap;
     }
@@ -231,6 +244,7 @@ protected:
     std::string _name;
 
     bool graphHasDynamicInput = false;
+    size_t savedReorders = 0;
 
     void Replicate(const InferenceEngine::CNNNetwork &network);
     void Replicate(const std::shared_ptr<const ov::Model> &subgraph);
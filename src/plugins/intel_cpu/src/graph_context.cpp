@@ -9,5 +9,11 @@ namespace intel_cpu {
 
 dnnl::engine GraphContext::eng(dnnl::engine::kind::cpu, 0);
 
+GraphContext::Ptr GraphContext::cloneWithSharedCache() const {
+    auto clone = std::make_shared<GraphContext>(*this);
+    clone->rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+    return clone;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
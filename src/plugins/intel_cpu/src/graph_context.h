@@ -9,6 +9,7 @@
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
 #include "weights_cache.hpp"
+#include "openvino/runtime/system_conf.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -21,13 +22,19 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 int coreType = ov::ALL_PROC,
+                 SharedMultiCachePtr snippetsCache = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
-          isGraphQuantizedFlag(isGraphQuantized) {
+          snippetsCache(snippetsCache),
+          isGraphQuantizedFlag(isGraphQuantized),
+          coreType(coreType) {
         rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
+        if (!this->snippetsCache)
+            this->snippetsCache = std::make_shared<SharedMultiCache>(config.rtCacheCapacity);
     }
 
     const Config& getConfig() const {
@@ -47,6 +54,11 @@ public:
         return rtParamsCache;
     }
 
+    // the snippets kernels are shared by the graphs of all the streams, so each kernel is compiled once per compiled model
+    SharedMultiCachePtr getSnippetsCache() const {
+        return snippetsCache;
+    }
+
     DnnlScratchPadPtr getScratchPad() const {
         return rtScratchPad;
     }
@@ -59,6 +71,15 @@ public:
         return isGraphQuantizedFlag;
     }
 
+    // the context for a graph executed simultaneously with the graph of this context,
+    // the primitive cache is shared, so the primitives are compiled once, but the scratchpad is not
+    Ptr cloneWithSharedCache() const;
+
+    // the core type of the stream executing the graph, the nodes may choose the blocking for it
+    int getCoreType() const {
+        return coreType;
+    }
+
 private:
     Config config;  // network-level config
 
@@ -66,9 +87,11 @@ private:
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
 
     MultiCachePtr rtParamsCache;     // primitive cache
+    SharedMultiCachePtr snippetsCache;  // snippets kernels cache shared by the streams
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
 
     bool isGraphQuantizedFlag = false;
+    int coreType = ov::ALL_PROC;     // column of the processor type table, ALL_PROC if the stream isn't bound to a core type
     static dnnl::engine eng;  // onednn engine (singleton)
 };
 
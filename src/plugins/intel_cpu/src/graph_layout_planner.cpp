@@ -0,0 +1,293 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "graph_layout_planner.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// The relative cost of each next descriptor in the node preference order, in the bytes per byte of the node output.
+// It's small enough for the reorder of the same tensor to be more expensive than the less preferable layout.
+constexpr double layoutRankCost = 0.125;
+// The number of the passes over the chains for the DAG
+constexpr size_t maxPasses = 8;
+
+size_t getBytes(const MemoryDescPtr& desc) {
+    if (!desc || !desc->getShape().isStatic())
+        return 0;
+    return desc->getShape().getElementsCount() * desc->getPrecision().size();
+}
+
+bool isPlannable(const NodePtr& node) {
+    // the nodes with the custom descriptors selection logic (in-place Concat/Split) and the graph boundaries are kept
+    static const std::vector<Type> fixedTypes = {Type::Input, Type::Output, Type::Reorder, Type::Concatenation, Type::Split};
+    if (std::find(fixedTypes.begin(), fixedTypes.end(), node->getType()) != fixedTypes.end())
+        return false;
+    return !node->isDynamicNode() && !node->isConstant() && node->getSelectedPrimitiveDescriptor() != nullptr;
+}
+}   // namespace
+
+GraphLayoutPlanner::GraphLayoutPlanner(const std::vector<NodePtr>& graphNodes, const std::vector<EdgePtr>& graphEdges) {
+    nodes.reserve(graphNodes.size());
+    for (const auto& node : graphNodes) {
+        NodeInfo info;
+        info.node = node;
+        const auto& descs = node->getSupportedPrimitiveDescriptors();
+        const auto selected = node->getSelectedPrimitiveDescriptor();
+        if (!selected) {
+            nodes.push_back(info);
+            continue;
+        }
+        const int selectedIdx = static_cast<int>(selected - descs.data());
+        info.plannable = isPlannable(node);
+        if (info.plannable) {
+            // only the descriptors of the same implementation type are considered, the kernel is chosen by the node
+            for (size_t i = 0; i < descs.size(); i++) {
+                if (descs[i].getImplementationType() == selected->getImplementationType())
+                    info.candidates.push_back(static_cast<int>(i));
+            }
+            info.current = std::find(info.candidates.begin(), info.candidates.end(), selectedIdx) - info.candidates.begin();
+            info.plannable = info.candidates.size() > 1;
+            for (const auto& outConf : selected->getConfig().outConfs)
+                info.outputBytes += getBytes(outConf.getMemDesc());
+        }
+        if (!info.plannable) {
+            info.candidates = {selectedIdx};
+            info.current = 0;
+        }
+        nodeIdx[node.get()] = nodes.size();
+        nodes.push_back(info);
+    }
+
+    for (const auto& edge : graphEdges) {
+        const auto parent = nodeIdx.find(edge->getParent().get());
+        const auto child = nodeIdx.find(edge->getChild().get());
+        if (parent == nodeIdx.end() || child == nodeIdx.end())
+            continue;
+        const bool constant = edge->getParent()->isConstant();
+        nodes[parent->second].edges.push_back(edges.size());
+        nodes[child->second].edges.push_back(edges.size());
+        edges.push_back({parent->second, child->second, edge->getInputNum(), edge->getOutputNum(), constant});
+    }
+}
+
+bool GraphLayoutPlanner::needReorder(const EdgeInfo& edge, int parentDescIdx, int childDescIdx) const {
+    const auto& parentConfig = nodes[edge.parent].node->getSupportedPrimitiveDescriptors()[parentDescIdx].getConfig();
+    const auto& childConfig = nodes[edge.child].node->getSupportedPrimitiveDescriptors()[childDescIdx].getConfig();
+    if (edge.parentPort < 0 || static_cast<size_t>(edge.parentPort) >= parentConfig.outConfs.size() ||
+        edge.childPort < 0 || static_cast<size_t>(edge.childPort) >= childConfig.inConfs.size())
+        return false;
+    const auto parentDesc = parentConfig.outConfs[edge.parentPort].getPortDesc();
+    const auto childDesc = childConfig.inConfs[edge.childPort].getPortDesc();
+    if (!parentDesc || !childDesc)
+        return false;
+    return !childDesc->isCompatible(*parentDesc);
+}
+
+double GraphLayoutPlanner::edgeCost(const EdgeInfo& edge, int parentDescIdx, int childDescIdx) const {
+    // the constant inputs are reordered once at the compilation stage
+    if (edge.constant || !needReorder(edge, parentDescIdx, childDescIdx))
+        return 0;
+    // the reorder reads the parent tensor and writes the child one
+    const auto& parentConfig = nodes[edge.parent].node->getSupportedPrimitiveDescriptors()[parentDescIdx].getConfig();
+    const auto& childConfig = nodes[edge.child].node->getSupportedPrimitiveDescriptors()[childDescIdx].getConfig();
+    return static_cast<double>(getBytes(parentConfig.outConfs[edge.parentPort].getMemDesc()) +
+                               getBytes(childConfig.inConfs[edge.childPort].getMemDesc()));
+}
+
+double GraphLayoutPlanner::kernelCost(size_t node, size_t candidate) const {
+    return layoutRankCost * candidate * nodes[node].outputBytes;
+}
+
+double GraphLayoutPlanner::unaryCost(const std::vector<size_t>& chain, size_t pos, size_t candidate) const {
+    const auto node = chain[pos];
+    const auto descIdx = getDescIdx(node, candidate);
+    double cost = kernelCost(node, candidate);
+    for (const auto edgeIdx : nodes[node].edges) {
+        const auto& edge = edges[edgeIdx];
+        // the edges between the neighbours in the chain are accounted by the transition cost
+        if ((pos > 0 && edge.parent == chain[pos - 1] && edge.child == node) ||
+            (pos + 1 < chain.size() && edge.parent == node && edge.child == chain[pos + 1]))
+            continue;
+        if (edge.parent == node) {
+            cost += edgeCost(edge, descIdx, getDescIdx(edge.child, nodes[edge.child].current));
+        } else {
+            cost += edgeCost(edge, getDescIdx(edge.parent, nodes[edge.parent].current), descIdx);
+        }
+    }
+    return cost;
+}
+
+double GraphLayoutPlanner::transitionCost(size_t parent, size_t parentCandidate, size_t child, size_t childCandidate) const {
+    double cost = 0;
+    for (const auto edgeIdx : nodes[child].edges) {
+        const auto& edge = edges[edgeIdx];
+        if (edge.parent == parent && edge.child == child)
+            cost += edgeCost(edge, getDescIdx(parent, parentCandidate), getDescIdx(child, childCandidate));
+    }
+    return cost;
+}
+
+bool GraphLayoutPlanner::solveChain(const std::vector<size_t>& chain) {
+    // Viterbi over the chain: the cost of the best assignment of the prefix ending with each candidate of the node
+    std::vector<std::vector<double>> cost(chain.size());
+    std::vector<std::vector<size_t>> prev(chain.size());
+    for (size_t pos = 0; pos < chain.size(); pos++) {
+        const auto node = chain[pos];
+        const auto candidates = nodes[node].candidates.size();
+        cost[pos].assign(candidates, std::numeric_limits<double>::max());
+        prev[pos].assign(candidates, 0);
+        for (size_t cand = 0; cand < candidates; cand++) {
+            const double unary = unaryCost(chain, pos, cand);
+            if (pos == 0) {
+                cost[pos][cand] = unary;
+                continue;
+            }
+            const auto prevNode = chain[pos - 1];
+            for (size_t prevCand = 0; prevCand < cost[pos - 1].size(); prevCand++) {
+                const double total = cost[pos - 1][prevCand] + transitionCost(prevNode, prevCand, node, cand) + unary;
+                if (total < cost[pos][cand]) {
+                    cost[pos][cand] = total;
+                    prev[pos][cand] = prevCand;
+                }
+            }
+        }
+    }
+
+    double currentCost = 0;
+    for (size_t pos = 0; pos < chain.size(); pos++) {
+        currentCost += unaryCost(chain, pos, nodes[chain[pos]].current);
+        if (pos > 0)
+            currentCost += transitionCost(chain[pos - 1], nodes[chain[pos - 1]].current, chain[pos], nodes[chain[pos]].current);
+    }
+
+    const auto& last = cost.back();
+    size_t best = std::min_element(last.begin(), last.end()) - last.begin();
+    // only the strict improvements are applied, so the passes over the DAG converge
+    if (last[best] >= currentCost - 1.0)
+        return false;
+
+    for (size_t pos = chain.size(); pos-- > 0;) {
+        nodes[chain[pos]].current = best;
+        best = prev[pos][best];
+    }
+    return true;
+}
+
+std::vector<std::vector<size_t>> GraphLayoutPlanner::buildChains() const {
+    // u -> v are linked if v is the only consumer of u and u is the only non-constant producer of v
+    std::vector<std::vector<size_t>> consumers(nodes.size()), producers(nodes.size());
+    for (const auto& edge : edges) {
+        auto& nodeConsumers = consumers[edge.parent];
+        if (std::find(nodeConsumers.begin(), nodeConsumers.end(), edge.child) == nodeConsumers.end())
+            nodeConsumers.push_back(edge.child);
+        auto& nodeProducers = producers[edge.child];
+        if (!edge.constant && std::find(nodeProducers.begin(), nodeProducers.end(), edge.parent) == nodeProducers.end())
+            nodeProducers.push_back(edge.parent);
+    }
+
+    const size_t none = std::numeric_limits<size_t>::max();
+    std::vector<size_t> next(nodes.size(), none);
+    std::vector<bool> linked(nodes.size(), false);
+    for (size_t u = 0; u < nodes.size(); u++) {
+        if (!nodes[u].plannable || consumers[u].size() != 1)
+            continue;
+        const auto v = consumers[u].front();
+        if (nodes[v].plannable && producers[v].size() == 1 && producers[v].front() == u) {
+            next[u] = v;
+            linked[v] = true;
+        }
+    }
+
+    // the nodes are in the topological order, so the chains are too
+    std::vector<std::vector<size_t>> chains;
+    for (size_t u = 0; u < nodes.size(); u++) {
+        if (!nodes[u].plannable || linked[u])
+            continue;
+        std::vector<size_t> chain;
+        for (auto v = u; v != none; v = next[v])
+            chain.push_back(v);
+        chains.push_back(chain);
+    }
+    return chains;
+}
+
+size_t GraphLayoutPlanner::countReorders() const {
+    size_t count = 0;
+    for (const auto& edge : edges) {
+        if (!edge.constant &&
+            needReorder(edge, getDescIdx(edge.parent, nodes[edge.parent].current), getDescIdx(edge.child, nodes[edge.child].current)))
+            count++;
+    }
+    return count;
+}
+
+GraphLayoutPlanner::Result GraphLayoutPlanner::run() {
+    Result result;
+    result.greedyReorders = countReorders();
+    result.plannedReorders = result.greedyReorders;
+
+    const auto chains = buildChains();
+    if (chains.empty())
+        return result;
+
+    std::vector<size_t> greedy(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++)
+        greedy[i] = nodes[i].current;
+
+    for (size_t pass = 0; pass < maxPasses; pass++) {
+        bool changed = false;
+        for (const auto& chain : chains)
+            changed |= solveChain(chain);
+        if (!changed)
+            break;
+    }
+
+    std::vector<bool> changed(nodes.size(), false);
+    for (size_t i = 0; i < nodes.size(); i++) {
+        auto& info = nodes[i];
+        if (info.plannable && info.current != greedy[i]) {
+            info.node->selectPrimitiveDescriptorByIndex(info.candidates[info.current]);
+            changed[i] = true;
+        }
+    }
+    reselectFixedNodes(changed);
+    result.plannedReorders = countReorders();
+    return result;
+}
+
+void GraphLayoutPlanner::reselectFixedNodes(std::vector<bool>& changed) {
+    // Concat and Split decide on the in-place execution by the selected descriptors of their neighbours and
+    // Eltwise follows the layout of its parents, so the selection of the nodes that weren't planned is re-run
+    // if the planning changed any neighbour. The nodes are in the topological order, so the parents of the node
+    // are final when it's selected again
+    static const std::vector<Type> reselectedTypes = {Type::Concatenation, Type::Split, Type::Eltwise};
+    for (size_t i = 0; i < nodes.size(); i++) {
+        auto& info = nodes[i];
+        if (info.plannable || info.candidates.empty() || info.node->isConstant() ||
+            std::find(reselectedTypes.begin(), reselectedTypes.end(), info.node->getType()) == reselectedTypes.end())
+            continue;
+        const bool neighbourChanged = std::any_of(info.edges.begin(), info.edges.end(), [&](size_t edgeIdx) {
+            const auto& edge = edges[edgeIdx];
+            return changed[edge.parent == i ? edge.child : edge.parent];
+        });
+        if (!neighbourChanged)
+            continue;
+
+        info.node->selectOptimalPrimitiveDescriptor();
+        const auto& descs = info.node->getSupportedPrimitiveDescriptors();
+        const int selectedIdx = static_cast<int>(info.node->getSelectedPrimitiveDescriptor() - descs.data());
+        if (selectedIdx != info.candidates.front()) {
+            info.candidates = {selectedIdx};
+            changed[i] = true;
+        }
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
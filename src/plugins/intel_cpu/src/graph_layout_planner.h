@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "node.h"
+#include "edge.h"
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Global assignment of the primitive descriptors of the graph nodes.
+ * The nodes select their descriptors one by one in the topological order looking only at the parents, so the layouts
+ * and the precisions of the neighbours may disagree and the reorders are inserted between them. The planner re-selects
+ * the descriptors of the same implementation type to minimize the estimated cost of the whole graph: the bytes moved
+ * by the reorders plus the kernel cost of the less preferable descriptors.
+ * The chains of the nodes are solved exactly by the dynamic programming, the rest of the DAG is handled by re-solving
+ * the chains one by one with the other nodes fixed until the cost stops decreasing.
+ * The in-place Concat and Split nodes aren't planned. Their selection is re-run after the planning of the neighbours,
+ * as well as the selection of the Eltwise nodes that weren't planned.
+ */
+class GraphLayoutPlanner {
+public:
+    struct Result {
+        size_t greedyReorders = 0;
+        size_t plannedReorders = 0;
+    };
+
+    GraphLayoutPlanner(const std::vector<NodePtr>& graphNodes, const std::vector<EdgePtr>& graphEdges);
+
+    /**
+     * @brief Re-selects the primitive descriptors of the nodes
+     * @return the estimated number of the reorders for the greedy selection and after the planning
+     */
+    Result run();
+
+private:
+    struct NodeInfo {
+        NodePtr node;
+        // indices of the supported primitive descriptors in the order of the node preference
+        std::vector<int> candidates;
+        size_t current = 0;
+        bool plannable = false;
+        size_t outputBytes = 0;
+        std::vector<size_t> edges;
+    };
+
+    struct EdgeInfo {
+        size_t parent;
+        size_t child;
+        int parentPort;
+        int childPort;
+        bool constant;
+    };
+
+    int getDescIdx(size_t node, size_t candidate) const {
+        return nodes[node].candidates[candidate];
+    }
+    bool needReorder(const EdgeInfo& edge, int parentDescIdx, int childDescIdx) const;
+    double edgeCost(const EdgeInfo& edge, int parentDescIdx, int childDescIdx) const;
+    double kernelCost(size_t node, size_t candidate) const;
+    double unaryCost(const std::vector<size_t>& chain, size_t pos, size_t candidate) const;
+    double transitionCost(size_t parent, size_t parentCandidate, size_t child, size_t childCandidate) const;
+    bool solveChain(const std::vector<size_t>& chain);
+    std::vector<std::vector<size_t>> buildChains() const;
+    size_t countReorders() const;
+    void reselectFixedNodes(std::vector<bool>& changed);
+
+    std::vector<NodeInfo> nodes;
+    std::vector<EdgeInfo> edges;
+    std::unordered_map<const Node*, size_t> nodeIdx;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -18,9 +18,12 @@
 #include "nodes/mvn.h"
 #include "nodes/transpose.h"
 #include "nodes/interpolate.h"
+#include "nodes/color_convert.h"
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/embedding_bag_sum.h"
+#include "nodes/memory.hpp"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -70,6 +73,18 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEmbeddingBagAndDequantization");
+    FuseEmbeddingBagAndDequantization(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseReadValueConcatAndAssign");
+    FuseReadValueConcatAndAssign(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -146,10 +161,18 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNormalizeL2AndSimpleOperation");
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "MergeSiblingReduces");
+    MergeSiblingReduces(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseReduceAndSimpleOperation");
     FuseReduceAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -685,6 +708,310 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseEmbeddingBagAndDequantization(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableEmbeddingBagNode = [](const NodePtr& node) {
+        return one_of(node->getType(), Type::EmbeddingBagOffsetsSum, Type::EmbeddingBagPackedSum, Type::EmbeddingSegmentsSum) &&
+               node->getInputShapeAtPort(0).isStatic() && node::EmbeddingBagSum::isJitSupported();
+    };
+
+    // Eltwise with a constant per-row second input: {1} or {rows, 1, ..., 1}
+    auto isSuitableDequantizationNode = [](const NodePtr& node, Algorithm alg, size_t rows) {
+        if (node->getType() != Type::Eltwise || node->getAlgorithm() != alg || node->getParentEdges().size() != 2 ||
+            node->getChildEdges().size() != 1 || !node->getFusedWith().empty())
+            return false;
+        const auto constNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (constNode->getType() != Type::Input || !constNode->isConstant() ||
+            constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& dims = node->getInputShapeAtPort(1).getDims();
+        const auto dataRank = node->getInputShapeAtPort(0).getRank();
+        if (dims.size() > dataRank)
+            return false;
+        for (size_t i = 0; i < dims.size(); i++) {
+            const bool rowAxis = i + dataRank - dims.size() == 0;
+            if (dims[i] != 1 && !(rowAxis && dims[i] == rows))
+                return false;
+        }
+        return true;
+    };
+
+    auto isSuitableConvertNode = [](const NodePtr& node) {
+        if (node->getType() != Type::Convert || node->getChildEdges().size() != 1 ||
+            !one_of(node->getOriginalInputPrecisionAtPort(0), Precision::I8, Precision::U8) ||
+            !one_of(node->getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16))
+            return false;
+        const auto table = node->getParentEdgesAtPort(0)[0]->getParent();
+        return table->getType() == Type::Input && table->isConstant();
+    };
+
+    // per-row values of the constant second input of the eltwise node
+    auto getRowValues = [](const NodePtr& node, size_t rows) {
+        const auto constNode = std::dynamic_pointer_cast<node::Input>(node->getParentEdgesAtPort(1)[0]->getParent());
+        if (!constNode || !constNode->getMemoryPtr())
+            IE_THROW() << "Cannot get constant input of node " << node->getName();
+        const auto data = reinterpret_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+        const bool perRow = node->getInputShapeAtPort(1).getElementsCount() == rows;
+        std::vector<float> values(rows);
+        for (size_t i = 0; i < rows; i++)
+            values[i] = perRow ? data[i] : data[0];
+        return values;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto embBag = graphNodes[i];
+        if (!isSuitableEmbeddingBagNode(embBag))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseEmbeddingBagAndDequantization_EmbeddingBagNode);
+
+        const auto rows = embBag->getInputShapeAtPort(0).getStaticDims()[0];
+        const auto multiply = embBag->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isSuitableDequantizationNode(multiply, Algorithm::EltwiseMultiply, rows))
+            continue;
+        auto parent = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        NodePtr subtract;
+        if (isSuitableDequantizationNode(parent, Algorithm::EltwiseSubtract, rows)) {
+            subtract = parent;
+            parent = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto convert = parent;
+        if (!isSuitableConvertNode(convert))
+            continue;
+
+        auto embBagNode = dynamic_cast<node::EmbeddingBagSum*>(embBag.get());
+        if (embBagNode == nullptr)
+            IE_THROW() << "Cannot get EmbeddingBag node " << embBag->getName();
+        embBagNode->fuseDequantization(getRowValues(multiply, rows),
+                                       subtract ? getRowValues(subtract, rows) : std::vector<float>{});
+
+        for (const auto& dqNode : {multiply, subtract}) {
+            if (!dqNode)
+                continue;
+            auto constEdge = dqNode->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(constEdge);
+            embBag->addOriginalLayer(dqNode->getOriginalLayers());
+            graph.DropNode(dqNode);
+        }
+        embBag->setOriginalInputPrecisionAtPort(0, convert->getOriginalInputPrecisionAtPort(0));
+        embBag->addOriginalLayer(convert->getOriginalLayers());
+        graph.DropNode(convert);
+    }
+}
+
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableFCNode = [](const NodePtr& node) {
+        if (node->getType() != Type::FullyConnected || !node->getFusedWith().empty() || !node->getDQScales().empty())
+            return false;
+        const auto& weightsShape = node->getInputShapeAtPort(1);
+        return weightsShape.getRank() == 2 && weightsShape.isStatic();
+    };
+
+    // Reshape of grouped weights [N, G, S] to [N, G * S]
+    auto isSuitableReshapeNode = [](const NodePtr& node) {
+        return node->getType() == Type::Reshape && node->isConstant() && node->getChildEdges().size() == 1 &&
+               node->getInputShapeAtPort(0).getRank() == 3 && node->getInputShapeAtPort(0).isStatic();
+    };
+
+    // Eltwise with a constant second input having one value per output channel and, for grouped weights, per group
+    auto isSuitableDecompressionNode = [](const NodePtr& node, Algorithm alg, const VectorDims& weightsDims) {
+        if (node->getType() != Type::Eltwise || node->getAlgorithm() != alg || node->getParentEdges().size() != 2 ||
+            node->getChildEdges().size() != 1 || !node->getFusedWith().empty())
+            return false;
+        const auto constNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        if (constNode->getType() != Type::Input || !constNode->isConstant() ||
+            constNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return false;
+        const auto& dims = node->getInputShapeAtPort(1).getDims();
+        const auto rank = weightsDims.size();
+        if (dims.size() > rank)
+            return false;
+        for (size_t i = 0; i < dims.size(); i++) {
+            const size_t axis = i + rank - dims.size();
+            if (dims[i] != 1 && !(axis == 0 && dims[i] == weightsDims[0]) && !(rank == 3 && axis == 1 && dims[i] == weightsDims[1]))
+                return false;
+        }
+        return true;
+    };
+
+    // the precisions and the ranks are checked by the same predicate as the one used to keep the decompression
+    auto isSuitableConvertNode = [](const NodePtr& node, const NodePtr& fc) {
+        if (node->getType() != Type::Convert || node->getChildEdges().size() != 1 ||
+            node->getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+            !FullyConnected::isSupportedWeightsDecompression(node->getOriginalInputPrecisionAtPort(0),
+                                                             fc->getOriginalInputPrecisionAtPort(0),
+                                                             fc->getInputShapeAtPort(0).getRank()))
+            return false;
+        const auto weights = node->getParentEdgesAtPort(0)[0]->getParent();
+        return weights->getType() == Type::Input && weights->isConstant();
+    };
+
+    // [N, groups] values of the constant second input of the eltwise node
+    auto getDecompressionValues = [](const NodePtr& node, const VectorDims& weightsDims) {
+        const auto constNode = std::dynamic_pointer_cast<node::Input>(node->getParentEdgesAtPort(1)[0]->getParent());
+        if (!constNode || !constNode->getMemoryPtr())
+            IE_THROW() << "Cannot get constant input of node " << node->getName();
+        const auto data = reinterpret_cast<const float*>(constNode->getMemoryPtr()->GetPtr());
+        auto dims = node->getInputShapeAtPort(1).getStaticDims();
+        dims.insert(dims.begin(), weightsDims.size() - dims.size(), 1);
+        const size_t channels = weightsDims[0];
+        const size_t groups = weightsDims.size() == 3 ? weightsDims[1] : 1;
+        const size_t groupDim = dims.size() == 3 ? dims[1] : 1;
+        std::vector<float> values(channels * groups);
+        for (size_t n = 0; n < channels; n++) {
+            for (size_t g = 0; g < groups; g++)
+                values[n * groups + g] = data[(dims[0] == 1 ? 0 : n * groupDim) + (groupDim == 1 ? 0 : g)];
+        }
+        return values;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto fc = graphNodes[i];
+        if (!isSuitableFCNode(fc))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseFCAndWeightsDecompression_FullyConnectedNode);
+
+        auto parent = fc->getParentEdgesAtPort(1)[0]->getParent();
+        NodePtr reshape;
+        if (isSuitableReshapeNode(parent)) {
+            reshape = parent;
+            parent = reshape->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto multiply = parent;
+        if (multiply->getType() != Type::Eltwise || multiply->getParentEdges().size() != 2)
+            continue;
+        const auto& weightsDims = multiply->getInputShapeAtPort(0).getDims();
+        if (weightsDims.size() != (reshape ? 3u : 2u) || !isSuitableDecompressionNode(multiply, Algorithm::EltwiseMultiply, weightsDims))
+            continue;
+        parent = multiply->getParentEdgesAtPort(0)[0]->getParent();
+        NodePtr subtract;
+        if (isSuitableDecompressionNode(parent, Algorithm::EltwiseSubtract, weightsDims)) {
+            subtract = parent;
+            parent = subtract->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto convert = parent;
+        if (!isSuitableConvertNode(convert, fc))
+            continue;
+
+        auto fcNode = dynamic_cast<node::FullyConnected*>(fc.get());
+        if (fcNode == nullptr)
+            IE_THROW() << "Cannot get FullyConnected node " << fc->getName();
+        fcNode->fuseDecompression(getDecompressionValues(multiply, weightsDims),
+                                  subtract ? getDecompressionValues(subtract, weightsDims) : std::vector<float>{},
+                                  reshape ? weightsDims[1] : 1);
+
+        for (const auto& dqNode : {multiply, subtract}) {
+            if (!dqNode)
+                continue;
+            auto constEdge = dqNode->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(constEdge);
+            fc->addOriginalLayer(dqNode->getOriginalLayers());
+            graph.DropNode(dqNode);
+        }
+        const auto weightsPrecision = convert->getOriginalInputPrecisionAtPort(0);
+        if (reshape) {
+            // the reshape is a memory reinterpretation of the compressed weights now
+            reshape->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshape->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+        fc->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+        fc->addOriginalLayer(convert->getOriginalLayers());
+        graph.DropNode(convert);
+    }
+}
+
+void GraphOptimizer::FuseReadValueConcatAndAssign(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // The state is zero filled on reset, so only a constant initializer may be dropped
+    auto isSuitableReadValueNode = [](const NodePtr& node) {
+        if (node->getType() != Type::MemoryInput || !node->isDynamicNode() || node->getChildEdges().size() != 1)
+            return false;
+        if (node->getParentEdges().empty())
+            return true;
+        const auto init = node->getParentEdgeAt(0)->getParent();
+        return init->getType() == Type::Input && init->isConstant() && init->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableConcatNode = [](const NodePtr& node, InferenceEngine::Precision precision) {
+        return node->getType() == Type::Concatenation && node->getParentEdges().size() == 2 && node->getFusedWith().empty() &&
+               node->getOriginalInputPrecisionAtPort(1) == precision && node->getOriginalOutputPrecisionAtPort(0) == precision;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto readValue = graphNodes[i];
+        if (!isSuitableReadValueNode(readValue))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseReadValueConcatAndAssign_ReadValueNode);
+
+        auto readValueNode = std::dynamic_pointer_cast<node::MemoryInput>(readValue);
+        if (!readValueNode)
+            IE_THROW() << "Cannot cast " << readValue->getName() << " to MemoryInput";
+
+        const auto precision = readValue->getOriginalOutputPrecisionAtPort(0);
+        auto stateEdge = readValue->getChildEdgeAt(0);
+        const auto concat = stateEdge->getChild();
+        if (stateEdge->getOutputNum() != 0 || !isSuitableConcatNode(concat, precision))
+            continue;
+
+        NodePtr assign;
+        for (const auto& edge : concat->getChildEdgesAtPort(0)) {
+            auto assignNode = std::dynamic_pointer_cast<node::MemoryOutput>(edge->getChild());
+            if (assignNode && assignNode->getId() == readValueNode->getId()) {
+                assign = edge->getChild();
+                break;
+            }
+        }
+        if (!assign)
+            continue;
+
+        const auto concatNode = std::dynamic_pointer_cast<node::Concat>(concat);
+        if (!concatNode)
+            IE_THROW() << "Cannot cast " << concat->getName() << " to Concat";
+        readValueNode->setAppendAxis(concatNode->getAxis());
+
+        // ReadValue takes the appended tensor instead of the initializer
+        if (!readValue->getParentEdges().empty()) {
+            auto initEdge = readValue->getParentEdgeAt(0);
+            graph.RemoveEdge(initEdge);
+        }
+        auto& graphEdges = graph.GetEdges();
+        auto appendedEdge = concat->getParentEdgeAt(1);
+        const auto appended = appendedEdge->getParent();
+        const auto appendedPort = appendedEdge->getInputNum();
+        graph.RemoveEdge(appendedEdge);
+        graph.RemoveEdge(stateEdge);
+
+        EdgePtr newEdge(new Edge(appended, readValue, appendedPort, 0));
+        graphEdges.push_back(newEdge);
+        appended->addEdge(newEdge);
+        readValue->inputShapes = {concat->getInputShapeAtPort(1)};
+        readValue->originalInputPrecisions = {precision};
+        readValue->outputShapes[0] = concat->getOutputShapeAtPort(0);
+
+        // the rest of the Concat consumers read the whole state, Assign becomes a no-op
+        for (auto edge : concat->getChildEdgesAtPort(0)) {
+            const auto child = edge->getChild();
+            const auto outNum = edge->getOutputNum();
+            graph.RemoveEdge(edge);
+            if (child == assign)
+                continue;
+
+            EdgePtr childEdge(new Edge(readValue, child, 0, outNum));
+            graphEdges.push_back(childEdge);
+            readValue->addEdge(childEdge);
+        }
+
+        readValue->addOriginalLayer(concat->getOriginalLayers());
+        readValue->addOriginalLayer(assign->getOriginalLayers());
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1593,6 +1920,58 @@ void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseColorConvertAndSimpleOperation(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](NodePtr node) {
+        return node->getType() == Type::ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableChildNode = [&](NodePtr parentNode, NodePtr childNode) {
+        if (!childNode->getFusedWith().empty())
+            return false;
+        auto colorConvertNode = dynamic_cast<ColorConvert*>(parentNode.get());
+        if (!colorConvertNode) {
+            IE_THROW() << "Cannot cast " << parentNode->getName() << " to ColorConvert";
+        }
+        return colorConvertNode->canFuse(childNode);
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation_ParentNode);
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildNode(parentNode, childNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation_ChildNode);
+
+        childNode->fuseInto(parentNode);
+
+        if (childNode->getType() == Type::Eltwise) {
+            auto parentEdges = childNode->parentEdges;
+            for (auto &parentEdge : parentEdges) {
+                auto p_edge = parentEdge.lock();
+                if (p_edge->getParent()->getType() == Type::ColorConvert)
+                    continue;
+
+                graph.RemoveEdge(p_edge);
+            }
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1633,6 +2012,93 @@ void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::MergeSiblingReduces(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableReduce = [](const NodePtr& node) {
+        return node->getType() == Type::Reduce && !node->isDropped() && node->getFusedWith().empty() &&
+               !node->getChildEdges().empty();
+    };
+
+    // x * x or x ^ 2 computed only for a reduction, which takes the output 'port' of the node 'input'
+    auto isSquareOf = [](const NodePtr& node, const NodePtr& input, int port) {
+        if (node->getType() != Type::Eltwise || !node->getFusedWith().empty() || node->getChildEdges().size() != 1)
+            return false;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto p_edge = node->getParentEdgesAtPort(i)[0];
+            if (p_edge->getParent() != input || p_edge->getInputNum() != port)
+                return false;
+        }
+        auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+        if (node->getAlgorithm() == Algorithm::EltwiseMultiply)
+            return node->getParentEdges().size() == 2;
+        return node->getAlgorithm() == Algorithm::EltwisePowerStatic &&
+               eltwise->getAlpha() == 2.f && eltwise->getBeta() == 1.f && eltwise->getGamma() == 0.f;
+    };
+
+    auto removeParentEdges = [&](const NodePtr& node) {
+        auto parentEdges = node->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge)
+                graph.RemoveEdge(p_edge);
+        }
+    };
+
+    auto merge = [&](const std::shared_ptr<Reduce>& host, const NodePtr& sibling, bool squaredInput) {
+        const int port = static_cast<int>(host->mergeSibling(*std::dynamic_pointer_cast<Reduce>(sibling), squaredInput));
+
+        auto childEdges = sibling->childEdges;
+        for (auto &childEdge : childEdges) {
+            auto c_edge = childEdge.lock();
+            if (!c_edge)
+                continue;
+            auto child = c_edge->getChild();
+            const int outNum = c_edge->getOutputNum();
+            graph.RemoveEdge(c_edge);
+
+            EdgePtr newEdge(new Edge(host, child, port, outNum));
+            graph.GetEdges().push_back(newEdge);
+            host->addEdge(newEdge);
+        }
+        removeParentEdges(sibling);
+        graph.DropNode(sibling);
+    };
+
+    for (auto& node : graphNodes) {
+        if (!isSuitableReduce(node))
+            continue;
+        auto host = std::dynamic_pointer_cast<Reduce>(node);
+        if (!host)
+            IE_THROW() << "Cannot cast " << node->getName() << " to Reduce node";
+
+        const auto dataEdge = node->getParentEdgesAtPort(0)[0];
+        const auto input = dataEdge->getParent();
+        const int port = dataEdge->getInputNum();
+
+        for (const auto& siblingEdge : input->getChildEdgesAtPort(port)) {
+            const auto sibling = siblingEdge->getChild();
+            if (sibling == node)
+                continue;
+
+            CPU_GRAPH_OPTIMIZER_SCOPE(MergeSiblingReduces_Sibling);
+
+            if (isSuitableReduce(sibling) && siblingEdge->getOutputNum() == 0 &&
+                host->canMergeSibling(*std::dynamic_pointer_cast<Reduce>(sibling), false)) {
+                merge(host, sibling, false);
+            } else if (isSquareOf(sibling, input, port)) {
+                const auto squaredReduce = sibling->getChildEdgeAt(0)->getChild();
+                if (isSuitableReduce(squaredReduce) && sibling->getChildEdgeAt(0)->getOutputNum() == 0 &&
+                    host->canMergeSibling(*std::dynamic_pointer_cast<Reduce>(squaredReduce), true)) {
+                    merge(host, squaredReduce, true);
+                    removeParentEdges(sibling);
+                    graph.DropNode(sibling);
+                }
+            }
+        }
+    }
+}
+
 void GraphOptimizer::FuseReduceAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1679,29 +2145,172 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSuitableParentNode = [](NodePtr node) {
-        return node->getType() == Type::Eltwise && node->getChildEdges().size() == 1;
+        return node->getType() == Type::Eltwise && !node->getChildEdges().empty();
     };
 
     auto isSuitableChildNode = [&](NodePtr parentNode, NodePtr childNode) {
         if (parentNode->isConstant() && !childNode->isConstant())
             return false;
+        if (parentNode->isDynamicNode() != childNode->isDynamicNode())
+            return false;
         for (auto &childParentEdge : childNode->getParentEdges()) {
             // WA to prevent unsupported reorder exception issue in some cases
             if (childParentEdge.lock()->getParent()->getType() == Type::Split) {
                 return false;
             }
+        }
 
-            // Avoid cycle dependencies
-            for (auto &parentParentEdge : parentNode->getParentEdges()) {
-                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
-                    return false;
+        return childNode->getFusedWith().empty();
+    };
+
+    auto getChildren = [](const NodePtr& node) {
+        std::vector<NodePtr> children;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto child = node->getChildEdgeAt(i)->getChild();
+            if (std::find(children.begin(), children.end(), child) == children.end())
+                children.push_back(child);
+        }
+        return children;
+    };
+
+    auto getPortsFrom = [](const NodePtr& node, const NodePtr& parent) {
+        std::vector<int> ports;
+        for (size_t port = 0; port < node->getParentEdges().size(); port++) {
+            if (node->getParentEdgesAtPort(port)[0]->getParent() == parent)
+                ports.push_back(static_cast<int>(port));
+        }
+        return ports;
+    };
+
+    // Returns the input port of the parent node the output port 'inNum' of 'node' is already connected to, -1 otherwise.
+    auto findParentInput = [](const NodePtr& parentNode, const NodePtr& node, int inNum) {
+        for (size_t i = 0; i < parentNode->getParentEdges().size(); i++) {
+            const auto edge = parentNode->getParentEdgeAt(i);
+            if (edge->getParent() == node && edge->getInputNum() == inNum)
+                return edge->getOutputNum();
+        }
+        return -1;
+    };
+
+    // Fuses the Eltwise child into the Eltwise parent node. The operands of the child are taken either from the
+    // results of the fused operations (the ports connected to the parent node, 'portOps' gives the index of
+    // the operation for them) or from the inputs of the parent node. An input the parent node already has
+    // (e.g. the common input of the branches of x * sigmoid(x)) is reused, the other ones are appended.
+    auto fuseEltwise = [&](const NodePtr& parentNode, const NodePtr& childNode, int fusingPort, const std::map<int, int>& portOps) {
+        auto childEltwise = std::dynamic_pointer_cast<Eltwise>(childNode);
+        if (!childEltwise)
+            IE_THROW() << "Cannot cast " << childNode->getName() << " to Eltwise node";
+
+        childNode->fuseInto(parentNode);
+        childNode->setFusingPort(fusingPort);
+
+        std::vector<int> fusedInputs;
+        auto childParentEdges = childNode->parentEdges;
+        for (size_t port = 0; port < childNode->getParentEdges().size(); port++) {
+            if (static_cast<int>(port) == fusingPort)
+                continue;
+
+            const auto p_edge = childNode->getParentEdgesAtPort(port)[0];
+            const auto input = p_edge->getParent();
+            if (input == parentNode) {
+                fusedInputs.push_back(-(portOps.at(port) + 1));
+                continue;
             }
+
+            int inputPort = findParentInput(parentNode, input, p_edge->getInputNum());
+            if (inputPort < 0) {
+                inputPort = static_cast<int>(parentNode->getParentEdges().size());
+                EdgePtr newEdge(new Edge(input, parentNode, p_edge->getInputNum(), inputPort));
+                graph.GetEdges().push_back(newEdge);
+                input->addEdge(newEdge);
+
+                parentNode->inputShapes.push_back(input->getOutputShapeAtPort(p_edge->getInputNum()));
+            }
+            fusedInputs.push_back(inputPort);
         }
+        childEltwise->setFusedInputs(fusedInputs);
 
-        if (!childNode->getFusedWith().empty())
+        for (auto &childParentEdge : childParentEdges) {
+            auto p_edge = childParentEdge.lock();
+            if (p_edge)
+                graph.RemoveEdge(p_edge);
+        }
+
+        auto children = childNode->childEdges;
+        for (auto &childEdge : children) {
+            auto c_edge = childEdge.lock();
+            if (!c_edge)
+                continue;
+            auto child = c_edge->getChild();
+            const int outNum = c_edge->getOutputNum();
+            graph.RemoveEdge(c_edge);
+
+            EdgePtr newEdge(new Edge(parentNode, child, 0, outNum));
+            graph.GetEdges().push_back(newEdge);
+            parentNode->addEdge(newEdge);
+
+            parentNode->outputShapes[0] = child->inputShapes[outNum];
+        }
+
+        graph.DropNode(childNode);
+    };
+
+    // All the ports of the child connected to the parent node take the result of the last fused operation.
+    auto fuseEltwiseChild = [&](const NodePtr& parentNode, const NodePtr& childNode) {
+        const auto ports = getPortsFrom(childNode, parentNode);
+        const int lastOp = static_cast<int>(parentNode->getFusedWith().size());
+        std::map<int, int> portOps;
+        for (const auto port : ports)
+            portOps[port] = lastOp;
+        fuseEltwise(parentNode, childNode, ports.front(), portOps);
+    };
+
+    /* Diamond of the parent node P and its children A and C, where C takes both P and A (e.g. y * sigmoid(y)):
+     * A is fused first, then C takes the result of A through the fusing port and the result of P kept by
+     * the kernel through the other ones.
+     */
+    auto tryFuseDiamond = [&](const NodePtr& parentNode, const std::vector<NodePtr>& children) {
+        if (children.size() != 2)
             return false;
 
-        return parentNode->canFuse(childNode);
+        for (size_t i = 0; i < 2; i++) {
+            const auto& first = children[i];
+            const auto& second = children[1 - i];
+            if (first->getType() != Type::Eltwise || second->getType() != Type::Eltwise)
+                continue;
+
+            const auto firstChildren = getChildren(first);
+            if (firstChildren.size() != 1 || firstChildren.front() != second)
+                continue;
+
+            if (!isSuitableChildNode(parentNode, first) || !isSuitableChildNode(parentNode, second) ||
+                !parentNode->canFuse(first) || !first->canFuse(second))
+                continue;
+
+            const auto secondPortsFromFirst = getPortsFrom(second, first);
+            const auto secondPortsFromParent = getPortsFrom(second, parentNode);
+            // the kernel keeps a single intermediate operand besides the fusing one
+            if (secondPortsFromFirst.size() > 1 && !secondPortsFromParent.empty())
+                continue;
+
+            const size_t inputsNum = parentNode->getParentEdges().size() +
+                                     first->getParentEdges().size() - getPortsFrom(first, parentNode).size() +
+                                     second->getParentEdges().size() - secondPortsFromFirst.size() - secondPortsFromParent.size();
+            if (inputsNum > MAX_ELTWISE_INPUTS)
+                continue;
+
+            const int parentOp = static_cast<int>(parentNode->getFusedWith().size());
+            fuseEltwiseChild(parentNode, first);
+
+            std::map<int, int> portOps;
+            for (const auto port : secondPortsFromFirst)
+                portOps[port] = parentOp + 1;
+            for (const auto port : secondPortsFromParent)
+                portOps[port] = parentOp;
+            fuseEltwise(parentNode, second, secondPortsFromFirst.front(), portOps);
+            return true;
+        }
+        return false;
     };
 
     auto parent = graphNodes.begin();
@@ -1714,23 +2323,24 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
 
         CPU_GRAPH_OPTIMIZER_SCOPE(FuseEltwiseAndSimple_ParentNode);
 
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-
-        if ((parentNode->isDynamicNode() && !childNode->isDynamicNode()) || (!parentNode->isDynamicNode() && childNode->isDynamicNode())) {
-            parent++;
+        const auto children = getChildren(parentNode);
+        if (children.size() != 1) {
+            if (!tryFuseDiamond(parentNode, children))
+                parent++;
             continue;
         }
 
-        if (!isSuitableChildNode(parentNode, childNode)) {
+        auto childNode = children.front();
+        if (!isSuitableChildNode(parentNode, childNode) || !parentNode->canFuse(childNode)) {
             parent++;
             continue;
         }
 
         CPU_GRAPH_OPTIMIZER_SCOPE(FuseEltwiseAndSimple_ChildNode);
 
-        childNode->fuseInto(parentNode);
-
         if (childNode->getType() == Type::FakeQuantize) {
+            childNode->fuseInto(parentNode);
+
             auto parentEdges = childNode->parentEdges;
             for (auto &parentEdge : parentEdges) {
                 auto p_edge = parentEdge.lock();
@@ -1742,68 +2352,9 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
 
             graph.DropNode(childNode);
         } else if (childNode->getType() == Type::Eltwise) {
-            auto children = childNode->childEdges;
-            auto parents = childNode->parentEdges;
-            auto initialParentInNum = parentNode->getParentEdges().size();
-
-            for (size_t i = 0; i < parents.size(); i++) {
-                auto p_edge = parents[i].lock();
-                if (!p_edge) continue;
-                auto parent = p_edge->getParent();
-                if (!parent) continue;
-
-                if (parent == parentNode) {
-                    for (size_t j = 0; j < children.size(); j++) {
-                        if (!children[j].lock())
-                            continue;
-                        auto child = children[j].lock()->getChild();
-                        if (!child)
-                            continue;
-
-                        EdgePtr &remEdge = p_edge;
-                        int inNum = 0;
-                        if (remEdge) {
-                            inNum = remEdge->getInputNum();
-                            graph.RemoveEdge(remEdge);
-                        }
-                        remEdge = children[j].lock();
-                        int outNum = 0;
-                        if (remEdge) {
-                            outNum = remEdge->getOutputNum();
-                            graph.RemoveEdge(remEdge);
-                        }
-                        EdgePtr newEdge(new Edge(parent, child, inNum, outNum));
-                        auto &graphEdges = graph.GetEdges();
-                        graphEdges.push_back(newEdge);
-                        parent->addEdge(newEdge);
-
-                        parent->outputShapes[inNum] = child->inputShapes[outNum];
-                    }
-                } else {
-                    EdgePtr &remEdge = p_edge;
-                    int inNum = 0;
-                    int outNum = parentNode->getParentEdges().size();
-                    if (remEdge) {
-                        inNum = remEdge->getInputNum();
-                        // Need to keep order for these algorithms
-                        if (childNode->getAlgorithm() == Algorithm::EltwiseMulAdd ||
-                            childNode->getAlgorithm() == Algorithm::EltwiseSelect) {
-                            outNum = initialParentInNum + remEdge->getOutputNum() - 1;
-                        }
-                        graph.RemoveEdge(remEdge);
-                    }
-
-                    EdgePtr newEdge(new Edge(parent, parentNode, inNum, outNum));
-                    auto &graphEdges = graph.GetEdges();
-                    graphEdges.push_back(newEdge);
-                    parent->addEdge(newEdge);
-
-                    parentNode->inputShapes.push_back(parent->getOutputShapeAtPort(inNum));
-                }
-            }
-
-            graph.DropNode(childNode);
+            fuseEltwiseChild(parentNode, childNode);
         } else {
+            childNode->fuseInto(parentNode);
             graph.DropNode(childNode);
         }
     }
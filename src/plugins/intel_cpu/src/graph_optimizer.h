@@ -34,11 +34,16 @@ private:
     void FuseConvolutionSumAndConvolutionSumActivation(Graph &graph);
     void FuseMVNAndSimpleOperation(Graph &graph);
     void FuseInterpolateAndSimpleOperation(Graph &graph);
+    void FuseColorConvertAndSimpleOperation(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
+    void MergeSiblingReduces(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
 
     void DropDoubleReorders(Graph& graph);
     void FuseConvolutionAndZeroPoints(Graph &graph);
+    void FuseEmbeddingBagAndDequantization(Graph &graph);
+    void FuseFCAndWeightsDecompression(Graph &graph);
+    void FuseReadValueConcatAndAssign(Graph &graph);
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph);
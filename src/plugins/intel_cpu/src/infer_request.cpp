@@ -39,24 +39,17 @@ void InferRequestBase::CreateInferRequest() {
 
     initBlobs();
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // The states are owned by the request and bound to the MemoryInput nodes of the graph before each inference,
+    // the nodes read and write the memory of the states directly.
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
-
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            auto state = memoryNode->makeState();
+            variableStates[memoryNode->getId()] = state;
+            memoryStates.emplace_back(state);
         }
     }
 }
@@ -92,48 +85,46 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+void InferRequestBase::bindStates() {
+    // the requests of the same stream share the graph, so the states are bound on each inference;
+    // the nodes of the state are found once per graph
+    auto& bindings = stateBindings[graph];
+    auto& outputBindings = assignBindings[graph];
+    if (bindings.empty()) {
+        for (auto &node : graph->GetNodes()) {
+            if (node->getType() == Type::MemoryInput) {
+                auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+                if (!cur_node) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
+                }
+                auto state = variableStates.find(cur_node->getId());
+                if (state == variableStates.end()) {
+                    IE_THROW() << "Cannot find the state of MemoryInput node " << node->getName();
                 }
+                bindings.emplace_back(cur_node, state->second);
+            } else if (node->getType() == Type::MemoryOutput) {
+                auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+                if (!cur_node) {
+                    IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+                }
+                // Assign of the fused ReadValue -> Concat -> Assign pattern has no inputs
+                auto state = variableStates.find(cur_node->getId());
+                if (state != variableStates.end() && !cur_node->getParentEdges().empty())
+                    outputBindings.emplace_back(cur_node, state->second);
             }
         }
     }
+
+    for (const auto& binding : bindings)
+        binding.first->assignState(binding.second);
+    // the producers of Assign write the next value of the state of this request
+    for (const auto& binding : outputBindings)
+        binding.first->assignState(binding.second);
 }
 
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
-    }
+void InferRequestBase::commitStates() {
+    for (const auto& state : variableStates)
+        state.second->commit();
 }
 
 void InferRequestBase::redefineMemoryForInputNodes() {
@@ -171,13 +162,13 @@ void InferRequestBase::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        bindStates();
     }
 
     graph->Infer(this);
 
     if (memoryStates.size() != 0) {
-        PullStates();
+        commitStates();
     }
 
     ThrowIfCanceled();
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "graph.h"
+#include "memory_state.h"
 #include <memory>
 #include <string>
 #include <map>
@@ -15,6 +16,10 @@ namespace intel_cpu {
 
 class ExecNetwork;
 class AsyncInferRequest;
+namespace node {
+class MemoryInput;
+class MemoryOutput;
+}   // namespace node
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
 public:
@@ -59,13 +64,17 @@ protected:
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
-    void PushStates();
-    void PullStates();
+    void bindStates();
+    void commitStates();
     void redefineMemoryForInputNodes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    // the states by the id of the variable, which includes the pair ID suffix
+    std::unordered_map<std::string, std::shared_ptr<VariableState>> variableStates;
+    std::unordered_map<const Graph*, std::vector<std::pair<node::MemoryInput*, std::shared_ptr<VariableState>>>> stateBindings;
+    std::unordered_map<const Graph*, std::vector<std::pair<node::MemoryOutput*, std::shared_ptr<VariableState>>>> assignBindings;
     AsyncInferRequest*                  _asyncRequest = nullptr;
 
 protected:
@@ -5,16 +5,292 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/common/cpu_memcpy.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "utils/general_utils.h"
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <numeric>
 
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+size_t getOuterSize(const VectorDims& dims, size_t axis) {
+    return std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+}
+
+size_t getInnerSize(const VectorDims& dims, size_t axis) {
+    return std::accumulate(dims.begin() + axis + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+}
+
+void copyRows(uint8_t* dst, size_t dstStride, const uint8_t* src, size_t srcStride, size_t rowSize, size_t rows) {
+    if (rowSize == 0 || rows == 0)
+        return;
+    if (dstStride == rowSize && srcStride == rowSize) {
+        cpu_memcpy(dst, src, rowSize * rows);
+        return;
+    }
+    parallel_for(rows, [&](size_t i) {
+        cpu_memcpy(dst + i * dstStride, src + i * srcStride, rowSize);
+    });
+}
+
+/**
+ * Copy data from one tensor into other.
+ * As is. Assume that data is dense tensor with same layout.
+ * @param dst destination memory object
+ * @param src source memory object
+ */
+void simple_copy(const Memory& dst, const Memory& src) {
+    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
+    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
+    if (src.GetDataType() == dst.GetDataType()) {
+        auto srcSizeInByte = src.GetSize();
+        auto dstSizeInByte = dst.GetSize();
+
+        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
+
+        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
+    } else {
+        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
+            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+    }
+}
+}   // namespace
+
+VariableState::VariableState(std::string name, const dnnl::engine& eng, MemoryDescPtr stateDesc, VectorDims initialDims,
+                             int appendAxis)
+    : InferenceEngine::IVariableStateInternal{name}, engine(eng), desc(std::move(stateDesc)),
+      precision(desc->getPrecision()), initialDims(std::move(initialDims)), appendAxis(appendAxis) {
+    for (auto& mem : store) {
+        mem = std::make_shared<Memory>(engine);
+        // the state of static shape has the layout of the consumers of ReadValue
+        if (desc->isDefined())
+            mem->Create(desc);
+    }
+    Reset();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    assigned = false;
+    if (desc->isDefined()) {
+        store[current]->FillZero();
+        dims = store[current]->getStaticDims();
+        return;
+    }
+    resetStore(initialDims);
+    store[current]->FillZero();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    Memory src(engine);
+    src.Create(MemoryDescUtils::convertToCpuBlockedMemoryDesc(newState->getTensorDesc()),
+               newState->cbuffer().as<const void*>());
+    if (desc->isDefined() && src.getStaticDims() != dims)
+        IE_THROW() << "Can't set the state " << name << " with shape " << vec2str(src.getStaticDims())
+                   << ", expected shape is " << vec2str(dims);
+    assigned = false;
+    write(src);
+}
+
+Blob::CPtr VariableState::GetState() const {
+    const auto value = getDenseState();
+    auto blob = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(value->getDesc()));
+    blob->allocate();
+    if (value->GetSize() != 0)
+        cpu_memcpy(blob->buffer(), value->GetData(), value->GetSize());
+    return blob;
+}
+
+bool VariableState::isDense() const {
+    return appendAxis < 0 || dims[appendAxis] == capacity || getOuterSize(dims, appendAxis) == 1;
+}
+
+MemoryPtr VariableState::getDenseState() const {
+    if (appendAxis < 0)
+        return store[current];
+
+    auto denseDesc = std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(dims));
+    if (isDense()) {
+        auto view = std::make_shared<Memory>(engine);
+        view->Create(denseDesc, store[current]->GetData());
+        return view;
+    }
+
+    if (!denseState)
+        denseState = std::make_shared<Memory>(engine);
+    denseState->redefineDesc(denseDesc);
+    gather(denseState->GetData());
+    return denseState;
+}
+
+MemoryDescPtr VariableState::getViewDesc(const VectorDims& viewDims) const {
+    if (appendAxis < 0)
+        return store[current]->getDescPtr();
+
+    const size_t axis = appendAxis;
+    if (viewDims[axis] > capacity)
+        IE_THROW() << "Can't view the state " << name << " with shape " << vec2str(viewDims)
+                   << ", the reserved length is " << capacity;
+
+    // [outer][capacity][inner] store viewed with the given shape
+    const size_t rank = viewDims.size();
+    VectorDims strides(rank, 1);
+    for (size_t i = rank - 1; i > 0; i--)
+        strides[i - 1] = strides[i] * (i == axis ? capacity : viewDims[i]);
+    VectorDims order(rank);
+    std::iota(order.begin(), order.end(), 0);
+    return std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(viewDims), viewDims, order, 0,
+                                                  VectorDims(rank, 0), strides);
+}
+
+void VariableState::resetStore(const VectorDims& newDims) {
+    auto newDesc = std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(newDims));
+    if (appendAxis >= 0) {
+        // the previous store may still be exposed to the consumers, so it's not reused
+        store[current] = std::make_shared<Memory>(engine);
+        store[current]->Create(newDesc);
+        capacity = newDims[appendAxis];
+    } else {
+        store[current]->redefineDesc(newDesc);
+    }
+    dims = newDims;
+}
+
+void VariableState::reserve(const VectorDims& newDims) {
+    const size_t axis = appendAxis;
+    if (newDims[axis] <= capacity)
+        return;
+
+    // geometric growth, so the stored rows are moved O(log(N)) times for N appended tokens
+    const size_t newCapacity = std::max(newDims[axis], 2 * capacity);
+    auto storeDims = newDims;
+    storeDims[axis] = newCapacity;
+    auto newStore = std::make_shared<Memory>(engine);
+    newStore->Create(std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(storeDims)));
+
+    const size_t innerSize = getInnerSize(dims, axis) * precision.size();
+    if (dims[axis] != 0) {
+        copyRows(static_cast<uint8_t*>(newStore->GetData()), newCapacity * innerSize,
+                 static_cast<const uint8_t*>(store[current]->GetData()), capacity * innerSize,
+                 dims[axis] * innerSize, getOuterSize(dims, axis));
+    }
+    store[current] = newStore;
+    capacity = newCapacity;
+}
+
+void VariableState::prepareAppend(const VectorDims& newDims) {
+    const size_t axis = appendAxis;
+    for (size_t i = 0; i < newDims.size(); i++) {
+        if (i != axis && newDims[i] != dims[i]) {
+            if (dims[axis] != 0)
+                IE_THROW() << "Can't append tensor to the state " << name << " with shape " << vec2str(dims)
+                           << ", the shape of the result is " << vec2str(newDims);
+            // the empty state takes the shape of the first appended tensor
+            dims = newDims;
+            dims[axis] = 0;
+            capacity = 0;
+            break;
+        }
+    }
+    reserve(newDims);
+}
+
+void VariableState::append(const Memory& src) {
+    const size_t axis = appendAxis;
+    const auto& srcDims = src.getStaticDims();
+    auto newDims = srcDims;
+    newDims[axis] += dims.size() == srcDims.size() ? dims[axis] : 0;
+    prepareAppend(newDims);
+
+    const size_t innerSize = getInnerSize(dims, axis) * precision.size();
+    auto dst = static_cast<uint8_t*>(store[current]->GetData()) + dims[axis] * innerSize;
+    copyRows(dst, capacity * innerSize, static_cast<const uint8_t*>(src.GetPtr()), srcDims[axis] * innerSize,
+             srcDims[axis] * innerSize, getOuterSize(dims, axis));
+    dims = newDims;
+}
+
+void VariableState::gather(void* dst) const {
+    const size_t axis = appendAxis;
+    const size_t innerSize = getInnerSize(dims, axis) * precision.size();
+    copyRows(static_cast<uint8_t*>(dst), dims[axis] * innerSize,
+             static_cast<const uint8_t*>(store[current]->GetData()), capacity * innerSize,
+             dims[axis] * innerSize, getOuterSize(dims, axis));
+}
+
+void VariableState::assign(const Memory& src) {
+    if (appendAxis >= 0) {
+        // the state appended in place has a single buffer
+        write(src);
+        return;
+    }
+
+    const auto& next = store[1 - current];
+    if (!desc->isDefined())
+        next->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(precision, src.getShape()));
+
+    // the producer of Assign may have written the value right to the next store
+    if (next->GetData() != src.GetData())
+        simple_copy(*next, src);
+    assigned = true;
+}
+
+void VariableState::commit() {
+    if (!assigned)
+        return;
+    current = 1 - current;
+    dims = store[current]->getStaticDims();
+    assigned = false;
+}
+
+void VariableState::write(const Memory& src) {
+    if (src.getDesc().getPrecision() == precision) {
+        write(src.GetPtr(), src.getStaticDims());
+        return;
+    }
+
+    Memory converted(engine);
+    converted.Create(std::make_shared<CpuBlockedMemoryDesc>(precision, src.getShape()));
+    cpu_convert(src.GetPtr(), converted.GetData(), src.getDesc().getPrecision(), precision,
+                src.getShape().getElementsCount());
+    write(converted.GetData(), converted.getStaticDims());
+}
+
+void VariableState::write(const void* data, const VectorDims& newDims) {
+    if (desc->isDefined()) {
+        cpu_memcpy(store[current]->GetData(), data, store[current]->GetSize());
+        return;
+    }
+
+    if (appendAxis < 0) {
+        resetStore(newDims);
+        cpu_memcpy(store[current]->GetData(), data, store[current]->GetSize());
+        return;
+    }
+
+    // keep the reserved capacity if only the length of the state has changed
+    const size_t axis = appendAxis;
+    bool sameRows = newDims.size() == dims.size();
+    for (size_t i = 0; sameRows && i < newDims.size(); i++)
+        sameRows = i == axis || newDims[i] == dims[i];
+    if (sameRows) {
+        dims[axis] = 0;
+        reserve(newDims);
+    } else {
+        resetStore(newDims);
+    }
+    dims = newDims;
+
+    const size_t innerSize = getInnerSize(dims, axis) * precision.size();
+    copyRows(static_cast<uint8_t*>(store[current]->GetData()), capacity * innerSize,
+             static_cast<const uint8_t*>(data), dims[axis] * innerSize,
+             dims[axis] * innerSize, getOuterSize(dims, axis));
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -5,26 +5,84 @@
 #pragma once
 
 #include "cpp_interfaces/interface/ie_ivariable_state_internal.hpp"
-#include "blob_factory.hpp"
 #include "cpu_memory.h"
-#include "nodes/common/cpu_memcpy.h"
-#include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * The state of a variable, which is owned by an infer request. The states of the request are bound to the ReadValue
+ * (MemoryInput) nodes of the graph before the inference, so the nodes read and write the state memory directly.
+ * The state is double buffered: Assign writes the next value of the state to the second buffer while the consumers
+ * of ReadValue may still read the current one, the buffers are swapped by commit() after the inference.
+ * The state appended in place (fused ReadValue -> Concat -> Assign) has a single buffer, which is reserved with
+ * a margin along the append axis, so appending doesn't move the data already stored: [outer][capacity][inner].
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    // the state of static shape keeps the layout of stateDesc, the dynamic one is planar
+    VariableState(std::string name, const dnnl::engine& eng, MemoryDescPtr stateDesc, VectorDims initialDims, int appendAxis);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const VectorDims& getDims() const {
+        return dims;
+    }
+    /**
+     * @brief Returns the memory of the current value, which has the margin along the append axis unless isDense()
+     */
+    const MemoryPtr& getStore() const {
+        return store[current];
+    }
+    /**
+     * @brief Returns the memory the next value is written to, it becomes current on commit()
+     */
+    const MemoryPtr& getNextStore() const {
+        return store[1 - current];
+    }
+    bool isDense() const;
+    /**
+     * @brief Returns the current value without the margin, it is copied only if the store is not dense
+     */
+    MemoryPtr getDenseState() const;
+    /**
+     * @brief Returns the descriptor of the value of the given shape as a view of the store reserved for it,
+     * the strides of the dimensions before the append axis keep the margin
+     */
+    MemoryDescPtr getViewDesc(const VectorDims& viewDims) const;
+
+    // Reserves the store for the state of the given shape, the empty state takes the shape
+    void prepareAppend(const VectorDims& newDims);
+    // Appends the tensor along the append axis in place
+    void append(const Memory& src);
+    // Writes the next value of the state, it becomes current on commit()
+    void assign(const Memory& src);
+    void commit();
+
+private:
+    void resetStore(const VectorDims& newDims);
+    void reserve(const VectorDims& newDims);
+    void gather(void* dst) const;
+    void write(const Memory& src);
+    void write(const void* data, const VectorDims& newDims);
+
+    dnnl::engine engine;
+    MemoryDescPtr desc;
+    InferenceEngine::Precision precision;
+    // state of dynamic shape is reset to the shape of the initializer
+    VectorDims initialDims;
+    int appendAxis;
+
+    MemoryPtr store[2];
+    size_t current = 0;
+    bool assigned = false;
+    VectorDims dims;
+    size_t capacity = 0;
+    mutable MemoryPtr denseState;
 };
 
 }   // namespace intel_cpu
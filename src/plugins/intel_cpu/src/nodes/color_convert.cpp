@@ -11,6 +11,8 @@
 #include <openvino/core/type.hpp>
 #include <ie/ie_parallel.hpp>
 #include "kernels/x64/jit_kernel.hpp"
+#include "eltwise.h"
+#include <utils/general_utils.h>
 
 using namespace InferenceEngine;
 using namespace dnnl::impl;
@@ -45,6 +47,12 @@ public:
 
     template <typename T>
     std::tuple<T, T, T> yuv_to_rgb(float y, float u, float v);
+
+    // Calls convertRow(batch, h, row) for every output row. The row is either the output memory or, if
+    // normalization is fused into the node, a thread local buffer which is normalized into the f32 output
+    // while it is still in cache. So the whole preprocessing chain takes a single pass through the memory.
+    template <typename T, typename F>
+    void forEachRow(size_t batch_size, size_t height, size_t width, const F & convertRow) const;
 };
 
 Converter::Converter(Node *node)
@@ -76,6 +84,33 @@ std::tuple<T, T, T> Converter::yuv_to_rgb(float y, float u, float v) {
     return std::make_tuple(r, g, b);
 }
 
+template <typename T, typename F>
+void Converter::forEachRow(size_t batch_size, size_t height, size_t width, const F & convertRow) const {
+    const size_t row_size = width * 3;
+
+    if (_fusedScales.empty()) {
+        T* dst = static_cast<T*>(output(0));
+        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+            convertRow(batch, h, dst + (batch * height + h) * row_size);
+        });
+        return;
+    }
+
+    float* dst = static_cast<float*>(output(0));
+    std::vector<std::vector<T>> rows(parallel_get_max_threads());
+    InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+        auto & row = rows[parallel_get_thread_num()];
+        row.resize(row_size);
+        convertRow(batch, h, row.data());
+
+        float* out = dst + (batch * height + h) * row_size;
+        for (size_t i = 0; i < row_size; i += 3) {
+            for (size_t c = 0; c < 3; c++)
+                out[i + c] = static_cast<float>(row[i + c]) * _fusedScales[c] + _fusedShifts[c];
+        }
+    });
+}
+
 #if defined(OPENVINO_ARCH_X86_64)
 struct jit_uni_converter : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_converter)
@@ -275,11 +310,13 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // fused Convert and normalization produce f32 output
+    const Precision outPrecision = node->getFusedWith().empty() ? precision : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -301,7 +338,6 @@ protected:
     template<typename T>
     void convert(const T* y,
                  const T* uv,
-                 T* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -320,28 +356,25 @@ RefConverter::RefConverter(Node *node)
 template<typename T>
 void RefConverter::convert(const T* y,
                            const T* uv,
-                           T* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
-    InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
-        auto y_ptr = y + batch * stride_y;
-        auto uv_ptr = uv + batch * stride_uv;
+    forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
+        auto y_ptr = y + batch * stride_y + h * width;
+        auto uv_ptr = uv + batch * stride_uv + (h / 2) * width;
 
         for (int w = 0; w < width; w++) {
-            auto y_index = h * width + w;
-            auto y_val = static_cast<float>(y_ptr[y_index]);
-            auto uv_index = (h / 2) * width + (w / 2) * 2;
+            auto y_val = static_cast<float>(y_ptr[w]);
+            auto uv_index = (w / 2) * 2;
             auto u_val = static_cast<float>(uv_ptr[uv_index]);
             auto v_val = static_cast<float>(uv_ptr[uv_index + 1]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            out[w * 3 + _colorFormat[0]] = r;
+            out[w * 3 + _colorFormat[1]] = g;
+            out[w * 3 + _colorFormat[2]] = b;
         }
     });
 }
@@ -360,9 +393,8 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
 
-        convert<T>(y, uv, dst,
+        convert<T>(y, uv,
                    batch_size,
                    height,
                    width,
@@ -381,13 +413,12 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, uv, dst,
+        convert<T>(y, uv,
                    batch_size,
                    height,
                    width,
@@ -563,16 +594,15 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = y + width * height;
-        T* dst = static_cast<T*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
 
-        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+        forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = out;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -598,16 +628,15 @@ public:
 
         const T* y = static_cast<const T*>(input(0));
         const T* uv = static_cast<const T*>(input(1));
-        T* dst = static_cast<T*>(output(0));
 
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 2;
 
-        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+        forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = args.v = uv + batch * stride_uv + (h / 2) * width;
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = out;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -625,11 +654,13 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // fused Convert and normalization produce f32 output
+    const Precision outPrecision = node->getFusedWith().empty() ? precision : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -652,7 +683,6 @@ protected:
     void convert(const T* y,
                  const T* u,
                  const T* v,
-                 T* dst,
                  size_t batch_size,
                  size_t height,
                  size_t width,
@@ -672,29 +702,25 @@ template<typename T>
 void RefConverter::convert(const T* y,
                            const T* u,
                            const T* v,
-                           T* dst,
                            size_t batch_size,
                            size_t height,
                            size_t width,
                            size_t stride_y,
                            size_t stride_uv) {
-    InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
-        T* out = dst + batch * width * height * 3;
-        auto y_ptr = y + batch * stride_y;
-        auto u_ptr = u + batch * stride_uv;
-        auto v_ptr = v + batch * stride_uv;
+    forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
+        auto y_ptr = y + batch * stride_y + h * width;
+        auto u_ptr = u + batch * stride_uv + (h / 2) * (width / 2);
+        auto v_ptr = v + batch * stride_uv + (h / 2) * (width / 2);
 
         for (int w = 0; w < width; w++) {
-            auto y_index = h * width + w;
-            auto y_val = static_cast<float>(y_ptr[y_index]);
-            auto uv_index = (h / 2) * (width / 2) + w / 2;
-            auto u_val = static_cast<float>(u_ptr[uv_index]);
-            auto v_val = static_cast<float>(v_ptr[uv_index]);
+            auto y_val = static_cast<float>(y_ptr[w]);
+            auto u_val = static_cast<float>(u_ptr[w / 2]);
+            auto v_val = static_cast<float>(v_ptr[w / 2]);
             T r, g, b;
             std::tie(r, g, b) = yuv_to_rgb<T>(y_val, u_val, v_val);
-            out[y_index * 3 + _colorFormat[0]] = r;
-            out[y_index * 3 + _colorFormat[1]] = g;
-            out[y_index * 3 + _colorFormat[2]] = b;
+            out[w * 3 + _colorFormat[0]] = r;
+            out[w * 3 + _colorFormat[1]] = g;
+            out[w * 3 + _colorFormat[2]] = b;
         }
     });
 }
@@ -714,9 +740,8 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
 
-        convert<T>(y, u, v, dst,
+        convert<T>(y, u, v,
                    batch_size,
                    height,
                    width,
@@ -736,13 +761,12 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
         const size_t width = dims[W_DIM];
 
-        convert<T>(y, u, v, dst,
+        convert<T>(y, u, v,
                    batch_size,
                    height,
                    width,
@@ -914,17 +938,16 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = y + width * height;
         const T* v = y + 5 * width * height / 4;
-        T* dst = static_cast<T*>(output(0));
 
         const size_t stride_y = height * width * 3 / 2;
         const size_t stride_uv = height * width * 3 / 2;
 
-        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+        forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = u + batch * stride_uv + (h / 2) * (width / 2);
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = out;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -947,7 +970,6 @@ public:
         const T* y = static_cast<const T*>(input(0));
         const T* u = static_cast<const T*>(input(1));
         const T* v = static_cast<const T*>(input(2));
-        T* dst = static_cast<T*>(output(0));
 
         const size_t batch_size = dims[N_DIM];
         const size_t height = dims[H_DIM];
@@ -956,12 +978,12 @@ public:
         const size_t stride_y = height * width;
         const size_t stride_uv = height * width / 4;
 
-        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+        forEachRow<T>(batch_size, height, width, [&](int batch, int h, T* out) {
             typename jit_uni_converter::Params args;
             args.y = y + batch * stride_y + h * width;
             args.u = u + batch * stride_uv + (h / 2) * (width / 2);
             args.v = v + batch * stride_uv + (h / 2) * (width / 2);
-            args.dst = dst + (batch * width * height + h * width) * 3;
+            args.dst = out;
             args.width = width;
             args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
             kernel(args);
@@ -1037,6 +1059,11 @@ const VectorDims & ColorConvert::Converter::inputDims(size_t idx) const {
     return _node->getParentEdgesAtPort(idx)[0]->getMemory().getStaticDims();
 }
 
+void ColorConvert::Converter::setFusedScaleShift(const std::vector<float> & scales, const std::vector<float> & shifts) {
+    _fusedScales = scales;
+    _fusedShifts = shifts;
+}
+
 bool ColorConvert::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     Algorithm alg;
     std::tie(alg, errorMessage) = getAlgorithmFor(op);
@@ -1157,6 +1184,27 @@ void ColorConvert::createPrimitive() {
                                             .at(algorithm)
                                             .at(precision)
                                             .at(isSinglePlane)(this));
+
+        if (!fusedWith.empty()) {
+            // Fold the fused per-channel Eltwise chain into a single scale and shift per channel
+            std::vector<float> scales(3, 1.f), shifts(3, 0.f);
+            for (const auto & node : fusedWith) {
+                const auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+                if (!eltwise)
+                    continue;
+                const auto & eltwiseScales = eltwise->getScales();
+                const auto & eltwiseShifts = eltwise->getShifts();
+                if (!one_of(eltwiseScales.size(), 1u, 3u) || eltwiseShifts.size() != eltwiseScales.size())
+                    IE_THROW() << getTypeStr() + " node with name '" + getName() + "' "
+                               << "has unsupported fused node " << node->getName();
+                for (size_t c = 0; c < 3; c++) {
+                    const size_t idx = eltwiseScales.size() == 1 ? 0 : c;
+                    scales[c] *= eltwiseScales[idx];
+                    shifts[c] = shifts[c] * eltwiseScales[idx] + eltwiseShifts[idx];
+                }
+            }
+            _impl->setFusedScaleShift(scales, shifts);
+        }
     }
 }
 
@@ -1167,6 +1215,42 @@ void ColorConvert::execute(dnnl::stream strm) {
     _impl->execute(strm);
 }
 
+bool ColorConvert::hasF32Output() const {
+    if (getOriginalInputPrecisionAtPort(0) == Precision::FP32)
+        return true;
+    return std::any_of(fusedWith.begin(), fusedWith.end(), [](const NodePtr & node) {
+        return node->getType() == Type::Convert;
+    });
+}
+
+bool ColorConvert::canFuse(const NodePtr& node) const {
+    // Only u8->f32 Convert and per-channel normalization are fused, they are produced by
+    // the preprocessing convert_element_type(), mean() and scale() steps.
+    // The NHWC->NCHW Transpose of convert_layout() is not fused: it changes the output shape of the node,
+    // which is inferred from the ColorConvert operation, so it stays a separate Transpose node.
+    if (node->getType() == Type::Convert) {
+        return fusedWith.empty() &&
+               getOriginalInputPrecisionAtPort(0) == Precision::U8 &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
+    }
+    if (node->getType() == Type::Eltwise) {
+        return hasF32Output() &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               one_of(node->getAlgorithm(), Algorithm::EltwiseAdd,
+                                            Algorithm::EltwiseSubtract,
+                                            Algorithm::EltwiseMultiply,
+                                            Algorithm::EltwiseDivide,
+                                            Algorithm::EltwiseMulAdd,
+                                            Algorithm::EltwisePowerStatic) &&
+               node->canBePerformedAsScaleShift(this);
+    }
+    return false;
+}
+
+int ColorConvert::getFusingAxis() const {
+    return Converter::C_DIM;
+}
+
 bool ColorConvert::created() const {
     return getType() == Type::ColorConvert;
 }
@@ -27,12 +27,15 @@ public:
     bool created() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    bool canFuse(const NodePtr& node) const override;
+    int getFusingAxis() const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
     void initSupportedNV12Impls();
     void initSupportedI420Impls();
+    bool hasF32Output() const;
 
 private:
     using ConverterBuilder = std::function<Converter*(Node *)>;
@@ -68,11 +71,16 @@ public:
     const void * input(size_t idx) const;
     void * output(size_t idx) const;
     const VectorDims & inputDims(size_t idx) const;
+    void setFusedScaleShift(const std::vector<float> & scales, const std::vector<float> & shifts);
     virtual void execute(dnnl::stream strm) = 0;
 
 protected:
     Node *_node;
     ColorFormat _colorFormat;   // RGB: {0,1,2}, BGR: {2,1,0}
+    // Per-channel normalization of the fused operations: out[c] = rgb[c] * scale[c] + shift[c].
+    // Empty if there is nothing fused.
+    std::vector<float> _fusedScales;
+    std::vector<float> _fusedShifts;
 };
 
 }   // namespace node
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_blocked.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace InferenceEngine::Extensions::Cpu;
+
+namespace ov {
+namespace intel_cpu {
+
+void NmsBoxes::resize(size_t size) {
+    m_size = size;
+    m_c0.resize(size);
+    m_c1.resize(size);
+    m_c2.resize(size);
+    m_c3.resize(size);
+    m_area.resize(size);
+}
+
+void NmsBoxes::iou(const nms_box& ref, size_t begin, size_t end, const nms_iou_conf& conf, float* dst) const {
+    XARCH::nms_iou(ref, view(), begin, end, conf, dst);
+}
+
+void NmsBlockedSelector::select(const NmsBoxes& candidates, size_t candidatesNum, size_t maxSelected, float iouThreshold,
+                                const nms_iou_conf& conf, std::vector<size_t>& selected) {
+    selected.clear();
+    candidatesNum = (std::min)(candidatesNum, candidates.size());
+    maxSelected = (std::min)(maxSelected, candidatesNum);
+    if (maxSelected == 0)
+        return;
+
+    if (m_selectedBoxes.size() < maxSelected)
+        m_selectedBoxes.resize(maxSelected);
+    m_iou.resize(blockSize);
+
+    auto anySuppressing = [&](size_t count) {
+        bool result = false;
+        for (size_t j = 0; j < count; j++)
+            result |= m_iou[j] >= iouThreshold;
+        return result;
+    };
+
+    size_t selectedNum = 0;
+    for (size_t blockBegin = 0; blockBegin < candidatesNum; blockBegin += blockSize) {
+        const size_t blockEnd = (std::min)(blockBegin + blockSize, candidatesNum);
+        uint64_t suppressed = 0;
+
+        // the boxes selected before the block
+        for (size_t i = blockBegin; i < blockEnd; i++) {
+            const auto box = candidates.get(i);
+            for (size_t begin = 0; begin < selectedNum; begin += blockSize) {
+                const size_t end = (std::min)(begin + blockSize, selectedNum);
+                m_selectedBoxes.iou(box, begin, end, conf, m_iou.data());
+                if (anySuppressing(end - begin)) {
+                    suppressed |= uint64_t(1) << (i - blockBegin);
+                    break;
+                }
+            }
+        }
+
+        // the block itself: each selected candidate suppresses the next ones in the block
+        for (size_t i = blockBegin; i < blockEnd; i++) {
+            if ((suppressed >> (i - blockBegin)) & 1)
+                continue;
+            const auto box = candidates.get(i);
+            selected.push_back(i);
+            m_selectedBoxes.set(selectedNum++, box.c0, box.c1, box.c2, box.c3, box.area);
+            if (selectedNum == maxSelected)
+                return;
+
+            candidates.iou(box, i + 1, blockEnd, conf, m_iou.data());
+            for (size_t j = i + 1; j < blockEnd; j++) {
+                if (m_iou[j - i - 1] >= iouThreshold)
+                    suppressed |= uint64_t(1) << (j - blockBegin);
+            }
+        }
+    }
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "nodes/nms_iou.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Boxes of a single batch and class in SoA layout, so that IoU of a box with a range of the boxes is vectorized.
+ * The candidates are stored in the order of scores.
+ */
+class NmsBoxes {
+public:
+    void resize(size_t size);
+    size_t size() const {
+        return m_size;
+    }
+
+    void set(size_t i, float c0, float c1, float c2, float c3, float area) {
+        m_c0[i] = c0;
+        m_c1[i] = c1;
+        m_c2[i] = c2;
+        m_c3[i] = c3;
+        m_area[i] = area;
+    }
+    InferenceEngine::Extensions::Cpu::nms_box get(size_t i) const {
+        return {m_c0[i], m_c1[i], m_c2[i], m_c3[i], m_area[i]};
+    }
+    InferenceEngine::Extensions::Cpu::nms_boxes view() const {
+        return {m_c0.data(), m_c1.data(), m_c2.data(), m_c3.data(), m_area.data()};
+    }
+
+    // IoU of the box 'ref' with the boxes [begin, end)
+    void iou(const InferenceEngine::Extensions::Cpu::nms_box& ref, size_t begin, size_t end,
+             const InferenceEngine::Extensions::Cpu::nms_iou_conf& conf, float* dst) const;
+
+private:
+    size_t m_size = 0;
+    std::vector<float> m_c0, m_c1, m_c2, m_c3, m_area;
+};
+
+/**
+ * Greedy hard suppression of the first 'candidatesNum' sorted candidates: a candidate is selected if its IoU with
+ * each of the selected boxes is below the threshold. The candidates are processed by blocks: first each of them
+ * is checked against the boxes selected before the block, then the block is resolved with the bitmask of IoU
+ * inside the block, which is computed for the selected candidates only.
+ * Returns the positions of the selected candidates, at most 'maxSelected'.
+ */
+class NmsBlockedSelector {
+public:
+    void select(const NmsBoxes& candidates, size_t candidatesNum, size_t maxSelected, float iouThreshold,
+                const InferenceEngine::Extensions::Cpu::nms_iou_conf& conf, std::vector<size_t>& selected);
+
+private:
+    static constexpr size_t blockSize = 64;
+
+    NmsBoxes m_selectedBoxes;
+    std::vector<float> m_iou;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
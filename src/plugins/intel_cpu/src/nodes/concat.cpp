@@ -86,12 +86,11 @@ void Concat::getSupportedDescriptors() {
         }
     }
 
-    // we need the first dims before axis to be 1 to avoid the reorder in the edge between the first parent and this concat
+    // the inputs are placed into the output memory as the strided views, the views with the dims before the axis
+    // not equal to 1 are selected only if the producers can write through the strides (see isInPlaceApplicable)
     // TODO [DS]: inplace
     if (!isDynamicNode()) {
-        const auto& childDims = outputShapes[0].getStaticDims();
-        if (std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return  dim == 1; }))
-            canBeInPlace = true;
+        canBeInPlace = true;
     }
 }
 
@@ -167,9 +166,7 @@ void Concat::initSupportedPrimitiveDescriptors() {
             }
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
-        if (itr->first != LayoutType::nspc) {
-            pdIndexesToReuse.push_back(supportedPrimitiveDescriptors.size() - 1);
-        }
+        pdIndexesToReuse.push_back(supportedPrimitiveDescriptors.size() - 1);
     }
 
     // required to prevent incorrect memory sharing of a constant with other tensors on edges
@@ -192,6 +189,7 @@ void Concat::initSupportedPrimitiveDescriptors() {
         const auto &order = denseOutDesc->getOrder();
         const auto &blkDims = denseOutDesc->getBlockDims();
         auto numOfDim = blkDims.size();
+        const auto realAxis = inverseOrder(order, axis);
 
         SizeVector offsets(numOfDim, 0lu);
         SizeVector strides(numOfDim);
@@ -200,7 +198,7 @@ void Concat::initSupportedPrimitiveDescriptors() {
         BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK; // any offset
 
         for (size_t i = 2; i <= numOfDim; i++) {
-            if (numOfDim - i < axis) {
+            if (numOfDim - i < realAxis) {
                 strides[numOfDim - i] = Shape::UNDEFINED_DIM;
                 mask.reset(numOfDim - i); // any strides on certain axis
             } else {
@@ -310,7 +308,8 @@ void Concat::selectOptimalPrimitiveDescriptor() {
 
     for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); ++i) {
         if (supportedPrimitiveDescriptors[i].getConfig().outConfs[0].getMemDesc()->hasLayoutType(convertTo)) {
-            if (IMPLICATION(supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::unknown, canBeInPlace)) {
+            if (IMPLICATION(supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::unknown,
+                            isInPlaceApplicable(supportedPrimitiveDescriptors[i].getConfig()))) {
                 canSelectPrimitive.push_back(i);
             }
         }
@@ -331,7 +330,8 @@ void Concat::selectOptimalPrimitiveDescriptor() {
 
     // if there are no matching data layouts, select first optimized implementation
     for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
-        if (canBeInPlace && supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::unknown) {
+        if (supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::unknown &&
+            isInPlaceApplicable(supportedPrimitiveDescriptors[i].getConfig())) {
             selectPrimitiveDescriptorByIndex(static_cast<int>(i));
             return;
         }
@@ -340,6 +340,33 @@ void Concat::selectOptimalPrimitiveDescriptor() {
     selectPrimitiveDescriptorByIndex(0);
 }
 
+bool Concat::isInPlaceApplicable(const NodeConfig& config) const {
+    if (!canBeInPlace)
+        return false;
+
+    const auto outDesc = config.outConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+    const auto& blkDims = outDesc->getBlockDims();
+    const auto realAxis = inverseOrder(outDesc->getOrder(), axis);
+    // the views are dense if the dims before the axis are equal to 1, so any producer may write into them
+    if (std::all_of(blkDims.begin(), blkDims.begin() + realAxis, [](size_t dim) { return dim == 1; }))
+        return true;
+
+    // otherwise at least one producer has to accept the strides of the output on the outer dims,
+    // the rest of the inputs are copied into the views by the reorders which is not worse than the concat itself
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto parentEdge = getParentEdgeAt(i);
+        const auto parentPd = parentEdge->getParent()->getSelectedPrimitiveDescriptor();
+        const int inputNum = parentEdge->getInputNum();
+        if (parentPd == nullptr || inputNum < 0 || inputNum >= parentPd->getConfig().outConfs.size())
+            continue;
+
+        const auto& parentConf = parentPd->getConfig().outConfs[inputNum];
+        if (parentConf.getPortDesc()->isCompatible(*config.inConfs[i].getPortDesc()))
+            return true;
+    }
+    return false;
+}
+
 bool Concat::created() const {
     return getType() == Type::Concatenation;
 }
@@ -495,6 +522,8 @@ void Concat::initOptimalPrimitiveDescriptor() {
             config.outConfs[i].setMemDesc(config.outConfs[i].getMemDesc());
         }
         auto firstOutBlockingDesc = config.outConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+        const auto& outStrides = firstOutBlockingDesc->getStrides();
+        const auto realAxis = inverseOrder(firstOutBlockingDesc->getOrder(), axis);
         size_t offset = 0;
         for (size_t i = 0; i < config.inConfs.size(); i++) {
             auto oldDesc = config.inConfs[i].getMemDesc();
@@ -508,25 +537,11 @@ void Concat::initOptimalPrimitiveDescriptor() {
                     inpBlockingDesc->getOrder(),
                     firstOutBlockingDesc->getOffsetPadding() + offset,
                     firstOutBlockingDesc->getOffsetPaddingToData(),
-                    firstOutBlockingDesc->getStrides()),
+                    outStrides),
                 BLOCKED_DESC_FULL_MASK);
-            size_t axisSize = 1;
-
-            auto firstInpBlockingDesc = config.inConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
-            if (firstInpBlockingDesc->hasLayoutType(LayoutType::nspc)) {
-                // This is more general and works for any "direct" Layout (such as nchw or nhwc), but it doesn't work for blocked
-                size_t realAxis = inverseOrder(firstInpBlockingDesc->getOrder(), axis);
-                for (size_t j = realAxis; j < inpBlockingDesc->getBlockDims().size(); j++) {
-                    size_t jj = firstInpBlockingDesc->getOrder()[j];
-                    axisSize *= inpBlockingDesc->getBlockDims()[jj];
-                }
-            } else {
-                // This works for nchw and nchw8c/nchw16c
-                for (size_t j = axis; j < inpBlockingDesc->getBlockDims().size(); j++) {
-                    axisSize *= inpBlockingDesc->getBlockDims()[j];
-                }
-            }
-            offset += axisSize;
+            // the next view starts after the current one along the axis, it works for the plain, nspc and blocked layouts
+            // as the axis dim is the outermost one of the view in the memory order
+            offset += inpBlockingDesc->getBlockDims()[realAxis] * outStrides[realAxis];
         }
         initDescriptor(config);
     }
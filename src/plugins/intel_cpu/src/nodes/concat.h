@@ -28,6 +28,9 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
 
     bool isOptimized() const;
+    size_t getAxis() const {
+        return axis;
+    }
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
@@ -41,7 +44,8 @@ private:
     bool canBeInPlace = false;
     bool canOptimizeNspc = false;
     void execRef();
-    size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    static size_t inverseOrder(const InferenceEngine::SizeVector& order, size_t axis);
+    bool isInPlaceApplicable(const NodeConfig& config) const;
     void execNspcSpecCase();
     std::vector<VectorDims> inputStrides;
     std::vector<size_t> nelemToCopy; // byte moved in each iter
@@ -256,8 +256,10 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
     explicit jit_uni_eltwise_generic(const jit_eltwise_params& jep,
                                      const std::vector<Eltwise::EltwiseData>& eltwise_data,
                                      const std::vector<ov::intel_cpu::Type>& ops_list,
+                                     const std::vector<int>& post_op_inputs,
                                      const dnnl::post_ops& post_ops)
-    : jit_uni_eltwise_kernel(jep), jit_generator(jit_name()), eltwise_data_(eltwise_data), ops_list_(ops_list), post_ops_(post_ops) {}
+    : jit_uni_eltwise_kernel(jep), jit_generator(jit_name()), eltwise_data_(eltwise_data), ops_list_(ops_list),
+      post_op_inputs_(post_op_inputs), post_ops_(post_ops) {}
 
     void create_ker() override {
         jit_generator::create_kernel();
@@ -286,8 +288,13 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
 
         const auto &jep = jep_;
 
+        init_saved_results();
+
         this->preamble();
 
+        if (saved_results_num_)
+            sub(rsp, saved_results_num_ * vlen);
+
         const int offset_count = jep.input_size - 1;
 
         // ptrs initializing
@@ -495,6 +502,9 @@ struct jit_uni_eltwise_generic : public jit_uni_eltwise_kernel, public jit_gener
 
         L(tail_loop_end_label);
 
+        if (saved_results_num_)
+            add(rsp, saved_results_num_ * vlen);
+
         this->postamble();
 
         if (uni_vcvtneps2bf16)
@@ -543,6 +553,8 @@ private:
 
     Vmm vmm_dst = Vmm(9);
     Xmm xmm_dst = Xmm(9);
+    // the first register after the inputs ones
+    Vmm vmm_result = Vmm(1 + MAX_ELTWISE_INPUTS);
 
     Vmm vmm_d_weights = Vmm(12);
     Vmm vmm_d_bias = Vmm(13);
@@ -557,8 +569,13 @@ private:
 
     const std::vector<Eltwise::EltwiseData>& eltwise_data_;
     const std::vector<ov::intel_cpu::Type>& ops_list_;
+    const std::vector<int>& post_op_inputs_;
     const dnnl::post_ops& post_ops_;
 
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    std::vector<int> saved_results_;
+    int saved_results_num_ = 0;
+
     std::shared_ptr<jit_emitter> create_eltwise_emitter(const Eltwise::EltwiseData& data, Precision exec_prec) {
         EltwiseEmitterContext ctx = {
             nullptr,
@@ -634,10 +651,33 @@ private:
         out_idxs.push_back(vmm_dst.getIdx());
 
         eltwise_emitter->emit_code(in_idxs, out_idxs, aux_idxs);
+        save_result(0);
+    }
+
+    // The results of the operations used by the fused operations other than the next one are kept on the stack.
+    void init_saved_results() {
+        saved_results_.assign(ops_list_.size(), -1);
+        size_t input_idx = 0;
+        for (int i = 1, eltwise_post_op_idx = 0; i < ops_list_.size(); i++) {
+            if (ops_list_[i] != ov::intel_cpu::Type::Eltwise)
+                continue;
+            for (int j = 1; j < post_op_emitters[eltwise_post_op_idx]->get_inputs_num(); j++) {
+                const int input = post_op_inputs_[input_idx++];
+                const int op = -input - 1;
+                if (input < 0 && op != i - 1 && saved_results_[op] < 0)
+                    saved_results_[op] = saved_results_num_++;
+            }
+            eltwise_post_op_idx++;
+        }
+    }
+
+    inline void save_result(int op) {
+        if (saved_results_[op] >= 0)
+            uni_vmovups(ptr[rsp + saved_results_[op] * vlen], vmm_dst);
     }
 
     inline void apply_post_ops(bool is_scalar, int offset = 0) {
-        int input_idx = eltwise_emitter->get_inputs_num();
+        int input_idx = 0;
         int eltwise_post_op_idx = 0;
         int quantization_post_op_idx = 0;
         for (int i = 1; i < ops_list_.size(); i++) {
@@ -645,8 +685,21 @@ private:
                 std::vector<size_t> in_idxs;
                 std::vector<size_t> aux_idxs;
                 in_idxs.push_back(vmm_dst.getIdx());
-                for (int j = 1; j < post_op_emitters[eltwise_post_op_idx]->get_inputs_num(); j++)
-                    in_idxs.push_back(get_vmm_reg(input_idx++).getIdx());
+                for (int j = 1; j < post_op_emitters[eltwise_post_op_idx]->get_inputs_num(); j++) {
+                    const int input = post_op_inputs_[input_idx++];
+                    if (input >= 0) {
+                        in_idxs.push_back(get_vmm_reg(input).getIdx());
+                        continue;
+                    }
+                    // the result of a previous operation: the one of the preceding operation is copied, since
+                    // the emitters expect only the first operand to share the register with the destination
+                    const int op = -input - 1;
+                    if (op == i - 1)
+                        uni_vmovups(vmm_result, vmm_dst);
+                    else
+                        uni_vmovups(vmm_result, ptr[rsp + saved_results_[op] * vlen]);
+                    in_idxs.push_back(vmm_result.getIdx());
+                }
                 for (int j = 0; j < post_op_emitters[eltwise_post_op_idx]->aux_vecs_count(); j++)
                     aux_idxs.push_back(get_aux_vmm(j).getIdx());
 
@@ -654,6 +707,7 @@ private:
                 out_idxs.push_back(vmm_dst.getIdx());
 
                 post_op_emitters[eltwise_post_op_idx]->emit_code(in_idxs, out_idxs, aux_idxs);
+                save_result(i);
 
                 eltwise_post_op_idx++;
             } else if (ops_list_[i] == ov::intel_cpu::Type::FakeQuantize) {
@@ -673,6 +727,7 @@ private:
 
                 quantization_injectors[quantization_post_op_idx]->init_output_scale_shift_ptrs(reg_post_op_ptrs + ptrs_table_off, reg_oc_off);
                 quantization_injectors[quantization_post_op_idx]->compute_output_scale_shift(s_idx, s_idx + 1, offset, is_scalar, jep_.oc_size == 1);
+                save_result(i);
 
                 quantization_post_op_idx++;
             } else {
@@ -1206,6 +1261,7 @@ namespace {
 struct EltwiseKey {
     std::vector<Eltwise::EltwiseData> eltwise_data;
     std::vector<Type> ops_list;
+    std::vector<int> post_op_inputs;
     VectorDims outBlkDims;
     VectorDims outOrder;
     std::vector<VectorDims> inpDims;
@@ -1213,6 +1269,9 @@ struct EltwiseKey {
     InferenceEngine::Precision outPrc;
     dnnl::post_ops postOps;
     EltwiseImplType implType;
+    // strides of the inputs and the output which are the strided views of bigger tensors, empty for the dense ones
+    std::vector<VectorDims> inpStrides;
+    VectorDims outStrides;
 
     size_t hash() const {
         using namespace dnnl::impl;
@@ -1230,6 +1289,7 @@ struct EltwiseKey {
             seed = hash_combine_eltwiseData(seed, item);
         });
         seed = get_vector_hash(seed, ops_list);
+        seed = get_vector_hash(seed, post_op_inputs);
         if (implType == EltwiseImplType::optimizedShapeAgnostic) {
             seed = hash_combine(seed, outBlkDims.back() == 1);
             for (auto&& item : inpDims) {
@@ -1241,6 +1301,10 @@ struct EltwiseKey {
             for (auto&& item : inpDims) {
                 seed = get_vector_hash(seed, item);
             }
+            seed = get_vector_hash(seed, outStrides);
+            for (auto&& item : inpStrides) {
+                seed = get_vector_hash(seed, item);
+            }
         }
         std::for_each(inpPrc.begin(), inpPrc.end(), [&](const Precision& item) {
             seed = hash_combine(seed, item.getPrecVal());
@@ -1258,6 +1322,7 @@ struct EltwiseKey {
 
         bool result = eltwise_data == rhs.eltwise_data &&
                       ops_list == rhs.ops_list &&
+                      post_op_inputs == rhs.post_op_inputs &&
                       inpPrc == rhs.inpPrc &&
                       outPrc == rhs.outPrc &&
                       *postOps.get() == *rhs.postOps.get() &&
@@ -1274,7 +1339,9 @@ struct EltwiseKey {
                 }
             } else {
                 result = result && outOrder == rhs.outOrder &&
-                         outBlkDims == rhs.outBlkDims;
+                         outBlkDims == rhs.outBlkDims &&
+                         inpStrides == rhs.inpStrides &&
+                         outStrides == rhs.outStrides;
                 for (size_t i = 0; i < inpDims.size() && result; ++i) {
                     result = result && (inpDims[i] == rhs.inpDims[i]);
                 }
@@ -1303,11 +1370,21 @@ public:
         }
     }
 
+    // offsets of the strided view, the outer dims are shifted by the number of the dims collapsed into the innermost one
+    static void offset_strided_calc(VectorDims& offset, const VectorDims& strides, int collapsedDims) {
+        for (int i = 0; i < static_cast<int>(offset.size()) - 1; i++) {
+            offset[i] = i < collapsedDims ? 0 : strides[i - collapsedDims];
+        }
+    }
+
     EltwiseJitExecutor(const std::vector<Eltwise::EltwiseData>& eltwise_data,
                        const std::vector<Type>& ops_list,
+                       const std::vector<int>& post_op_inputs,
                        const VectorDims& outBlkDims,
                        const VectorDims& outOrder,
                        std::vector<VectorDims> inpDims,
+                       const std::vector<VectorDims>& inpStrides,
+                       const VectorDims& outStrides,
                        const std::vector<InferenceEngine::Precision>& inpPrc,
                        const InferenceEngine::Precision& outPrc,
                        const dnnl::post_ops& post_ops,
@@ -1405,6 +1482,36 @@ public:
 
         int maxCollapsedDims = static_cast<int>(jep.dims.size()) - lastUnchangedAxis - 2;
 
+        // the strided views can be collapsed only along the outer dims which are dense
+        auto alignStrides = [&](const VectorDims& strides) {
+            VectorDims aligned(jep.input_size, 0);
+            std::copy(strides.begin(), strides.end(), aligned.end() - strides.size());
+            return aligned;
+        };
+        auto getDenseOuterDims = [&](const VectorDims& strides) {
+            int denseDims = 0;
+            size_t denseStride = strides.back() * jep.dims.back();
+            for (int i = static_cast<int>(jep.dims.size()) - 2; i >= 0; i--) {
+                if (jep.dims[i] != 1 && strides[i] != denseStride)
+                    break;
+                denseStride *= jep.dims[i];
+                denseDims++;
+            }
+            return denseDims;
+        };
+        VectorDims outStridesAligned;
+        if (!outStrides.empty()) {
+            outStridesAligned = alignStrides(outStrides);
+            maxCollapsedDims = std::min(maxCollapsedDims, getDenseOuterDims(outStridesAligned));
+        }
+        std::vector<VectorDims> inpStridesAligned(inputsNumber);
+        for (size_t i = 0; i < inpStrides.size() && i < inputsNumber; i++) {
+            if (!inpStrides[i].empty()) {
+                inpStridesAligned[i] = alignStrides(inpStrides[i]);
+                maxCollapsedDims = std::min(maxCollapsedDims, getDenseOuterDims(inpStridesAligned[i]));
+            }
+        }
+
         size_t fullWorkAmount = 1;
         for (int i = 0; i < jep.dims.size(); i++) {
             fullWorkAmount *= jep.dims[i];
@@ -1473,6 +1580,8 @@ public:
             // init offset
             jep.dst_offsets.resize(jep.input_size, 1);
             offset_out_calc(jep.dst_offsets, jep.dims);
+            if (!outStridesAligned.empty())
+                offset_strided_calc(jep.dst_offsets, outStridesAligned, collapsedDims);
             for (int j = 0; j < jep.input_size; j++) {
                 jep.dst_offsets[j] *= outPrc.size();
             }
@@ -1480,6 +1589,8 @@ public:
             for (int i = 0; i < inputsNumber; i++) {
                 jep.src_offsets[i].resize(jep.input_size, 1);
                 offset_in_calc(jep.src_offsets[i], inpDims[i], jep.dims);
+                if (!inpStridesAligned[i].empty())
+                    offset_strided_calc(jep.src_offsets[i], inpStridesAligned[i], collapsedDims);
                 for (int j = 0; j < jep.input_size; j++) {
                     jep.src_offsets[i][j] *= inpPrc[i].size();
                 }
@@ -1501,11 +1612,11 @@ public:
 
 #if defined(OPENVINO_ARCH_X86_64)
         if (mayiuse(x64::avx512_core)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_core>(jep, eltwise_data, ops_list, post_op_inputs, post_ops));
         } else if (mayiuse(x64::avx2)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(jep, eltwise_data, ops_list, post_op_inputs, post_ops));
         } else if (mayiuse(x64::sse41)) {
-            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_ops));
+            _pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(jep, eltwise_data, ops_list, post_op_inputs, post_ops));
         } else {
             IE_THROW() << "Can't create jit eltwise kernel";
         }
@@ -1766,9 +1877,12 @@ static Eltwise::executorPtr buildExecutor(const EltwiseKey& key) {
     if (key.implType != EltwiseImplType::reference) {
         execPtr = std::make_shared<EltwiseJitExecutor>(key.eltwise_data,
                                                        key.ops_list,
+                                                       key.post_op_inputs,
                                                        key.outBlkDims,
                                                        key.outOrder,
                                                        key.inpDims,
+                                                       key.inpStrides,
+                                                       key.outStrides,
                                                        key.inpPrc,
                                                        key.outPrc,
                                                        key.postOps,
@@ -1816,6 +1930,26 @@ Eltwise::Eltwise(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CP
     initializers.at(op->get_type_info())(op, *this);
 }
 
+std::vector<int> Eltwise::getFusedOpsInputs() const {
+    std::vector<int> inputs;
+    int inputsNum = static_cast<int>(getOpInputsNum());
+    for (const auto& node : fusedWith) {
+        if (node->getType() != Type::Eltwise)
+            continue;
+        const auto eltwise = std::static_pointer_cast<Eltwise>(node);
+        if (eltwise->fusedInputs.empty()) {
+            for (size_t i = 1; i < eltwise->getOpInputsNum(); i++)
+                inputs.push_back(inputsNum++);
+        } else {
+            for (const auto input : eltwise->fusedInputs) {
+                inputs.push_back(input);
+                inputsNum = std::max(inputsNum, input + 1);
+            }
+        }
+    }
+    return inputs;
+}
+
 size_t Eltwise::getOpInputsNum() const {
     switch (getAlgorithm()) {
         case Algorithm::EltwiseIsFinite:
@@ -1916,11 +2050,9 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
     }
 
     size_t expectedInputsNum = getOpInputsNum();
-    for (auto& postOp : fusedWith) {
-        auto* eltwiseNode = dynamic_cast<const Eltwise*>(postOp.get());
-        if (eltwiseNode != nullptr) {
-            expectedInputsNum += eltwiseNode->getOpInputsNum() - 1;
-        }
+    for (const auto input : getFusedOpsInputs()) {
+        if (input >= 0)
+            expectedInputsNum = std::max(expectedInputsNum, static_cast<size_t>(input) + 1);
     }
     if (getParentEdges().size() > MAX_ELTWISE_INPUTS)
         IE_THROW() << "Eltwise node with name `" << getName() << "` doesn't support more than " << MAX_ELTWISE_INPUTS
@@ -1937,9 +2069,14 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
 
     for (auto& fusedNode : fusedWith) {
         if (fusedNode->getType() == Type::Eltwise) {
-            for (int i = 0; i < fusedNode->getOriginalInputsNumber(); i++) {
-                if (fusedNode->getFusingPort() != i)
+            const auto& inputs = std::static_pointer_cast<Eltwise>(fusedNode)->fusedInputs;
+            for (int i = 0, j = 0; i < fusedNode->getOriginalInputsNumber(); i++) {
+                if (fusedNode->getFusingPort() == i)
+                    continue;
+                // only the operands which added an input to this node
+                if (inputs.empty() || inputs[j] == static_cast<int>(inputPrecisions.size()))
                     inputPrecisions.push_back(fusedNode->getOriginalInputPrecisionAtPort(i));
+                j++;
             }
         }
         if (fusedNode->getType() == Type::FakeQuantize) {
@@ -2048,6 +2185,15 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
         size_t offset = 0;
         NodeConfig config;
 
+        // the static jit kernel walks the outer dims using the strides of the memory, so it may read and write
+        // the strided views of the in-place Concat and Split, only the innermost dim has to be dense
+        const bool acceptsOuterStrides = !useAclExecutor && implType == EltwiseImplType::optimized;
+        auto resetOuterStrides = [](BlockedMemoryDesc::CmpMask& mask, const CpuBlockedMemoryDesc& desc) {
+            for (size_t j = 0; j + 1 < desc.getBlockDims().size(); j++) {
+                mask.reset(j);
+            }
+        };
+
         for (size_t i = 0; i < getParentEdges().size(); i++) {
             BlockedMemoryDesc::CmpMask inputMask = BLOCKED_DESC_SKIP_OFFSET_MASK;
             PortConfig portConfig;
@@ -2060,7 +2206,12 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
             if (!isDynamicNode() && srcShape.getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on the batch axis
             }
-            portConfig.setMemDesc(createMemoryDesc(srcShape, inputPrecisions[i], offset), inputMask);
+            const auto srcDesc = createMemoryDesc(srcShape, inputPrecisions[i], offset);
+            // the broadcasted inputs are read with the dense offsets
+            if (acceptsOuterStrides && srcShape == getOutputShapeAtPort(0)) {
+                resetOuterStrides(inputMask, *srcDesc);
+            }
+            portConfig.setMemDesc(srcDesc, inputMask);
 
             config.inConfs.push_back(portConfig);
         }
@@ -2074,7 +2225,11 @@ void Eltwise::initSupportedPrimitiveDescriptors() {
         if (!isDynamicNode() && dstShape.getDims()[0] == 1) {
             outputMask.reset(0); // accepts any stride on the batch axis
         }
-        portConfig.setMemDesc(createMemoryDesc(dstShape, outputPrecision, offset), outputMask);
+        const auto dstDesc = createMemoryDesc(dstShape, outputPrecision, offset);
+        if (acceptsOuterStrides) {
+            resetOuterStrides(outputMask, *dstDesc);
+        }
+        portConfig.setMemDesc(dstDesc, outputMask);
 
         config.outConfs.push_back(portConfig);
 
@@ -2254,8 +2409,30 @@ void Eltwise::prepareParams() {
     }
 
     if (!canSkipSearchInCache) {
+        // the strides are passed only for the strided views (in-place Concat and Split), the dense tensors keep the cached executors shared
+        auto getViewStrides = [](const BlockedMemoryDesc& desc) -> VectorDims {
+            const auto& blkDims = desc.getBlockDims();
+            const auto& strides = desc.getStrides();
+            size_t denseStride = 1;
+            for (int j = static_cast<int>(blkDims.size()) - 1; j >= 0; j--) {
+                if (blkDims[j] != 1 && strides[j] != denseStride)
+                    return strides;
+                denseStride *= blkDims[j];
+            }
+            return {};
+        };
+        std::vector<VectorDims> inpStrides(inputNum);
+        VectorDims outStrides;
+        if (implType == EltwiseImplType::optimized) {
+            for (int i = 0; i < inputNum; i++) {
+                inpStrides[i] = getViewStrides(*getParentEdgeAt(i)->getMemory().GetDescWithType<BlockedMemoryDesc>());
+            }
+            outStrides = getViewStrides(*outBlockingDesc);
+        }
+
         EltwiseData thisOp{getAlgorithm(), getOneDnnAlgorithm(), getAlpha(), getBeta(), getGamma()};
-        EltwiseKey key = {{thisOp}, {getType()}, currentOutBlkDims, outOrder, dims_in, inpPrc, outPrc, dnnl::post_ops(), implType};
+        EltwiseKey key = {{thisOp}, {getType()}, getFusedOpsInputs(), currentOutBlkDims, outOrder, dims_in, inpPrc, outPrc,
+                          dnnl::post_ops(), implType, inpStrides, outStrides};
         fqDataPtrs.clear();
         for (const auto &node : fusedWith) {
             key.ops_list.push_back(node->getType());
@@ -122,11 +122,21 @@ public:
     float getBeta() const { return beta; }
     float getGamma() const { return gamma; }
 
+    const std::vector<float>& getScales() const { return scales; }
+    const std::vector<float>& getShifts() const { return shifts; }
+
     dnnl::algorithm getOneDnnAlgorithm() const { return onednnAlgorithm; }
 
     bool isWithBroadcast();
     bool isSpecialConvolutionAddFusing() const { return specialConvolutionAddFusing; }
 
+    /**
+     * Sources of the operands (except the fusing one) of the node fused into another Eltwise: an input port of
+     * the parent node or -(i + 1) for the result of the i-th operation of the fused chain (0 is the parent node).
+     * Empty means the operands are appended to the inputs of the parent node one by one.
+     */
+    void setFusedInputs(std::vector<int> inputs) { fusedInputs = std::move(inputs); }
+
     bool needPrepareParams() const override;
     void prepareParams() override;
     void createPrimitive() override;
@@ -152,6 +162,7 @@ private:
     EltwiseImplType implType = EltwiseImplType::reference;
     std::vector<bool> broadcastPolicy;
     bool specialConvolutionAddFusing = false;
+    std::vector<int> fusedInputs;
     size_t inputNum = 0;
     std::vector<ptrdiff_t> start_offset_in = {};
     ptrdiff_t start_offset_out = 0;
@@ -191,6 +202,7 @@ private:
     static BroadcastingPolicy determineBroadcastingPolicy(const std::shared_ptr<ngraph::Node>& op);
 
     size_t getOpInputsNum() const;
+    std::vector<int> getFusedOpsInputs() const;
 
     template <typename T>
     void appendPostOpsImpl(dnnl::post_ops& ops, const VectorDims &postOpDims, std::vector<T>& postOpsMem, const int channelAxis = 1);
@@ -3,6 +3,7 @@
 //
 
 #include <cmath>
+#include <cstring>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,13 +11,208 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+#include "emitters/x64/jit_load_store_emitters.hpp"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+using namespace Xbyak;
 
 namespace ov {
 namespace intel_cpu {
 namespace node {
 
+#if defined(OPENVINO_ARCH_X86_64)
+
+// Accumulates the table rows of one bag in fp32. The output row is split into blocks of `unroll` vectors
+// which stay in registers while the bag indices are walked, the rows of the following indices are prefetched.
+template <cpu_isa_t isa>
+struct jit_emb_bag_kernel : public jit_uni_emb_bag_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_emb_bag_kernel)
+
+    explicit jit_emb_bag_kernel(const jit_emb_bag_compile_params& jcp) : jit_uni_emb_bag_kernel(jcp), jit_generator(jit_name()) {
+        row_size = jcp_.emb_depth * jcp_.src_prc.size();
+    }
+    virtual ~jit_emb_bag_kernel() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == cpu_isa_t::sse41, Xmm, isa == cpu_isa_t::avx2, Ymm, Zmm>::type;
+
+    const size_t vec_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+    const size_t unroll = 4;
+    const size_t prefetch_distance = 4;
+    const size_t cache_line_size = 64;
+
+    void generate() override {
+        this->preamble();
+
+#define GET_OFF(field) offsetof(jit_emb_bag_call_args, field)
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_row_size, row_size);
+        if (jcp_.with_dequantization)
+            mov(reg_dequantization, ptr[reg_params + GET_OFF(dequantization)]);
+
+        const size_t block_size = unroll * vec_size;
+        const size_t blocks_num = jcp_.emb_depth / block_size;
+        const size_t tail_size = jcp_.emb_depth % block_size;
+
+        if (blocks_num > 0) {
+            Label blocks_loop_label;
+            mov(reg_blocks_num, blocks_num);
+            L(blocks_loop_label);
+            {
+                accumulate_block(block_size);
+
+                add(reg_src, block_size * jcp_.src_prc.size());
+                add(reg_dst, block_size * jcp_.dst_prc.size());
+                dec(reg_blocks_num);
+                jnz(blocks_loop_label, T_NEAR);
+            }
+        }
+        if (tail_size) {
+            accumulate_block(tail_size);
+        }
+
+        this->postamble();
+
+        for (const auto& emitter : emitters) {
+            if (emitter.second)
+                emitter.second->emit_data();
+        }
+    }
+
+    void accumulate_block(size_t elt_num) {
+        const size_t vecs_num = div_up(elt_num, vec_size);
+        for (size_t i = 0; i < vecs_num; i++)
+            uni_vpxor(Vmm(i), Vmm(i), Vmm(i));
+
+        mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+        if (jcp_.with_weights)
+            mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+
+        Label indices_loop_label;
+        Label indices_end_label;
+        L(indices_loop_label);
+        {
+            cmp(reg_indices_num, 0);
+            je(indices_end_label, T_NEAR);
+
+            prefetch_row(elt_num);
+
+            movsxd(reg_row, dword[reg_indices]);
+            if (jcp_.with_dequantization) {
+                uni_vbroadcastss(vmm_scale, ptr[reg_dequantization + reg_row * (2 * sizeof(float))]);
+                uni_vbroadcastss(vmm_shift, ptr[reg_dequantization + reg_row * (2 * sizeof(float)) + sizeof(float)]);
+                if (jcp_.with_weights) {
+                    uni_vbroadcastss(vmm_weight, ptr[reg_weights]);
+                    uni_vmulps(vmm_scale, vmm_scale, vmm_weight);
+                    uni_vmulps(vmm_shift, vmm_shift, vmm_weight);
+                }
+            } else if (jcp_.with_weights) {
+                uni_vbroadcastss(vmm_scale, ptr[reg_weights]);
+            }
+            // the table may exceed 2GB, so the row offset is computed with the 64-bit row size
+            imul(reg_row, reg_row_size);
+            add(reg_row, reg_src);
+
+            for (size_t i = 0; i < vecs_num; i++) {
+                const size_t load_num = std::min(vec_size, elt_num - i * vec_size);
+                load(vmm_val, reg_row, i * vec_size * jcp_.src_prc.size(), load_num);
+                if (jcp_.with_weights || jcp_.with_dequantization) {
+                    uni_vfmadd231ps(Vmm(i), vmm_val, vmm_scale);
+                } else {
+                    uni_vaddps(Vmm(i), Vmm(i), vmm_val);
+                }
+                if (jcp_.with_dequantization)
+                    uni_vaddps(Vmm(i), Vmm(i), vmm_shift);
+            }
+
+            add(reg_indices, sizeof(int));
+            if (jcp_.with_weights)
+                add(reg_weights, sizeof(float));
+            dec(reg_indices_num);
+            jmp(indices_loop_label, T_NEAR);
+        }
+        L(indices_end_label);
+
+        for (size_t i = 0; i < vecs_num; i++) {
+            const size_t store_num = std::min(vec_size, elt_num - i * vec_size);
+            store(reg_dst, i * vec_size * jcp_.dst_prc.size(), Vmm(i), store_num);
+        }
+    }
+
+    // The bag indices are random, so the hardware prefetcher can't predict the next rows
+    void prefetch_row(size_t elt_num) {
+        Label prefetch_end_label;
+        cmp(reg_indices_num, prefetch_distance);
+        jbe(prefetch_end_label, T_NEAR);
+
+        movsxd(reg_prefetch, dword[reg_indices + prefetch_distance * sizeof(int)]);
+        imul(reg_prefetch, reg_row_size);
+        add(reg_prefetch, reg_src);
+        for (size_t offset = 0; offset < elt_num * jcp_.src_prc.size(); offset += cache_line_size)
+            prefetcht0(ptr[reg_prefetch + offset]);
+
+        L(prefetch_end_label);
+    }
+#undef GET_OFF
+
+    inline void load(const Vmm& vmm_dst, const Xbyak::Reg64& reg_ptr, size_t offset, size_t elt_num) {
+        const auto seed = load_emitter_params(jcp_.src_prc, Precision::FP32, elt_num).hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_load_emitter(this, isa, jcp_.src_prc, Precision::FP32, elt_num));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(reg_ptr.getIdx()), offset}, {static_cast<size_t>(vmm_dst.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+    inline void store(const Xbyak::Reg64& reg_ptr, size_t offset, const Vmm& vmm_src, size_t elt_num) {
+        const auto seed = store_emitter_params(Precision::FP32, jcp_.dst_prc, elt_num).hash();
+        if (!emitters[seed]) {
+            emitters[seed].reset(new jit_store_emitter(this, isa, Precision::FP32, jcp_.dst_prc, elt_num));
+        }
+
+        emitters[seed]->emit_code({static_cast<size_t>(vmm_src.getIdx()), offset}, {static_cast<size_t>(reg_ptr.getIdx())},
+                                  pool_aux_vmm_idxs, pool_aux_gpr_idxs);
+    }
+
+    size_t row_size;
+
+    // Vmm(0) .. Vmm(unroll - 1) are the accumulators
+    Vmm vmm_val = Vmm(unroll);
+    Vmm vmm_scale = Vmm(unroll + 1);
+    Vmm vmm_shift = Vmm(unroll + 2);
+    Vmm vmm_weight = Vmm(unroll + 3);
+
+    Reg64 reg_src = r8;
+    Reg64 reg_dst = r9;
+    Reg64 reg_dequantization = r10;
+    Reg64 reg_indices = r11;
+    Reg64 reg_indices_num = r12;
+    Reg64 reg_weights = r13;
+    Reg64 reg_row = r14;
+    Reg64 reg_prefetch = r15;
+    Reg64 reg_blocks_num = rax;
+    Reg64 reg_row_size = rdx;
+    Reg64 reg_params = abi_param1;
+
+    const std::vector<size_t> pool_aux_gpr_idxs = { static_cast<size_t>(rsi.getIdx()), static_cast<size_t>(rbp.getIdx()) };
+    const std::vector<size_t> pool_aux_vmm_idxs = { unroll + 4, unroll + 5 };
+
+    std::unordered_map<size_t, std::unique_ptr<jit_emitter>> emitters;
+};
+
+#endif // OPENVINO_ARCH_X86_64
+
 EmbeddingBagSum::EmbeddingBagSum(
             const std::shared_ptr<ngraph::Node>& op,
             size_t requiredInputNum,
@@ -39,11 +235,82 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrc) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (!canUseJit(tablePrc) || _embDepth == 0) {
+        _kernel.reset();
+        return;
+    }
+    if (_kernel && _kernel->jcp_.emb_depth == _embDepth && _kernel->jcp_.src_prc == tablePrc)
+        return;
+
+    jit_emb_bag_compile_params jcp;
+    jcp.src_prc = tablePrc;
+    jcp.dst_prc = getOutputPrecision(tablePrc);
+    jcp.emb_depth = _embDepth;
+    jcp.with_weights = _withWeights;
+    jcp.with_dequantization = !_dequantization.empty();
+#if defined(OPENVINO_ARCH_X86_64)
+    if (mayiuse(cpu_isa_t::avx512_core)) {
+        _kernel.reset(new jit_emb_bag_kernel<cpu_isa_t::avx512_core>(jcp));
+    } else if (mayiuse(cpu_isa_t::avx2)) {
+        _kernel.reset(new jit_emb_bag_kernel<cpu_isa_t::avx2>(jcp));
+    }
+#endif // OPENVINO_ARCH_X86_64
+    if (_kernel)
+        _kernel->create_ker();
+}
+
+bool EmbeddingBagSum::isJitSupported() {
+#if defined(OPENVINO_ARCH_X86_64)
+    return mayiuse(cpu_isa_t::avx2);
+#else
+    return false;
+#endif // OPENVINO_ARCH_X86_64
+}
+
+bool EmbeddingBagSum::canUseJit(const Precision& tablePrc) const {
+    // integer tables without dequantization produce an integer sum, it stays on the reference path
+    return isJitSupported() && (one_of(tablePrc, Precision::FP32, Precision::BF16) ||
+                                (one_of(tablePrc, Precision::I8, Precision::U8) && !_dequantization.empty()));
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const Precision& tablePrc) const {
+    if (!canUseJit(tablePrc))
+        return impl_desc_type::ref_any;
+#if defined(OPENVINO_ARCH_X86_64)
+    if (mayiuse(cpu_isa_t::avx512_core))
+        return impl_desc_type::jit_avx512;
+#endif // OPENVINO_ARCH_X86_64
+    return impl_desc_type::jit_avx2;
+}
+
+Precision EmbeddingBagSum::getTablePrecision(const Precision& originalPrc) const {
+    if (originalPrc == Precision::BF16 && !isJitSupported())
+        return Precision::FP32;
+    return originalPrc;
+}
+
+Precision EmbeddingBagSum::getOutputPrecision(const Precision& tablePrc) const {
+    // bf16 tables are accumulated in fp32 and keep the bf16 output, dequantized tables produce fp32
+    if (!_dequantization.empty())
+        return Precision::FP32;
+    return tablePrc;
+}
+
+void EmbeddingBagSum::fuseDequantization(const std::vector<float>& scales, const std::vector<float>& zeroPoints) {
+    if (!zeroPoints.empty() && zeroPoints.size() != scales.size())
+        IE_THROW() << "EmbeddingBagSum layer with name '" << _layerName << "' has inconsistent dequantization parameters.";
+
+    _dequantization.resize(2 * scales.size());
+    for (size_t i = 0; i < scales.size(); i++) {
+        _dequantization[2 * i] = scales[i];
+        _dequantization[2 * i + 1] = zeroPoints.empty() ? 0.f : -zeroPoints[i] * scales[i];
+    }
 }
 
 template<typename T>
@@ -119,8 +386,69 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const float* weightsData,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<uint8_t *>(outMemory->GetPtr());
+    const size_t dstRowSize = _embDepth * _kernel->jcp_.dst_prc.size();
+    // the default index of an empty bag is summed without a per-sample weight
+    static const float defaultWeight = 1.f;
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        jit_emb_bag_call_args args;
+        args.src = srcData;
+        args.dequantization = _dequantization.data();
+        for (size_t obi = start; obi < end; obi++) {
+            uint8_t* dst = dstData + obi * dstRowSize;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+
+            if (indices == nullptr) {
+                // zero is all zero bits in both fp32 and bf16
+                std::memset(dst, 0, dstRowSize);
+                continue;
+            }
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            args.indices = indices;
+            args.indices_num = indicesSize;
+            args.weights = nullptr;
+            if (_withWeights)
+                args.weights = withWeights ? weightsData + weightsIdx : &defaultWeight;
+            args.dst = dst;
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    if (_kernel) {
+        return processDataJit(srcData, reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+    }
+    if (!_dequantization.empty()) {
+        IE_THROW() << "EmbeddingBagSum layer with name '" << _layerName << "' has no kernel to dequantize the embedding table.";
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
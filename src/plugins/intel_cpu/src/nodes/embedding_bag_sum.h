@@ -14,6 +14,39 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+struct jit_emb_bag_compile_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    size_t emb_depth;
+    bool with_weights;
+    bool with_dequantization;
+};
+
+struct jit_emb_bag_call_args {
+    const void *src;
+    const int *indices;
+    const float *weights;
+    const float *dequantization;
+    void *dst;
+    size_t indices_num;
+};
+
+struct jit_uni_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_call_args*);
+
+    void operator()(const jit_emb_bag_call_args* call_args) {
+        assert(ker_);
+        ker_(call_args);
+    }
+
+    explicit jit_uni_emb_bag_kernel(const jit_emb_bag_compile_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_compile_params jcp_;
+};
+
 class EmbeddingBagSum {
 public:
     EmbeddingBagSum(
@@ -26,6 +59,11 @@ public:
     void execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                  const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory);
 
+    // Per-row dequantization of an int8/uint8 table: dequantized row = (row - zeroPoints[i]) * scales[i].
+    // Both vectors have a value per table row, zeroPoints may be empty.
+    void fuseDequantization(const std::vector<float>& scales, const std::vector<float>& zeroPoints);
+    static bool isJitSupported();
+
     ~EmbeddingBagSum() = default;
 
 protected:
@@ -37,11 +75,18 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrc);
+
+    InferenceEngine::Precision getTablePrecision(const InferenceEngine::Precision& originalPrc) const;
+    InferenceEngine::Precision getOutputPrecision(const InferenceEngine::Precision& tablePrc) const;
+    bool canUseJit(const InferenceEngine::Precision& tablePrc) const;
+    impl_desc_type getImplType(const InferenceEngine::Precision& tablePrc) const;
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    void processDataJit(const uint8_t* srcData, const float* weightsData,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +96,10 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    // (scale, -zero_point * scale) pair per table row
+    std::vector<float> _dequantization;
+    std::unique_ptr<jit_uni_emb_bag_kernel> _kernel;
 };
 
 }   // namespace node
@@ -0,0 +1,515 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_compressed_gemm.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils/bfloat16.hpp"
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+using ov::intel_cpu::bfloat16_t;
+
+inline size_t groups_num(const fc_compressed_conf& conf) {
+    return (conf.K + conf.group_size - 1) / conf.group_size;
+}
+
+// dst points to the first output channel of the block nb
+inline void store_block(const fc_compressed_conf& conf, size_t nb, const float* block, float* dst) {
+    const size_t count = (std::min)(fc_compressed_block, conf.N - nb * fc_compressed_block);
+    std::memcpy(dst, block, count * sizeof(float));
+}
+
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+
+#if defined(HAVE_AVX512F)
+using vec = __m512;
+constexpr size_t vec_len = 16;
+constexpr size_t max_rows = 4;
+
+inline vec vzero() { return _mm512_setzero_ps(); }
+inline vec vload(const float* p) { return _mm512_loadu_ps(p); }
+inline vec vset1(float v) { return _mm512_set1_ps(v); }
+inline vec vsub(vec a, vec b) { return _mm512_sub_ps(a, b); }
+inline vec vadd(vec a, vec b) { return _mm512_add_ps(a, b); }
+inline vec vmul(vec a, vec b) { return _mm512_mul_ps(a, b); }
+inline vec vfmadd(vec a, vec b, vec c) { return _mm512_fmadd_ps(a, b, c); }
+inline void vstore(float* p, vec v) { _mm512_storeu_ps(p, v); }
+
+template <bool is_4bit, bool is_signed>
+inline void load_weights(const uint8_t* p, vec* w) {
+    if (is_4bit) {
+        const __m256i q = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        __m512i x = _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_and_si256(q, _mm256_set1_epi32(0xF))),
+                                       _mm256_srli_epi32(q, 4), 1);
+        if (is_signed)
+            x = _mm512_sub_epi32(_mm512_xor_si512(x, _mm512_set1_epi32(8)), _mm512_set1_epi32(8));
+        w[0] = _mm512_cvtepi32_ps(x);
+    } else {
+        const __m128i q = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        w[0] = _mm512_cvtepi32_ps(is_signed ? _mm512_cvtepi8_epi32(q) : _mm512_cvtepu8_epi32(q));
+    }
+}
+#else
+using vec = __m256;
+constexpr size_t vec_len = 8;
+constexpr size_t max_rows = 2;
+
+inline vec vzero() { return _mm256_setzero_ps(); }
+inline vec vload(const float* p) { return _mm256_loadu_ps(p); }
+inline vec vset1(float v) { return _mm256_set1_ps(v); }
+inline vec vsub(vec a, vec b) { return _mm256_sub_ps(a, b); }
+inline vec vadd(vec a, vec b) { return _mm256_add_ps(a, b); }
+inline vec vmul(vec a, vec b) { return _mm256_mul_ps(a, b); }
+inline vec vfmadd(vec a, vec b, vec c) { return _mm256_fmadd_ps(a, b, c); }
+inline void vstore(float* p, vec v) { _mm256_storeu_ps(p, v); }
+
+template <bool is_4bit, bool is_signed>
+inline void load_weights(const uint8_t* p, vec* w) {
+    if (is_4bit) {
+        const __m256i q = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)));
+        __m256i lo = _mm256_and_si256(q, _mm256_set1_epi32(0xF));
+        __m256i hi = _mm256_srli_epi32(q, 4);
+        if (is_signed) {
+            lo = _mm256_sub_epi32(_mm256_xor_si256(lo, _mm256_set1_epi32(8)), _mm256_set1_epi32(8));
+            hi = _mm256_sub_epi32(_mm256_xor_si256(hi, _mm256_set1_epi32(8)), _mm256_set1_epi32(8));
+        }
+        w[0] = _mm256_cvtepi32_ps(lo);
+        w[1] = _mm256_cvtepi32_ps(hi);
+    } else {
+        const __m128i q0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        const __m128i q1 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 8));
+        w[0] = _mm256_cvtepi32_ps(is_signed ? _mm256_cvtepi8_epi32(q0) : _mm256_cvtepu8_epi32(q0));
+        w[1] = _mm256_cvtepi32_ps(is_signed ? _mm256_cvtepi8_epi32(q1) : _mm256_cvtepu8_epi32(q1));
+    }
+}
+#endif
+
+constexpr size_t vecs_per_block = fc_compressed_block / vec_len;
+
+// A single row reuses the decompressed weights only once, so more blocks are processed together
+// to have enough independent accumulators.
+template <size_t rows>
+constexpr size_t blocks_per_step() {
+    return rows == 1 ? 4 : 2;
+}
+
+// The unpacked weights are loaded as is, so the registers left by the decompression hold more accumulators
+constexpr size_t unpacked_blocks_per_step = vec_len == 16 ? 4 : 2;
+
+/**
+ * Adds the bias to the rows x (blocks * 16) tile and stores it, dst points to the element [m, nb * 16] of the output tile.
+ */
+template <size_t rows, size_t blocks>
+inline void store_tile(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                       vec (&total)[rows][blocks][vecs_per_block], size_t nb, float* dst) {
+    for (size_t b = 0; b < blocks; b++) {
+        if (args.bias) {
+            for (size_t v = 0; v < vecs_per_block; v++) {
+                const vec bias = vload(args.bias + (nb + b) * fc_compressed_block + v * vec_len);
+                for (size_t r = 0; r < rows; r++)
+                    total[r][b][v] = vadd(total[r][b][v], bias);
+            }
+        }
+        const bool full_block = (nb + b + 1) * fc_compressed_block <= conf.N;
+        for (size_t r = 0; r < rows; r++) {
+            float* dst_block = dst + r * args.dst_stride + b * fc_compressed_block;
+            if (full_block) {
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    vstore(dst_block + v * vec_len, total[r][b][v]);
+            } else {
+                float block[fc_compressed_block];
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    vstore(block + v * vec_len, total[r][b][v]);
+                store_block(conf, nb + b, block, dst_block);
+            }
+        }
+    }
+}
+
+/**
+ * rows x (blocks * 16) tile of the output: the products of a group are accumulated in registers
+ * and scaled once per group, the weights of each input channel are decompressed once for all the rows.
+ */
+template <size_t rows, size_t blocks, typename src_t, bool is_4bit, bool is_signed, bool with_zp>
+void gemm_tile(const fc_compressed_conf& conf, const fc_compressed_args& args, size_t m, size_t nb, float* dst) {
+    constexpr size_t k_bytes = is_4bit ? fc_compressed_block / 2 : fc_compressed_block;
+    const size_t groups = groups_num(conf);
+
+    vec total[rows][blocks][vecs_per_block];
+    for (size_t r = 0; r < rows; r++)
+        for (size_t b = 0; b < blocks; b++)
+            for (size_t v = 0; v < vecs_per_block; v++)
+                total[r][b][v] = vzero();
+
+    const src_t* src[rows];
+    for (size_t r = 0; r < rows; r++)
+        src[r] = reinterpret_cast<const src_t*>(args.src) + (m + r) * args.src_stride;
+
+    for (size_t g = 0; g < groups; g++) {
+        const size_t k_begin = g * conf.group_size;
+        const size_t k_end = (std::min)(k_begin + conf.group_size, conf.K);
+
+        vec zp[blocks][vecs_per_block];
+        if (with_zp) {
+            for (size_t b = 0; b < blocks; b++)
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    zp[b][v] = vload(args.zero_points + ((nb + b) * groups + g) * fc_compressed_block + v * vec_len);
+        }
+
+        vec acc[rows][blocks][vecs_per_block];
+        for (size_t r = 0; r < rows; r++)
+            for (size_t b = 0; b < blocks; b++)
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    acc[r][b][v] = vzero();
+
+        for (size_t k = k_begin; k < k_end; k++) {
+            vec w[blocks][vecs_per_block];
+            for (size_t b = 0; b < blocks; b++) {
+                load_weights<is_4bit, is_signed>(args.weights + ((nb + b) * conf.K + k) * k_bytes, w[b]);
+                if (with_zp) {
+                    for (size_t v = 0; v < vecs_per_block; v++)
+                        w[b][v] = vsub(w[b][v], zp[b][v]);
+                }
+            }
+            for (size_t r = 0; r < rows; r++) {
+                const vec x = vset1(static_cast<float>(src[r][k]));
+                for (size_t b = 0; b < blocks; b++)
+                    for (size_t v = 0; v < vecs_per_block; v++)
+                        acc[r][b][v] = vfmadd(x, w[b][v], acc[r][b][v]);
+            }
+        }
+
+        for (size_t b = 0; b < blocks; b++) {
+            for (size_t v = 0; v < vecs_per_block; v++) {
+                const vec scale = vload(args.scales + ((nb + b) * groups + g) * fc_compressed_block + v * vec_len);
+                for (size_t r = 0; r < rows; r++)
+                    total[r][b][v] = vfmadd(acc[r][b][v], scale, total[r][b][v]);
+            }
+        }
+    }
+
+    store_tile<rows, blocks>(conf, args, total, nb, dst);
+}
+
+/**
+ * The same tile with the weights already decompressed to [blocks][K][16] f32, unpacked points to the block nb.
+ */
+template <size_t rows, size_t blocks, typename src_t>
+void unpacked_tile(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked,
+                   size_t m, size_t nb, float* dst) {
+    vec total[rows][blocks][vecs_per_block];
+    for (size_t r = 0; r < rows; r++)
+        for (size_t b = 0; b < blocks; b++)
+            for (size_t v = 0; v < vecs_per_block; v++)
+                total[r][b][v] = vzero();
+
+    const src_t* src[rows];
+    for (size_t r = 0; r < rows; r++)
+        src[r] = reinterpret_cast<const src_t*>(args.src) + (m + r) * args.src_stride;
+
+    for (size_t k = 0; k < conf.K; k++) {
+        vec w[blocks][vecs_per_block];
+        for (size_t b = 0; b < blocks; b++)
+            for (size_t v = 0; v < vecs_per_block; v++)
+                w[b][v] = vload(unpacked + (b * conf.K + k) * fc_compressed_block + v * vec_len);
+        for (size_t r = 0; r < rows; r++) {
+            const vec x = vset1(static_cast<float>(src[r][k]));
+            for (size_t b = 0; b < blocks; b++)
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    total[r][b][v] = vfmadd(x, w[b][v], total[r][b][v]);
+        }
+    }
+
+    store_tile<rows, blocks>(conf, args, total, nb, dst);
+}
+
+template <size_t rows, typename src_t, bool is_4bit, bool is_signed, bool with_zp>
+void gemm_rows(const fc_compressed_conf& conf, const fc_compressed_args& args, size_t m,
+               size_t nb_begin, size_t nb_end, float* dst) {
+    constexpr size_t blocks = blocks_per_step<rows>();
+    size_t nb = nb_begin;
+    for (; nb + blocks <= nb_end; nb += blocks)
+        gemm_tile<rows, blocks, src_t, is_4bit, is_signed, with_zp>(conf, args, m, nb,
+                                                                     dst + (nb - nb_begin) * fc_compressed_block);
+    for (; nb < nb_end; nb++)
+        gemm_tile<rows, 1, src_t, is_4bit, is_signed, with_zp>(conf, args, m, nb, dst + (nb - nb_begin) * fc_compressed_block);
+}
+
+template <size_t rows, typename src_t>
+void unpacked_rows(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked, size_t m,
+                   size_t nb_begin, size_t nb_end, float* dst) {
+    constexpr size_t blocks = unpacked_blocks_per_step;
+    const size_t block_size = conf.K * fc_compressed_block;
+    size_t nb = nb_begin;
+    for (; nb + blocks <= nb_end; nb += blocks)
+        unpacked_tile<rows, blocks, src_t>(conf, args, unpacked + (nb - nb_begin) * block_size, m, nb,
+                                           dst + (nb - nb_begin) * fc_compressed_block);
+    for (; nb < nb_end; nb++)
+        unpacked_tile<rows, 1, src_t>(conf, args, unpacked + (nb - nb_begin) * block_size, m, nb,
+                                      dst + (nb - nb_begin) * fc_compressed_block);
+}
+
+// Splits the rows by max_rows and calls rows_kernel.template operator()<rows>(m, dst) for each step
+template <typename rows_kernel>
+void for_rows(const fc_compressed_args& args, size_t m_begin, size_t m_end, const rows_kernel& kernel) {
+    size_t m = m_begin;
+    for (; m + max_rows <= m_end; m += max_rows)
+        kernel.template run<max_rows>(m, args.dst + (m - m_begin) * args.dst_stride);
+    float* dst = args.dst + (m - m_begin) * args.dst_stride;
+    switch (m_end - m) {
+    case 3:
+        kernel.template run<3>(m, dst);
+        break;
+    case 2:
+        kernel.template run<2>(m, dst);
+        break;
+    case 1:
+        kernel.template run<1>(m, dst);
+        break;
+    default:
+        break;
+    }
+}
+
+template <typename src_t, bool is_4bit, bool is_signed, bool with_zp>
+struct gemm_rows_kernel {
+    const fc_compressed_conf& conf;
+    const fc_compressed_args& args;
+    size_t nb_begin;
+    size_t nb_end;
+
+    template <size_t rows>
+    void run(size_t m, float* dst) const {
+        gemm_rows<rows, src_t, is_4bit, is_signed, with_zp>(conf, args, m, nb_begin, nb_end, dst);
+    }
+};
+
+template <typename src_t>
+struct unpacked_rows_kernel {
+    const fc_compressed_conf& conf;
+    const fc_compressed_args& args;
+    const float* unpacked;
+    size_t nb_begin;
+    size_t nb_end;
+
+    template <size_t rows>
+    void run(size_t m, float* dst) const {
+        unpacked_rows<rows, src_t>(conf, args, unpacked, m, nb_begin, nb_end, dst);
+    }
+};
+
+template <typename src_t, bool is_4bit, bool is_signed, bool with_zp>
+void gemm(const fc_compressed_conf& conf, const fc_compressed_args& args,
+          size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    for_rows(args, m_begin, m_end, gemm_rows_kernel<src_t, is_4bit, is_signed, with_zp>{conf, args, nb_begin, nb_end});
+}
+
+template <typename src_t>
+void gemm_unpacked(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked,
+                   size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    for_rows(args, m_begin, m_end, unpacked_rows_kernel<src_t>{conf, args, unpacked, nb_begin, nb_end});
+}
+
+template <bool is_4bit, bool is_signed, bool with_zp>
+void unpack(const fc_compressed_conf& conf, const fc_compressed_args& args, size_t nb_begin, size_t nb_end, float* unpacked) {
+    constexpr size_t k_bytes = is_4bit ? fc_compressed_block / 2 : fc_compressed_block;
+    const size_t groups = groups_num(conf);
+    for (size_t nb = nb_begin; nb < nb_end; nb++) {
+        for (size_t g = 0; g < groups; g++) {
+            const size_t k_begin = g * conf.group_size;
+            const size_t k_end = (std::min)(k_begin + conf.group_size, conf.K);
+            vec zp[vecs_per_block];
+            vec scale[vecs_per_block];
+            for (size_t v = 0; v < vecs_per_block; v++) {
+                if (with_zp)
+                    zp[v] = vload(args.zero_points + (nb * groups + g) * fc_compressed_block + v * vec_len);
+                scale[v] = vload(args.scales + (nb * groups + g) * fc_compressed_block + v * vec_len);
+            }
+            for (size_t k = k_begin; k < k_end; k++) {
+                vec w[vecs_per_block];
+                load_weights<is_4bit, is_signed>(args.weights + (nb * conf.K + k) * k_bytes, w);
+                float* dst = unpacked + ((nb - nb_begin) * conf.K + k) * fc_compressed_block;
+                for (size_t v = 0; v < vecs_per_block; v++)
+                    vstore(dst + v * vec_len, vmul(with_zp ? vsub(w[v], zp[v]) : w[v], scale[v]));
+            }
+        }
+    }
+}
+
+#else
+
+template <bool is_4bit, bool is_signed>
+inline float load_weight(const uint8_t* q, size_t j) {
+    int value;
+    if (is_4bit) {
+        value = j < fc_compressed_block / 2 ? (q[j] & 0xF) : (q[j - fc_compressed_block / 2] >> 4);
+        if (is_signed)
+            value = (value ^ 8) - 8;
+    } else {
+        value = is_signed ? static_cast<int>(static_cast<int8_t>(q[j])) : static_cast<int>(q[j]);
+    }
+    return static_cast<float>(value);
+}
+
+template <typename src_t, bool is_4bit, bool is_signed, bool with_zp>
+void gemm(const fc_compressed_conf& conf, const fc_compressed_args& args,
+          size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    constexpr size_t k_bytes = is_4bit ? fc_compressed_block / 2 : fc_compressed_block;
+    const size_t groups = groups_num(conf);
+    float acc[fc_compressed_block];
+    float total[fc_compressed_block];
+
+    for (size_t nb = nb_begin; nb < nb_end; nb++) {
+        for (size_t m = m_begin; m < m_end; m++) {
+            const src_t* src = reinterpret_cast<const src_t*>(args.src) + m * args.src_stride;
+            std::fill(total, total + fc_compressed_block, 0.f);
+            for (size_t g = 0; g < groups; g++) {
+                const size_t k_begin = g * conf.group_size;
+                const size_t k_end = (std::min)(k_begin + conf.group_size, conf.K);
+                const float* zp = with_zp ? args.zero_points + (nb * groups + g) * fc_compressed_block : nullptr;
+                const float* scale = args.scales + (nb * groups + g) * fc_compressed_block;
+                std::fill(acc, acc + fc_compressed_block, 0.f);
+                for (size_t k = k_begin; k < k_end; k++) {
+                    const uint8_t* q = args.weights + (nb * conf.K + k) * k_bytes;
+                    const float x = static_cast<float>(src[k]);
+                    for (size_t j = 0; j < fc_compressed_block; j++) {
+                        const float w = load_weight<is_4bit, is_signed>(q, j);
+                        acc[j] += x * (with_zp ? w - zp[j] : w);
+                    }
+                }
+                for (size_t j = 0; j < fc_compressed_block; j++)
+                    total[j] += acc[j] * scale[j];
+            }
+            if (args.bias) {
+                for (size_t j = 0; j < fc_compressed_block; j++)
+                    total[j] += args.bias[nb * fc_compressed_block + j];
+            }
+            store_block(conf, nb, total, args.dst + (m - m_begin) * args.dst_stride + (nb - nb_begin) * fc_compressed_block);
+        }
+    }
+}
+
+template <typename src_t>
+void gemm_unpacked(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked,
+                   size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    float total[fc_compressed_block];
+    for (size_t nb = nb_begin; nb < nb_end; nb++) {
+        const float* w = unpacked + (nb - nb_begin) * conf.K * fc_compressed_block;
+        for (size_t m = m_begin; m < m_end; m++) {
+            const src_t* src = reinterpret_cast<const src_t*>(args.src) + m * args.src_stride;
+            std::fill(total, total + fc_compressed_block, 0.f);
+            for (size_t k = 0; k < conf.K; k++) {
+                const float x = static_cast<float>(src[k]);
+                for (size_t j = 0; j < fc_compressed_block; j++)
+                    total[j] += x * w[k * fc_compressed_block + j];
+            }
+            if (args.bias) {
+                for (size_t j = 0; j < fc_compressed_block; j++)
+                    total[j] += args.bias[nb * fc_compressed_block + j];
+            }
+            store_block(conf, nb, total, args.dst + (m - m_begin) * args.dst_stride + (nb - nb_begin) * fc_compressed_block);
+        }
+    }
+}
+
+template <bool is_4bit, bool is_signed, bool with_zp>
+void unpack(const fc_compressed_conf& conf, const fc_compressed_args& args, size_t nb_begin, size_t nb_end, float* unpacked) {
+    constexpr size_t k_bytes = is_4bit ? fc_compressed_block / 2 : fc_compressed_block;
+    const size_t groups = groups_num(conf);
+    for (size_t nb = nb_begin; nb < nb_end; nb++) {
+        for (size_t k = 0; k < conf.K; k++) {
+            const size_t idx = (nb * groups + k / conf.group_size) * fc_compressed_block;
+            const uint8_t* q = args.weights + (nb * conf.K + k) * k_bytes;
+            float* dst = unpacked + ((nb - nb_begin) * conf.K + k) * fc_compressed_block;
+            for (size_t j = 0; j < fc_compressed_block; j++) {
+                const float w = load_weight<is_4bit, is_signed>(q, j);
+                dst[j] = (with_zp ? w - args.zero_points[idx + j] : w) * args.scales[idx + j];
+            }
+        }
+    }
+}
+
+#endif
+
+template <typename src_t, bool is_4bit, bool is_signed>
+void gemm_zp(const fc_compressed_conf& conf, const fc_compressed_args& args,
+             size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    if (args.zero_points)
+        gemm<src_t, is_4bit, is_signed, true>(conf, args, m_begin, m_end, nb_begin, nb_end);
+    else
+        gemm<src_t, is_4bit, is_signed, false>(conf, args, m_begin, m_end, nb_begin, nb_end);
+}
+
+template <typename src_t>
+void gemm_weights(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                  size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    if (conf.is_4bit) {
+        if (conf.is_signed)
+            gemm_zp<src_t, true, true>(conf, args, m_begin, m_end, nb_begin, nb_end);
+        else
+            gemm_zp<src_t, true, false>(conf, args, m_begin, m_end, nb_begin, nb_end);
+    } else {
+        if (conf.is_signed)
+            gemm_zp<src_t, false, true>(conf, args, m_begin, m_end, nb_begin, nb_end);
+        else
+            gemm_zp<src_t, false, false>(conf, args, m_begin, m_end, nb_begin, nb_end);
+    }
+}
+
+template <bool is_4bit, bool is_signed>
+void unpack_zp(const fc_compressed_conf& conf, const fc_compressed_args& args, size_t nb_begin, size_t nb_end, float* unpacked) {
+    if (args.zero_points)
+        unpack<is_4bit, is_signed, true>(conf, args, nb_begin, nb_end, unpacked);
+    else
+        unpack<is_4bit, is_signed, false>(conf, args, nb_begin, nb_end, unpacked);
+}
+
+}  // namespace
+
+void fc_compressed_gemm(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                        size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    if (conf.is_src_bf16)
+        gemm_weights<bfloat16_t>(conf, args, m_begin, m_end, nb_begin, nb_end);
+    else
+        gemm_weights<float>(conf, args, m_begin, m_end, nb_begin, nb_end);
+}
+
+void fc_compressed_unpack(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                          size_t nb_begin, size_t nb_end, float* unpacked) {
+    if (conf.is_4bit) {
+        if (conf.is_signed)
+            unpack_zp<true, true>(conf, args, nb_begin, nb_end, unpacked);
+        else
+            unpack_zp<true, false>(conf, args, nb_begin, nb_end, unpacked);
+    } else {
+        if (conf.is_signed)
+            unpack_zp<false, true>(conf, args, nb_begin, nb_end, unpacked);
+        else
+            unpack_zp<false, false>(conf, args, nb_begin, nb_end, unpacked);
+    }
+}
+
+void fc_unpacked_gemm(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked,
+                      size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end) {
+    if (conf.is_src_bf16)
+        gemm_unpacked<bfloat16_t>(conf, args, unpacked, m_begin, m_end, nb_begin, nb_end);
+    else
+        gemm_unpacked<float>(conf, args, unpacked, m_begin, m_end, nb_begin, nb_end);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
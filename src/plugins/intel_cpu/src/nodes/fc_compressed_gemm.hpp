@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Output channels are packed by blocks of fc_compressed_block, the last block is padded with zeros
+constexpr size_t fc_compressed_block = 16;
+
+struct fc_compressed_conf {
+    size_t N;           // output channels
+    size_t K;           // input channels
+    size_t group_size;  // input channels sharing a scale and a zero point, K for per channel decompression
+    bool is_4bit;       // two weights per byte: the low nibbles hold the channels [0, 8) of a block and the high ones [8, 16)
+    bool is_signed;
+    bool is_src_bf16;   // bf16 activations, otherwise f32
+};
+
+struct fc_compressed_args {
+    const void* src;            // [M, K]
+    size_t src_stride;
+    const uint8_t* weights;     // [N / 16][K][16] bytes or [N / 16][K][8] bytes for 4 bit weights
+    const float* scales;        // [N / 16][groups][16]
+    const float* zero_points;   // [N / 16][groups][16] or nullptr
+    const float* bias;          // [N / 16][16] or nullptr
+    float* dst;                 // the output tile: the element [m_begin, nb_begin * 16] of [M, N]
+    size_t dst_stride;
+};
+
+namespace XARCH {
+
+/**
+ * Computes the rows [m_begin, m_end) of the output channel blocks [nb_begin, nb_end) of dst = src * decompress(weights)^T,
+ * where decompress(w) = (w - zero_point) * scale. The weights are decompressed in registers and never materialized.
+ */
+void fc_compressed_gemm(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                        size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end);
+
+/**
+ * Decompresses the output channel blocks [nb_begin, nb_end) of the weights to f32 [nb_end - nb_begin][K][16].
+ * Many rows reuse a tile unpacked once instead of decompressing the weights again for each group of rows.
+ */
+void fc_compressed_unpack(const fc_compressed_conf& conf, const fc_compressed_args& args,
+                          size_t nb_begin, size_t nb_end, float* unpacked);
+
+/**
+ * Same as fc_compressed_gemm, but takes the weights of the blocks [nb_begin, nb_end) unpacked by fc_compressed_unpack.
+ */
+void fc_unpacked_gemm(const fc_compressed_conf& conf, const fc_compressed_args& args, const float* unpacked,
+                      size_t m_begin, size_t m_end, size_t nb_begin, size_t nb_end);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_sparse_gemm.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr size_t block = fc_sparse_rows_block;
+
+#if defined(HAVE_AVX512F)
+struct rows_vec {
+    __m512 v;
+    static rows_vec zero() { return {_mm512_setzero_ps()}; }
+    static rows_vec set1(float value) { return {_mm512_set1_ps(value)}; }
+    void fmadd(float weight, const float* src) {
+        v = _mm512_fmadd_ps(_mm512_set1_ps(weight), _mm512_loadu_ps(src), v);
+    }
+    void add(const rows_vec& other) { v = _mm512_add_ps(v, other.v); }
+    void store(float* dst) const { _mm512_storeu_ps(dst, v); }
+};
+#elif defined(HAVE_AVX2)
+struct rows_vec {
+    __m256 v0, v1;
+    static rows_vec zero() { return {_mm256_setzero_ps(), _mm256_setzero_ps()}; }
+    static rows_vec set1(float value) { return {_mm256_set1_ps(value), _mm256_set1_ps(value)}; }
+    void fmadd(float weight, const float* src) {
+        const __m256 w = _mm256_set1_ps(weight);
+        v0 = _mm256_fmadd_ps(w, _mm256_loadu_ps(src), v0);
+        v1 = _mm256_fmadd_ps(w, _mm256_loadu_ps(src + 8), v1);
+    }
+    void add(const rows_vec& other) {
+        v0 = _mm256_add_ps(v0, other.v0);
+        v1 = _mm256_add_ps(v1, other.v1);
+    }
+    void store(float* dst) const {
+        _mm256_storeu_ps(dst, v0);
+        _mm256_storeu_ps(dst + 8, v1);
+    }
+};
+#else
+struct rows_vec {
+    float v[block];
+    static rows_vec zero() { return set1(0.f); }
+    static rows_vec set1(float value) {
+        rows_vec r;
+        std::fill(r.v, r.v + block, value);
+        return r;
+    }
+    void fmadd(float weight, const float* src) {
+        for (size_t i = 0; i < block; i++)
+            v[i] += weight * src[i];
+    }
+    void add(const rows_vec& other) {
+        for (size_t i = 0; i < block; i++)
+            v[i] += other.v[i];
+    }
+    void store(float* dst) const { std::copy(v, v + block, dst); }
+};
+#endif
+
+// the output channel n for a block of rows: the non zero weights are split between
+// a few accumulators to hide the latency of the dependent multiply-adds
+inline void channel(const fc_sparse_weights& weights, const fc_sparse_args& args, size_t n, const float* src_t, float* dst_t) {
+    rows_vec acc0 = args.bias ? rows_vec::set1(args.bias[n]) : rows_vec::zero();
+    rows_vec acc1 = rows_vec::zero(), acc2 = rows_vec::zero(), acc3 = rows_vec::zero();
+    int32_t i = weights.begin[n];
+    const int32_t end = weights.begin[n + 1];
+    for (; i + 4 <= end; i += 4) {
+        acc0.fmadd(weights.values[i], src_t + weights.cols[i] * block);
+        acc1.fmadd(weights.values[i + 1], src_t + weights.cols[i + 1] * block);
+        acc2.fmadd(weights.values[i + 2], src_t + weights.cols[i + 2] * block);
+        acc3.fmadd(weights.values[i + 3], src_t + weights.cols[i + 3] * block);
+    }
+    for (; i < end; i++)
+        acc0.fmadd(weights.values[i], src_t + weights.cols[i] * block);
+    acc0.add(acc1);
+    acc2.add(acc3);
+    acc0.add(acc2);
+    acc0.store(dst_t);
+}
+
+}  // namespace
+
+void fc_sparse_gemm(const fc_sparse_weights& weights, const fc_sparse_args& args,
+                    size_t m_begin, size_t m_end, size_t n_begin, size_t n_end, float* scratch) {
+    float* src_t = scratch;                     // [K][block]
+    float* dst_t = scratch + args.K * block;    // [n_end - n_begin][block]
+
+    for (size_t m = m_begin; m < m_end; m += block) {
+        const size_t rows = (std::min)(block, m_end - m);
+        for (size_t k = 0; k < args.K; k++) {
+            for (size_t r = 0; r < rows; r++)
+                src_t[k * block + r] = args.src[(m + r) * args.src_stride + k];
+            for (size_t r = rows; r < block; r++)
+                src_t[k * block + r] = 0.f;
+        }
+
+        for (size_t n = n_begin; n < n_end; n++)
+            channel(weights, args, n, src_t, dst_t + (n - n_begin) * block);
+
+        for (size_t r = 0; r < rows; r++) {
+            float* dst = args.dst + (m + r) * args.dst_stride;
+            for (size_t n = n_begin; n < n_end; n++)
+                dst[n] = dst_t[(n - n_begin) * block + r];
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Rows of the input processed together, each non zero weight is applied to all of them by a single instruction
+constexpr size_t fc_sparse_rows_block = 16;
+
+// Non zero weights of each output channel in CSR format
+struct fc_sparse_weights {
+    const int32_t* begin;   // [N + 1], the weights of the output channel n are [begin[n], begin[n + 1])
+    const int32_t* cols;    // input channel of each non zero weight
+    const float* values;
+};
+
+struct fc_sparse_args {
+    size_t N;               // output channels
+    size_t K;               // input channels
+    const float* src;       // [M, K]
+    size_t src_stride;
+    const float* bias;      // [N] or nullptr
+    float* dst;             // [M, N]
+    size_t dst_stride;
+};
+
+namespace XARCH {
+
+/**
+ * Computes the rows [m_begin, m_end) of the output channels [n_begin, n_end) of dst = src * weights^T + bias.
+ * The input rows are transposed by blocks of fc_sparse_rows_block into the scratch, which must hold
+ * (K + n_end - n_begin) * fc_sparse_rows_block floats.
+ * The last block of rows is padded with zeros, so with a single row only 1 / fc_sparse_rows_block of each
+ * multiply-add is useful, and the kernel pays off only for the highly sparse weights.
+ */
+void fc_sparse_gemm(const fc_sparse_weights& weights, const fc_sparse_args& args,
+                    size_t m_begin, size_t m_end, size_t n_begin, size_t n_end, float* scratch);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -17,6 +17,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/bfloat16.hpp"
 
 #include "onednn/dnnl.h"
 #include "oneapi/dnnl/dnnl.hpp"
@@ -24,7 +25,10 @@
 #include "common/primitive_hashing_utils.hpp"
 #include "common/primitive_desc.hpp"
 #include "common/primitive_desc_iface.hpp"
+#include "ie_parallel.hpp"
 
+#include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -133,6 +137,10 @@ private:
     std::shared_ptr<const ngraph::Node> m_op;
 };
 
+// The output of the compressed weights kernel is split by tiles of rows and output channel blocks
+constexpr size_t compressedRowsPerTile = 64;
+constexpr size_t compressedBlocksPerTile = 4;
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -173,11 +181,18 @@ FullyConnected::FullyConnected(const std::shared_ptr<ngraph::Node>& op, const Gr
 
         if (context->getConfig().fcSparseWeiDecompressionRate < 1.0f)
             minSparseRate = context->getConfig().fcSparseWeiDecompressionRate;
+        if (context->getConfig().fcSparseFP32KernelRate < 1.0f)
+            minSparseKernelRate = context->getConfig().fcSparseFP32KernelRate;
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
 }
 
+void FullyConnected::init() {
+    // decided before the fusings, as the sparse kernel doesn't support post operations
+    useSparseKernel = useSparseWeightsKernel();
+}
+
 std::vector<memory::format_tag> FullyConnected::getAvailableFormatsForDims(const Shape &dims) const {
     if (dims.getRank() == 0)
         return {memory::format_tag::x};
@@ -227,6 +242,17 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    if (withCustomKernel()) {
+        inDims = isDynamicNode() ? makeDummyInputDims() : getInputShapeAtPort(DATA_ID).getStaticDims();
+        outDims = isDynamicNode() ? makeDummyOutputDims(inDims) : getOutputShapeAtPort(0).getStaticDims();
+        // the compressed weights kernel reads and writes bf16 as is, the rest is processed in f32
+        const auto outputPrecision = fusedWith.empty() ? getOriginalOutputPrecisionAtPort(0)
+                                                       : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+        outputDataType = useWeightsDecompression && outputPrecision == Precision::BF16 ? memory::data_type::bf16
+                                                                                       : memory::data_type::f32;
+        return;
+    }
+
     useSparseWeights = useSparseWeightsDecompression();
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
@@ -270,6 +296,14 @@ void FullyConnected::getSupportedDescriptors() {
 }
 
 void FullyConnected::createPrimitive() {
+    if (withCustomKernel()) {
+        if (useWeightsDecompression) {
+            setPostOps(attr, outDims);
+            initCompressedPostOps();
+        }
+        Node::createPrimitive();
+        return;
+    }
     setPostOps(attr, outDims);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
@@ -277,6 +311,17 @@ void FullyConnected::createPrimitive() {
 }
 
 void FullyConnected::prepareParams() {
+    if (useWeightsDecompression) {
+        if (!packedWeights)
+            prepareCompressedWeights();
+        prepareCompressedParams();
+        return;
+    }
+    if (useSparseKernel) {
+        if (!sparseWeights)
+            prepareSparseWeights();
+        return;
+    }
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
     if (!dstMemPtr || !dstMemPtr->isAllocated())
@@ -447,6 +492,14 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useWeightsDecompression) {
+        executeCompressed();
+        return;
+    }
+    if (useSparseKernel) {
+        executeSparse();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -476,6 +529,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the sparse weights kernel doesn't support post operations
+    if (useSparseKernel)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -535,6 +591,8 @@ const std::vector<impl_desc_type>& FullyConnected::getPrimitivesPriority() {
     std::vector<impl_desc_type> priorities = {
             impl_desc_type::unknown,
             impl_desc_type::brgemm_sparse_avx512_amx,
+            impl_desc_type::gemm_sparse_avx512,
+            impl_desc_type::gemm_sparse_avx2,
             impl_desc_type::brgemm_avx512_amx,
             impl_desc_type::brgemm_avx512,
             impl_desc_type::gemm_blas,
@@ -664,6 +722,26 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withCustomKernel()) {
+        const bool avx512 = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core);
+        impl_desc_type implType = impl_desc_type::ref;
+        if (useSparseKernel)
+            implType = avx512 ? impl_desc_type::gemm_sparse_avx512 : impl_desc_type::gemm_sparse_avx2;
+        else if (avx512)
+            implType = impl_desc_type::jit_avx512;
+        else if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
+            implType = impl_desc_type::jit_avx2;
+
+        const auto srcPrecision = useWeightsDecompression && getOriginalInputPrecisionAtPort(DATA_ID) == Precision::BF16
+                                  ? Precision::BF16 : Precision::FP32;
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, srcPrecision},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, DnnlExtensionUtils::DataTypeToIEPrecision(outputDataType)}}, implType);
+        return;
+    }
+
     for (auto& desc : descs) {
         primitive_desc_iterator itpd = desc;
         while (static_cast<bool>(itpd)) {
@@ -755,6 +833,8 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
 
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
+    if (withCustomKernel())
+        return;
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
     // if convolution selected the reorder for ip is useless. Will do the reoder for ip in prepareParams
@@ -932,6 +1012,371 @@ bool FullyConnected::useSparseWeightsDecompression() {
     return true;
 }
 
+bool FullyConnected::useSparseWeightsKernel() {
+    // minSparseKernelRate == 1 means that the sparse kernel is switched off
+    if (minSparseKernelRate == 1.f)
+        return false;
+
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
+        return false;
+
+    const auto& weightsShape = getInputShapeAtPort(WEIGHTS_ID);
+    if (!one_of(getInputShapeAtPort(DATA_ID).getRank(), 2u, 3u) || weightsShape.getRank() != 2 || !weightsShape.isStatic())
+        return false;
+
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 || getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+    if (withBiases && getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32)
+        return false;
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode || !constNode->isConstant())
+        return false;
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    const auto weightsData = reinterpret_cast<const float*>(blb->GetPtr());
+    const auto elementsCount = weightsShape.getElementsCount();
+    const size_t zerosCount = std::count(weightsData, weightsData + elementsCount, 0.f);
+    weiSparseRate = static_cast<float>(zerosCount) / static_cast<float>(elementsCount);
+
+    DEBUG_LOG(getName(), " | fp32 sparse rate = ", weiSparseRate * 100, "%, min sparse rate = ",
+        minSparseKernelRate * 100, "%, use sparse kernel = ", weiSparseRate >= minSparseKernelRate);
+
+    // the CSR offsets and the column indices are int32
+    if (elementsCount - zerosCount > static_cast<size_t>(std::numeric_limits<int32_t>::max()) ||
+        weightsShape.getStaticDims()[1] > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        return false;
+
+    return weiSparseRate >= minSparseKernelRate;
+}
+
+void FullyConnected::prepareSparseWeights() {
+    using namespace InferenceEngine::Extensions::Cpu;
+    const auto weightsMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    if (!weightsMem || !weightsMem->isAllocated())
+        IE_THROW() << errorPrefix << " has unallocated weights memory.";
+
+    const auto& weightsDims = weightsMem->getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const auto weights = reinterpret_cast<const float*>(weightsMem->GetPtr());
+
+    // [N + 1] offsets, [nnz] input channels, [nnz] values
+    auto create = [&]() {
+        std::vector<int32_t> begin(N + 1, 0);
+        for (size_t n = 0; n < N; n++)
+            begin[n + 1] = begin[n] + static_cast<int32_t>(std::count_if(weights + n * K, weights + (n + 1) * K,
+                                                                          [](float w) { return w != 0.f; }));
+        const size_t nnz = begin[N];
+        auto memory = std::make_shared<Memory>(getEngine());
+        memory->Create(CpuBlockedMemoryDesc(Precision::I32, Shape(VectorDims{N + 1 + 2 * nnz})));
+        auto packed = reinterpret_cast<int32_t*>(memory->GetPtr());
+        std::copy(begin.begin(), begin.end(), packed);
+        auto cols = packed + N + 1;
+        auto values = reinterpret_cast<float*>(cols + nnz);
+        parallel_for(N, [&](size_t n) {
+            int32_t i = begin[n];
+            for (size_t k = 0; k < K; k++) {
+                if (weights[n * K + k] != 0.f) {
+                    cols[i] = static_cast<int32_t>(k);
+                    values[i++] = weights[n * K + k];
+                }
+            }
+        });
+        return memory;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_sparse_" + std::to_string(weightsMem->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->GetData()));
+        sparseWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        sparseWeights = create();
+    }
+
+    sparseScratchPerThread = (K + N) * fc_sparse_rows_block;
+    sparseScratch.resize(parallel_get_max_threads() * sparseScratchPerThread);
+}
+
+void FullyConnected::executeSparse() {
+    using namespace InferenceEngine::Extensions::Cpu;
+    const auto srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    const auto dstMem = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& srcDims = srcMem->getStaticDims();
+    const auto& weightsDims = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr()->getStaticDims();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+
+    const auto packed = reinterpret_cast<const int32_t*>(sparseWeights->GetPtr());
+    const size_t nnz = packed[N];
+    const fc_sparse_weights weights = {packed, packed + N + 1, reinterpret_cast<const float*>(packed + N + 1 + nnz)};
+    const float* bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    const fc_sparse_args args = {N, K, reinterpret_cast<const float*>(srcMem->GetPtr()), K, bias,
+                                 reinterpret_cast<float*>(dstMem->GetPtr()), N};
+
+    // the rows are transposed once per block, so the output channels are split only when there are fewer row blocks than threads
+    const size_t rowBlocks = div_up(M, fc_sparse_rows_block);
+    const size_t threads = parallel_get_max_threads();
+    const size_t channelChunks = (std::min)(N, div_up(threads, rowBlocks));
+    const size_t chunk = div_up(N, channelChunks);
+    parallel_nt(threads, [&](const int ithr, const int nthr) {
+        float* scratch = sparseScratch.data() + ithr * sparseScratchPerThread;
+        for_2d(ithr, nthr, rowBlocks, channelChunks, [&](size_t mb, size_t nc) {
+            const size_t nBegin = nc * chunk;
+            if (nBegin >= N)
+                return;
+            XARCH::fc_sparse_gemm(weights, args, mb * fc_sparse_rows_block, (std::min)(M, (mb + 1) * fc_sparse_rows_block),
+                                  nBegin, (std::min)(N, nBegin + chunk), scratch);
+        });
+    });
+}
+
+bool FullyConnected::isSupportedWeightsDecompression(Precision weightsPrecision, Precision activationsPrecision,
+                                                     size_t activationsRank) {
+    // the compressed weights kernel has only the AVX-512 and AVX2 implementations worth running
+    return impl::cpu::x64::mayiuse(impl::cpu::x64::avx2) &&
+           one_of(weightsPrecision, Precision::I8, Precision::U8) &&
+           one_of(activationsPrecision, Precision::FP32, Precision::BF16) &&
+           one_of(activationsRank, 2u, 3u);
+}
+
+void FullyConnected::fuseDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints, size_t groups) {
+    const auto& weightsDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (weightsDims.size() != 2 || groups == 0 || weightsDims[1] % groups != 0 || scales.size() != weightsDims[0] * groups ||
+        (!zeroPoints.empty() && zeroPoints.size() != scales.size()))
+        IE_THROW() << errorPrefix << " has inconsistent weights decompression parameters.";
+
+    useWeightsDecompression = true;
+    decompressionGroups = groups;
+    decompressionScales = scales;
+    decompressionZeroPoints = zeroPoints;
+}
+
+void FullyConnected::prepareCompressedWeights() {
+    using namespace InferenceEngine::Extensions::Cpu;
+    const auto weightsMem = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    if (!weightsMem || !weightsMem->isAllocated())
+        IE_THROW() << errorPrefix << " has unallocated weights memory.";
+
+    const auto& weightsDims = weightsMem->getStaticDims();
+    const size_t N = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t blocks = div_up(N, fc_compressed_block);
+    const auto weights = reinterpret_cast<const uint8_t*>(weightsMem->GetPtr());
+    const bool isSigned = weightsMem->getDesc().getPrecision() == Precision::I8;
+
+    // int4 weights come here as int8 ones, they are packed back when it's lossless
+    auto fitsFourBits = [](uint8_t value, bool isSigned) {
+        return isSigned ? (static_cast<int8_t>(value) >= -8 && static_cast<int8_t>(value) <= 7) : value <= 15;
+    };
+    bool is4bit = true;
+    for (size_t i = 0; i < N * K && is4bit; i++)
+        is4bit = fitsFourBits(weights[i], isSigned);
+
+    const bool isSrcBf16 = getParentEdgesAtPort(DATA_ID)[0]->getMemory().getDesc().getPrecision() == Precision::BF16;
+    compressedConf = {N, K, K / decompressionGroups, is4bit, isSigned, isSrcBf16};
+
+    // [N, K] -> [N / 16][K][16]: a row of a block is loaded by a single instruction
+    auto create = [&]() {
+        const size_t kBytes = is4bit ? fc_compressed_block / 2 : fc_compressed_block;
+        auto memory = std::make_shared<Memory>(getEngine());
+        memory->Create(CpuBlockedMemoryDesc(Precision::U8, Shape(VectorDims{blocks * K * kBytes})));
+        auto packed = reinterpret_cast<uint8_t*>(memory->GetPtr());
+        std::fill(packed, packed + blocks * K * kBytes, 0);
+        parallel_for(blocks, [&](size_t nb) {
+            for (size_t n = nb * fc_compressed_block; n < (std::min)(N, (nb + 1) * fc_compressed_block); n++) {
+                const size_t j = n % fc_compressed_block;
+                for (size_t k = 0; k < K; k++) {
+                    const uint8_t value = weights[n * K + k];
+                    uint8_t* dst = packed + (nb * K + k) * kBytes;
+                    if (is4bit)
+                        dst[j % kBytes] |= (value & 0xF) << (j < kBytes ? 0 : 4);
+                    else
+                        dst[j] = value;
+                }
+            }
+        });
+        return memory;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_compressed_" + std::to_string(weightsMem->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->GetData()));
+        packedWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packedWeights = create();
+    }
+
+    auto packPerChannel = [&](const std::vector<float>& values, size_t groups) {
+        std::vector<float> packed(blocks * groups * fc_compressed_block, 0.f);
+        for (size_t n = 0; n < N; n++) {
+            const size_t nb = n / fc_compressed_block;
+            for (size_t g = 0; g < groups; g++)
+                packed[(nb * groups + g) * fc_compressed_block + n % fc_compressed_block] = values[n * groups + g];
+        }
+        return packed;
+    };
+    packedScales = packPerChannel(decompressionScales, decompressionGroups);
+    if (!decompressionZeroPoints.empty())
+        packedZeroPoints = packPerChannel(decompressionZeroPoints, decompressionGroups);
+    if (withBiases) {
+        const auto biasMem = getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr();
+        const auto bias = reinterpret_cast<const float*>(biasMem->GetPtr());
+        packedBias = packPerChannel(std::vector<float>(bias, bias + N), 1);
+    }
+}
+
+void FullyConnected::prepareCompressedParams() {
+    using namespace InferenceEngine::Extensions::Cpu;
+    const auto& srcDims = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr()->getStaticDims();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+
+    // The output is split by tiles of rows and output channel blocks, so a tile of the weights is reused
+    // from cache for all the rows of a tile. With a few rows the split is by the output channels only.
+    // The weights are decompressed again for each tile of rows, so for the large inputs the GEMM is compute bound.
+    // Then a thread unpacks the weights of a tile to f32 once and reuses them for all its tiles of rows.
+    constexpr size_t maxCompressedRows = 256;
+    unpackCompressedWeights = M > maxCompressedRows;
+
+    const size_t tileChannels = compressedBlocksPerTile * fc_compressed_block;
+    compressedScratchPerThread = 0;
+    if (unpackCompressedWeights)
+        compressedScratchPerThread += compressedConf.K * tileChannels;
+    if (outputDataType == memory::data_type::bf16)
+        compressedScratchPerThread += compressedRowsPerTile * tileChannels;
+    if (compressedScratchPerThread == 0)
+        return;
+    const size_t threads = parallel_get_max_threads();
+    compressedScratch = getScratchPadMem(std::make_shared<DnnlBlockedMemoryDesc>(
+        Precision::FP32, Shape(VectorDims{threads * compressedScratchPerThread})));
+}
+
+void FullyConnected::executeCompressed() {
+    using namespace InferenceEngine::Extensions::Cpu;
+    const auto srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    const auto dstMem = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& srcDims = srcMem->getStaticDims();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t N = compressedConf.N;
+    const size_t K = compressedConf.K;
+    const bool isDstBf16 = outputDataType == memory::data_type::bf16;
+    const size_t tileChannels = compressedBlocksPerTile * fc_compressed_block;
+
+    const auto src = srcMem->GetPtr();
+    const auto weights = reinterpret_cast<const uint8_t*>(packedWeights->GetPtr());
+    const float* zeroPoints = packedZeroPoints.empty() ? nullptr : packedZeroPoints.data();
+    const float* bias = packedBias.empty() ? nullptr : packedBias.data();
+    const auto scratch = compressedScratch ? reinterpret_cast<float*>(compressedScratch->GetPtr()) : nullptr;
+
+    const size_t rowTiles = div_up(M, compressedRowsPerTile);
+    const size_t blocks = div_up(N, fc_compressed_block);
+    const size_t blockTiles = div_up(blocks, compressedBlocksPerTile);
+    const size_t threads = parallel_get_max_threads();
+    parallel_nt(threads, [&](const int ithr, const int nthr) {
+        float* unpacked = scratch ? scratch + ithr * compressedScratchPerThread : nullptr;
+        float* dstTile = unpackCompressedWeights ? unpacked + K * tileChannels : unpacked;
+        // the tiles of a thread are contiguous and mostly share the output channels, so the unpacked weights are reused
+        size_t unpackedTile = blockTiles;
+        for_2d(ithr, nthr, blockTiles, rowTiles, [&](size_t nt, size_t mt) {
+            const size_t mBegin = mt * compressedRowsPerTile;
+            const size_t mEnd = (std::min)(M, mBegin + compressedRowsPerTile);
+            const size_t nbBegin = nt * compressedBlocksPerTile;
+            const size_t nbEnd = (std::min)(blocks, nbBegin + compressedBlocksPerTile);
+            const size_t nBegin = nbBegin * fc_compressed_block;
+            const size_t nEnd = (std::min)(N, nbEnd * fc_compressed_block);
+
+            // the bf16 output tile is computed in f32 and converted once the post-ops are applied
+            float* dst = isDstBf16 ? dstTile : reinterpret_cast<float*>(dstMem->GetPtr()) + mBegin * N + nBegin;
+            const size_t dstStride = isDstBf16 ? tileChannels : N;
+            const fc_compressed_args args = {src, K, weights, packedScales.data(), zeroPoints, bias, dst, dstStride};
+            if (unpackCompressedWeights) {
+                if (unpackedTile != nt) {
+                    XARCH::fc_compressed_unpack(compressedConf, args, nbBegin, nbEnd, unpacked);
+                    unpackedTile = nt;
+                }
+                XARCH::fc_unpacked_gemm(compressedConf, args, unpacked, mBegin, mEnd, nbBegin, nbEnd);
+            } else {
+                XARCH::fc_compressed_gemm(compressedConf, args, mBegin, mEnd, nbBegin, nbEnd);
+            }
+            applyCompressedPostOps(dst, dstStride, mEnd - mBegin, nBegin, nEnd);
+
+            if (isDstBf16) {
+                auto dstBf16 = reinterpret_cast<bfloat16_t*>(dstMem->GetPtr());
+                for (size_t m = mBegin; m < mEnd; m++) {
+                    const float* row = dst + (m - mBegin) * dstStride;
+                    for (size_t n = nBegin; n < nEnd; n++)
+                        dstBf16[m * N + n] = bfloat16_t(row[n - nBegin]);
+                }
+            }
+        });
+    });
+}
+
+void FullyConnected::initCompressedPostOps() {
+    compressedPostOps.clear();
+    const auto& postOps = (*attr.get()).post_ops_;
+    for (int i = 0; i < postOps.len(); i++) {
+        const auto& postOp = postOps.entry_[i];
+        CompressedPostOp compressedPostOp;
+        if (postOp.is_eltwise()) {
+            compressedPostOp.eltwise = std::make_shared<dnnl::impl::cpu::ref_eltwise_scalar_fwd_t>(
+                postOp.eltwise.alg, postOp.eltwise.alpha, postOp.eltwise.beta, postOp.eltwise.scale);
+        } else if (postOp.is_binary()) {
+            const auto data = postOpsArgs.find(DNNL_ARG_ATTR_MULTIPLE_POST_OP(i) | DNNL_ARG_SRC_1);
+            if (data == postOpsArgs.end())
+                IE_THROW() << errorPrefix << " has no data for the binary post operation " << i << ".";
+            compressedPostOp.binaryAlg = postOp.binary.alg;
+            compressedPostOp.binaryData = reinterpret_cast<const float*>(data->second->GetPtr());
+            compressedPostOp.binaryPerChannel = data->second->GetShape().getElementsCount() > 1;
+        } else {
+            IE_THROW() << errorPrefix << " doesn't support the post operation " << i << " with compressed weights.";
+        }
+        compressedPostOps.push_back(compressedPostOp);
+    }
+}
+
+void FullyConnected::applyCompressedPostOps(float* dst, size_t dstStride, size_t rows, size_t nBegin, size_t nEnd) const {
+    for (const auto& postOp : compressedPostOps) {
+        for (size_t r = 0; r < rows; r++) {
+            float* row = dst + r * dstStride;
+            if (postOp.eltwise) {
+                for (size_t n = nBegin; n < nEnd; n++)
+                    row[n - nBegin] = postOp.eltwise->compute_scalar(row[n - nBegin]);
+                continue;
+            }
+            for (size_t n = nBegin; n < nEnd; n++) {
+                float& x = row[n - nBegin];
+                const float value = postOp.binaryData[postOp.binaryPerChannel ? n : 0];
+                switch (postOp.binaryAlg) {
+                case dnnl_binary_add:
+                    x += value;
+                    break;
+                case dnnl_binary_mul:
+                    x *= value;
+                    break;
+                case dnnl_binary_max:
+                    x = (std::max)(x, value);
+                    break;
+                case dnnl_binary_min:
+                    x = (std::min)(x, value);
+                    break;
+                case dnnl_binary_prelu:
+                    x = x >= 0.f ? x : x * value;
+                    break;
+                default:
+                    IE_THROW() << errorPrefix << " doesn't support the binary post operation with compressed weights.";
+                }
+            }
+        }
+    }
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
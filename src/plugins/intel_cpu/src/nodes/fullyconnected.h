@@ -8,9 +8,12 @@
 #include <node.h>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <cpu/ref_eltwise.hpp>
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "fc_compressed_gemm.hpp"
+#include "fc_sparse_gemm.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -20,6 +23,8 @@ class FullyConnected : public Node {
 public:
     FullyConnected(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
 
+    void init() override;
+
     std::vector<dnnl::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
     void execute(dnnl::stream strm) override;
@@ -60,6 +65,17 @@ public:
         return withBiases;
     }
 
+    // The weights decompression is kept by the transformations and fused by the graph optimizer only when this holds,
+    // so the decompression subgraph is never left to be executed on each inference
+    static bool isSupportedWeightsDecompression(InferenceEngine::Precision weightsPrecision,
+                                                InferenceEngine::Precision activationsPrecision,
+                                                size_t activationsRank);
+    // Keeps int8 weights compressed: scales and zero points are [N, groups], zero points may be empty
+    void fuseDecompression(const std::vector<float>& scales, const std::vector<float>& zeroPoints, size_t groups);
+    bool withWeightsDecompression() const {
+        return useWeightsDecompression;
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -100,9 +116,54 @@ private:
     // sparse weights
     bool useSparseWeights = false;
     float minSparseRate = 1.f;
+    float minSparseKernelRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
     bool isINT8 = false;
+
+    // sparse fp32 weights, the non zero weights are packed in CSR format
+    bool useSparseWeightsKernel();
+    void prepareSparseWeights();
+    void executeSparse();
+    bool useSparseKernel = false;
+    MemoryCPtr sparseWeights;
+    std::vector<float> sparseScratch;
+    size_t sparseScratchPerThread = 0;
+
+    // the weights are processed by the plugin kernels instead of oneDNN
+    bool withCustomKernel() const {
+        return useWeightsDecompression || useSparseKernel;
+    }
+
+    // compressed weights
+    void prepareCompressedWeights();
+    void prepareCompressedParams();
+    void executeCompressed();
+    bool useWeightsDecompression = false;
+    size_t decompressionGroups = 1;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    InferenceEngine::Extensions::Cpu::fc_compressed_conf compressedConf = {};
+    MemoryCPtr packedWeights;
+    std::vector<float> packedScales;
+    std::vector<float> packedZeroPoints;
+    std::vector<float> packedBias;
+    // the inputs with many rows reuse the weights of a tile unpacked once by a thread
+    bool unpackCompressedWeights = false;
+    // per thread: the unpacked weights tile and the f32 output tile for the bf16 output
+    MemoryPtr compressedScratch;
+    size_t compressedScratchPerThread = 0;
+
+    // the post-ops of the compressed weights kernel are applied to each f32 output tile before it's stored
+    struct CompressedPostOp {
+        std::shared_ptr<dnnl::impl::cpu::ref_eltwise_scalar_fwd_t> eltwise;
+        dnnl_alg_kind_t binaryAlg = dnnl_alg_kind_undef;
+        const float* binaryData = nullptr;
+        bool binaryPerChannel = false;
+    };
+    void initCompressedPostOps();
+    void applyCompressedPostOps(float* dst, size_t dstStride, size_t rows, size_t nBegin, size_t nEnd) const;
+    std::vector<CompressedPostOp> compressedPostOps;
 };
 
 }   // namespace node
@@ -17,6 +17,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "fake_quantize.h"
+#include "memory.hpp"
 #include "utils/general_utils.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include <dnnl_extension_utils.h>
@@ -306,6 +307,30 @@ static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
     return strides;
 }
 
+/* The same as above, but the strides are taken from the memory, so the batch strides may be not dense
+ * (the strided view of the appended state of the ReadValue node)
+ */
+static VectorDims getMemoryStridesAndModifyShape(const MemoryPtr& mem, Shape& shape, const bool transpose) {
+    auto strides = mem->GetDescWithType<BlockedMemoryDesc>()->getStrides();
+    const auto getRank = shape.getRank();
+
+    if (transpose && getRank > 1) {
+        auto dims = shape.getStaticDims();
+        std::swap(dims[getRank - 2], dims[getRank - 1]);
+        shape = Shape{dims};
+        std::swap(strides[getRank - 2], strides[getRank - 1]);
+    }
+
+    return strides;
+}
+
+// The appended state of the key/value cache may be exposed as a strided view of its store (see MemoryInput),
+// only such inputs are read with the batch strides of the memory, the others keep the dense layout
+bool MatMul::isAppendedStateInput(size_t port) const {
+    const auto state = std::dynamic_pointer_cast<MemoryInput>(getParentEdgesAtPort(port)[0]->getParent());
+    return state && state->isAppendMode();
+}
+
 dnnl::memory::desc MatMul::getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc) {
     // oneDNN matmul requires shape for bias desc to be the same rank
     VectorDims biasDims(outMemDesc->getShape().getRank(), 1);
@@ -514,7 +539,17 @@ void MatMul::initSupportedPrimitiveDescriptors() {
                 PortConfig portConfig;
                 portConfig.inPlace(-1);
                 portConfig.constant(false);
-                portConfig.setMemDesc(getSrcMemDesc(itpd, i));
+                auto srcDesc = getSrcMemDesc(itpd, i);
+                const auto rank = srcDesc->getShape().getRank();
+                if (isDynamicNode() && i < 2 && rank > 2 && isAppendedStateInput(i)) {
+                    // the batch strides are taken from the input memory in prepareParams, so any of them are accepted
+                    BlockedMemoryDesc::CmpMask inputMask = BLOCKED_DESC_FULL_MASK;
+                    for (size_t j = 0; j + 2 < rank; j++)
+                        inputMask.reset(j);
+                    portConfig.setMemDesc(std::dynamic_pointer_cast<BlockedMemoryDesc>(srcDesc), inputMask);
+                } else {
+                    portConfig.setMemDesc(srcDesc);
+                }
 
                 config.inConfs.push_back(portConfig);
             }
@@ -581,11 +616,13 @@ void MatMul::prepareParams() {
         const auto& src1Desc = src1MemPtr->getDesc();
 
         auto src0Shape = src0Desc.getShape();
-        auto src0Strides = getStridesAndModifyShape(src0Shape, transposeIn[0]);
+        auto src0Strides = isAppendedStateInput(0) ? getMemoryStridesAndModifyShape(src0MemPtr, src0Shape, transposeIn[0])
+                                                   : getStridesAndModifyShape(src0Shape, transposeIn[0]);
         src0TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src0Desc.getPrecision(), src0Shape, src0Strides);
 
         auto src1Shape = src1Desc.getShape();
-        auto src1Strides = getStridesAndModifyShape(src1Shape, transposeIn[1]);
+        auto src1Strides = isAppendedStateInput(1) ? getMemoryStridesAndModifyShape(src1MemPtr, src1Shape, transposeIn[1])
+                                                   : getStridesAndModifyShape(src1Shape, transposeIn[1]);
         src1TransposedDesc = std::make_shared<DnnlBlockedMemoryDesc>(src1Desc.getPrecision(), src1Shape, src1Strides);
     } else {
         attr = initPrimitiveAttr();
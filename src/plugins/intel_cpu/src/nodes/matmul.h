@@ -53,6 +53,7 @@ private:
     executorPtr execPtr = nullptr;
     dnnl::memory::desc getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc);
     std::pair<Shape, Shape> makeDummyInputShapes(const Shape& in0, const Shape& in1) const;
+    bool isAppendedStateInput(size_t port) const;
 
     bool withBiases;
 
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms_blocked.h"
 #include "ngraph/opsets/opset8.hpp"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
@@ -152,24 +153,6 @@ static inline float boxArea(const float* bbox, const bool normalized) {
         }
     }
 }
-
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
@@ -191,20 +174,25 @@ size_t MatrixNms::nmsMatrix(const float* boxesData, const float* scoresData, Box
         return scoresData[a] > scoresData[b];
     });
 
+    NmsBoxes sortedBoxes;
+    sortedBoxes.resize(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        sortedBoxes.set(i, box[0], box[1], box[2], box[3], boxArea(box, m_normalized));
+    }
+    const Extensions::Cpu::nms_iou_conf iouConf = {m_normalized ? 0.f : 1.f, true};
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (size_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
+        float* iouRow = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        sortedBoxes.iou(sortedBoxes.get(actual_index), 0, actual_index, iouConf, iouRow);
+        float max_iou = 0.;
+        for (size_t j = 0; j < actual_index; j++)
+            max_iou = std::max(max_iou, iouRow[j]);
         iouMax[actual_index] = max_iou;
     });
 
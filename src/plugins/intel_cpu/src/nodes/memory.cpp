@@ -2,15 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
-#include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
+#include "utils/shape_inference/shape_inference_cpu.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -31,11 +32,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -88,11 +84,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -105,8 +96,108 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
     return true;
 }
 
+namespace {
+class MemoryInputShapeInfer : public ShapeInferEmptyPads {
+public:
+    explicit MemoryInputShapeInfer(const MemoryInput& node) : m_node(node) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        static const VectorDims noInput;
+        return {{m_node.getOutputDims(input_shapes.empty() ? noInput : input_shapes.front().get())},
+                ShapeInferStatus::success};
+    }
+
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    const MemoryInput& m_node;
+};
+
+// The consumers may read the state right from its memory only if none of them modifies its input in place.
+// Follows the rules used for the in place inputs of TensorIterator body
+bool canExposeStore(const Node& node) {
+    for (const auto& edge : node.getChildEdges()) {
+        auto childEdge = edge.lock();
+        if (!childEdge)
+            IE_THROW() << "Node " << node.getName() << " contains empty child edge";
+
+        const auto& child = childEdge->getChild();
+        if (child->isConstant() || child->isInPlace() ||
+            one_of(child->getType(), Type::Concatenation, Type::Split, Type::Output))
+            return false;
+
+        for (const auto& grandChildEdge : child->getChildEdges()) {
+            auto e = grandChildEdge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().getDnnlMemoryMngr() == childEdge->getMemory().getDnnlMemoryMngr())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The store of the appended state is [outer][capacity][inner], so its view of the actual length has the strides
+// of the dimensions before the append axis different from the dense ones
+bool acceptsOuterStrides(const Node& node, size_t axis) {
+    const auto& outConfs = node.getSelectedPrimitiveDescriptor()->getConfig().outConfs;
+    const auto outDesc = std::dynamic_pointer_cast<BlockedMemoryDesc>(outConfs[0].getMemDesc());
+    if (!outDesc)
+        return false;
+
+    BlockedMemoryDesc::CmpMask viewMask = BLOCKED_DESC_FULL_MASK;
+    for (size_t j = 0; j < axis; j++)
+        viewMask.reset(j);
+    const PortDescBlocked viewPortDesc(outDesc, viewMask);
+
+    for (const auto& edge : node.getChildEdgesAtPort(0)) {
+        const auto selected = edge->getChild()->getSelectedPrimitiveDescriptor();
+        if (!selected)
+            return false;
+        const auto& inConfs = selected->getConfig().inConfs;
+        const auto port = edge->getOutputNum();
+        if (port < 0 || static_cast<size_t>(port) >= inConfs.size() ||
+            !inConfs[port].getPortDesc()->isCompatible(viewPortDesc))
+            return false;
+    }
+    return true;
+}
+
+// Assign of static shape may take the next value of the state right from the memory of its producer
+// if the producer doesn't share this memory with its inputs and none of the consumers modifies it in place
+bool canWriteStore(const Node& node) {
+    if (node.isDynamicNode() || node.getParentEdges().empty())
+        return false;
+
+    const auto producer = node.getParentEdgeAt(0)->getParent();
+    if (producer->isDynamicNode() || producer->isConstant() || producer->isInPlace() ||
+        one_of(producer->getType(), Type::Input, Type::MemoryInput, Type::Concatenation, Type::Split))
+        return false;
+    return canExposeStore(*producer);
+}
+}   // namespace
+
+void MemoryOutput::createPrimitive() {
+    zeroCopyInput = canWriteStore(*this);
+}
+
+void MemoryOutput::assignState(const std::shared_ptr<VariableState>& state) {
+    if (!zeroCopyInput)
+        return;
+
+    // the store is double buffered, so the producer writes the next value while ReadValue exposes the current one
+    const auto& next = state->getNextStore();
+    auto& srcMem = getParentEdgeAt(0)->getMemory();
+    if (srcMem.getDesc().isCompatible(next->getDesc()))
+        srcMem.getDnnlMemoryMngr()->setExtBuff(next->GetData(), next->GetSize());
+}
+
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr ctx)
-        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}) {
+        : Input(op, ctx), MemoryNode(op) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -114,61 +205,136 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
     if (created()) {
         holder = MemoryNodeVirtualEdge::registerInput(this);
     }
+
+    if (isDynamicNode()) {
+        shapeInference = std::make_shared<MemoryInputShapeInfer>(*this);
+        // default memory state is zero filled and has the shape of the initializer, or no elements if it's unknown
+        if (op->get_input_size() > 0 && op->get_input_partial_shape(0).is_static()) {
+            initialDims = op->get_input_shape(0);
+        } else {
+            initialDims = getOutputShapeAtPort(0).getDims();
+            std::replace(initialDims.begin(), initialDims.end(), Shape::UNDEFINED_DIM, size_t(0));
+        }
+    }
+}
+
+void MemoryInput::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    if (!isAppendMode()) {
+        Input::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    // the input is the tensor appended to the state at each inference
+    const auto precision = getOriginalOutputPrecisionAtPort(0);
+    addSupportedPrimDesc({{LayoutType::ncsp, precision}},
+                         {{LayoutType::ncsp, precision}},
+                         impl_desc_type::unknown);
 }
 
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
+    const auto& childMem = getChildEdgeAt(0)->getMemory();
+    if (!isDynamicNode()) {
+        stateDesc = childMem.getDescPtr();
+        initialDims = childMem.getStaticDims();
+    } else {
+        stateDesc = std::make_shared<CpuBlockedMemoryDesc>(childMem.getDesc().getPrecision(), getOutputShapeAtPort(0));
+    }
+    // the state is double buffered, so the output may point to it even if the Assign of the variable
+    // is executed before the consumers of ReadValue
+    zeroCopyOutput = canExposeStore(*this);
+    stridedOutput = zeroCopyOutput && isAppendMode() && acceptsOuterStrides(*this, appendAxis);
 
-    // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->FillZero();
+    // the default state is used until the infer request binds its own one
+    state = makeState();
 }
 
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(const Memory& dst, const Memory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
-    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
-    if (src.GetDataType() == dst.GetDataType()) {
-        auto srcSizeInByte = src.GetSize();
-        auto dstSizeInByte = dst.GetSize();
+std::shared_ptr<VariableState> MemoryInput::makeState() const {
+    auto name = getId();
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        name = name.substr(0, suffix_idx);
 
-        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
+    return std::make_shared<VariableState>(name, getEngine(), stateDesc, initialDims, appendAxis);
+}
 
-        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
-    } else {
-        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
-            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+bool MemoryInput::needShapeInfer() const {
+    // the state shape changes between inferences regardless of the inputs
+    return isDynamicNode();
+}
+
+void MemoryInput::setAppendAxis(size_t axis) {
+    appendAxis = static_cast<int>(axis);
+}
+
+VectorDims MemoryInput::getOutputDims(const VectorDims& inputDims) const {
+    const auto& stateDims = state ? state->getDims() : initialDims;
+    if (!isAppendMode())
+        return stateDims;
+
+    const size_t axis = appendAxis;
+    if (stateDims[axis] == 0)
+        return inputDims;
+
+    auto dims = stateDims;
+    dims[axis] += inputDims[axis];
+    return dims;
+}
+
+void MemoryInput::redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) {
+    if (!stridedOutput) {
+        Node::redefineOutputMemory(newOutputShapes);
+        return;
     }
+
+    // the store is reserved for the appended state before the consumers prepare their params with its strides
+    const auto& newDims = newOutputShapes.front();
+    state->prepareAppend(newDims);
+    const auto viewDesc = state->getViewDesc(newDims);
+    const auto& store = state->getStore();
+    for (const auto& edge : getChildEdgesAtPort(0))
+        edge->getMemoryPtr()->Create(viewDesc, store->GetData());
 }
 
 MemoryInput::~MemoryInput() {
     MemoryNodeVirtualEdge::remove(this, holder);
 }
 
-MemoryPtr MemoryInput::getStore() {
-    return dataStore;
-}
-
 void MemoryInput::storeState(const Memory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    state->assign(new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    auto& dstMem = getChildEdgeAt(0)->getMemory();
+    if (!isDynamicNode()) {
+        // the store of the static state has the layout of the output
+        const auto& store = state->getStore();
+        if (zeroCopyOutput)
+            dstMem.getDnnlMemoryMngr()->setExtBuff(store->GetData(), store->GetSize());
+        else
+            cpu_memcpy(dstMem.GetPtr(), store->GetPtr(), store->GetSize());
+        return;
+    }
+
+    if (isAppendMode())
+        state->append(getParentEdgeAt(0)->getMemory());
+
+    // the strided view is already set up by redefineOutputMemory()
+    if (stridedOutput || dstMem.GetShape().hasZeroDims())
+        return;
+
+    if (zeroCopyOutput) {
+        const auto& exposed = state->isDense() ? state->getStore() : state->getDenseState();
+        dstMem.getDnnlMemoryMngr()->setExtBuff(exposed->GetData(), exposed->GetSize());
+    } else {
+        const auto value = state->getDenseState();
+        cpu_memcpy(dstMem.GetData(), value->GetData(), value->GetSize());
+    }
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
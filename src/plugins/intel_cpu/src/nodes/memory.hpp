@@ -8,6 +8,7 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "memory_state.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -23,7 +24,7 @@ class MemoryNode {
     explicit MemoryNode(std::string id) : _id(id) {}
     explicit MemoryNode(const std::shared_ptr<ngraph::Node>& op);
     virtual ~MemoryNode() = default;
-    std::string getId() {
+    std::string getId() const {
         return _id;
     }
     virtual void setInputNode(Node *) = 0;
@@ -66,22 +67,40 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
+    bool isExecutable() const override {
+        // an empty state has to be stored as well
+        return true;
+    }
+    bool needPrepareParams() const override {
+        return false;
+    }
 
     void setInputNode(Node* node) override {
         inputNode = node;
     }
 
+    /**
+     * @brief The producer of the static shape input may write the next value of the bound state right to its memory,
+     * so Assign doesn't copy it
+     */
+    void assignState(const std::shared_ptr<VariableState>& state);
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    // the input may point to the next state memory if its producer writes only this tensor
+    bool zeroCopyInput = false;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -96,16 +115,55 @@ public:
     bool isExecutable() const override {
         return true;
     }
+    void initSupportedPrimitiveDescriptors() override;
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    bool needShapeInfer() const override;
+    bool needPrepareParams() const override {
+        return false;
+    }
+    void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes) override;
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
-    MemoryPtr getStore();
+
+    /**
+     * @brief Creates the zero filled state of the variable, which may be bound to the node
+     */
+    std::shared_ptr<VariableState> makeState() const;
+    /**
+     * @brief The node reads and writes the memory of the bound state directly, so binding doesn't copy
+     */
+    void assignState(const std::shared_ptr<VariableState>& newState) {
+        state = newState;
+    }
+
+    /**
+     * @brief Fuses ReadValue -> Concat -> Assign pattern: the tensor on the input port is appended to the state
+     * along the axis in place and the output is the whole updated state.
+     */
+    void setAppendAxis(size_t axis);
+    bool isAppendMode() const {
+        return appendAxis >= 0;
+    }
+    VectorDims getOutputDims(const VectorDims& inputDims) const;
+
  private:
-    MemoryPtr dataStore;
+    std::shared_ptr<VariableState> state;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+
+    MemoryDescPtr stateDesc;
+    VectorDims initialDims;
+    int appendAxis = -1;
+    // the output may point to the state memory if none of the consumers modifies its input in place
+    bool zeroCopyOutput = false;
+    // the appended state is exposed as the strided view of its store if all the consumers accept the outer strides,
+    // so the margin along the append axis isn't gathered out at each inference
+    bool stridedOutput = false;
 };
 
 }   // namespace node
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -73,7 +74,19 @@ private:
         mov(reg_buffer_aux, reg_buffer);
         mov(reg_work_amount, jcp_.work_amount);
         mov(reg_work_amount_aux, reg_work_amount);
-        uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        if (jcp_.is_online) {
+            // the running max of the previous blocks
+            mov(reg_max, ptr[reg_params + GET_OFF(p_max)]);
+            uni_vmovss(get_xmm_max(0), ptr[reg_max]);
+            uni_vbroadcastss(get_vmm_max(0), get_xmm_max(0));
+        } else {
+            uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
+        }
+
+        if (jcp_.broadcast_add_in1) {
+            uni_vmovss(Xmm(get_vmm_in(2).getIdx()), ptr[reg_add_in1]);
+            uni_vbroadcastss(get_vmm_in(2), Xmm(get_vmm_in(2).getIdx()));
+        }
 
         // mul1 input is const and always float
         if (jcp_.with_mul_scales) {
@@ -117,12 +130,19 @@ private:
 
         sub(rsp, sizeof(float) * vec_size);
         uni_vmovups(ptr[rsp], get_vmm_max(0));
-        uni_vpxor(get_vmm_max(0), get_vmm_max(0), get_vmm_max(0));
-        for (size_t i = 0; i < vec_size; i++) {
+        uni_vmovss(get_xmm_max(0), ptr[rsp]);
+        for (size_t i = 1; i < vec_size; i++) {
             mov(reg_tmp_32, ptr[rsp + i * sizeof(float)]);
             vmovq(xmm_tmp, reg_tmp);
             uni_vmaxps(get_xmm_max(0), get_xmm_max(0), xmm_tmp);
         }
+        if (jcp_.is_online) {
+            uni_vmovss(ptr[reg_max], get_xmm_max(0));
+            // fully masked row: the max is -inf, it's replaced with the lowest value to get zero exponents instead of NaNs
+            mov(reg_tmp, dnnl::impl::float2int(std::numeric_limits<float>::lowest()));
+            vmovq(xmm_tmp, reg_tmp);
+            uni_vmaxps(get_xmm_max(0), get_xmm_max(0), xmm_tmp);
+        }
         uni_vbroadcastss(get_vmm_max(0), get_xmm_max(0));
         add(rsp, sizeof(float) * vec_size);
 
@@ -156,6 +176,13 @@ private:
         vbroadcastss(get_vmm_aux(0), get_xmm_aux(0));
         add(rsp, sizeof(float) * vec_size);
 
+        if (jcp_.is_online) {
+            mov(reg_tmp, ptr[reg_params + GET_OFF(p_sum)]);
+            uni_vmovss(ptr[reg_tmp], get_xmm_aux(0));
+            postamble_and_emit_data();
+            return;
+        }
+
         mov(reg_tmp, dnnl::impl::float2int(1.0f));
         vmovq(xmm_tmp, reg_tmp);
         vbroadcastss(get_vmm_denom(0), xmm_tmp);
@@ -186,6 +213,10 @@ private:
             mul_loop(tail_size);
         }
 
+        postamble_and_emit_data();
+    }
+
+    void postamble_and_emit_data() {
         this->postamble();
 
         for (const auto& emitter : emitters) {
@@ -200,7 +231,8 @@ private:
         bool is_tail = step < vec_size;
 
         load(get_vmm_in(0), reg_in0, jcp_.src_prc, step, is_tail);
-        load(get_vmm_in(2), reg_add_in1, Precision::FP32, step, is_tail);
+        if (!jcp_.broadcast_add_in1)
+            load(get_vmm_in(2), reg_add_in1, Precision::FP32, step, is_tail);
 
         if (jcp_.with_scales0) {
             if (!jcp_.broadcast_scales0) {
@@ -230,7 +262,8 @@ private:
 
         if (!is_tail) {
             add(reg_in0, jcp_.src_prc.size() * step);
-            add(reg_add_in1, sizeof(float) * step);
+            if (!jcp_.broadcast_add_in1)
+                add(reg_add_in1, sizeof(float) * step);
             add(reg_buffer_aux, sizeof(float) * step);
         }
     }
@@ -247,10 +280,17 @@ private:
 
         uni_vaddps(get_vmm_denom(0), get_vmm_denom(0), get_vmm_in(0));
 
-        store(reg_buffer_aux, get_vmm_in(0), Precision::FP32, step);
+        if (jcp_.is_online) {
+            // the exponents of the block are stored right away, they are normalized after the last block
+            store(reg_out, get_vmm_in(0), jcp_.dst_prc, step);
+        } else {
+            store(reg_buffer_aux, get_vmm_in(0), Precision::FP32, step);
+        }
 
         if (!is_tail) {
             add(reg_buffer_aux, sizeof(float) * step);
+            if (jcp_.is_online)
+                add(reg_out, jcp_.dst_prc.size() * step);
         }
     }
 
@@ -667,6 +707,27 @@ private:
 
 #endif // OPENVINO_ARCH_X86_64
 
+namespace {
+// rows block of the brgemm kernels in both implementations
+constexpr size_t rowsBlk = 32;
+// the keys block of the tiled implementation isn't grown further to keep the tail block small
+constexpr size_t maxKvBlk = 512;
+
+std::unique_ptr<jit_uni_mul_add_softmax_kernel> createMulAddSoftmaxKernel(const jit_mul_add_softmax_compile_params& jcp) {
+    std::unique_ptr<jit_uni_mul_add_softmax_kernel> kernel;
+#if defined(OPENVINO_ARCH_X86_64)
+    if (mayiuse(cpu_isa_t::avx512_core)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(jcp));
+    } else if (mayiuse(cpu_isa_t::avx2)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(jcp));
+    } else if (mayiuse(cpu_isa_t::sse41)) {
+        kernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(jcp));
+    }
+#endif // OPENVINO_ARCH_X86_64
+    return kernel;
+}
+}  // namespace
+
 bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         const auto mha = std::dynamic_pointer_cast<const MHANode>(op);
@@ -675,9 +736,21 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             return false;
         }
 
+        // only the tiled implementation is able to handle arbitrary masks, see isFlashAttentionApplicable()
+        const bool isFloatMHA = one_of(mha->get_input_element_type(0), element::f32, element::bf16) &&
+                                mha->get_input_element_type(0) == mha->get_input_element_type(1) &&
+                                mha->get_input_element_type(0) == mha->get_input_element_type(3) &&
+                                one_of(mha->get_output_element_type(0), element::f32, element::bf16);
+        const bool withFQ = !mha->get_fq_scales0().empty() || !mha->get_fq_scales1().empty() ||
+                            !mha->get_fq_scales2().empty() || !mha->get_fq_scales3().empty();
+        const bool isTiledSupported = isFloatMHA && !withFQ;
+
         if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
+            // the masks may come with any shape in runtime
+            if (!isTiledSupported) {
+                errorMessage = "Supports only f32 and bf16 MHA without FakeQuantize with dynamic shapes";
+                return false;
+            }
         }
 
         bool supportedPrecisions = true;
@@ -732,10 +805,29 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             return false;
         }
 
-        if (mha->get_input_shape(0).size() != 4) {
+        if (mha->get_input_partial_shape(0).rank().get_length() != 4) {
             errorMessage = "Doesn't support inputs with rank != 4";
             return false;
         }
+
+        const auto& maskShape = mha->get_input_partial_shape(2);
+        if (maskShape.rank().is_dynamic() || maskShape.rank().get_length() != 4) {
+            errorMessage = "Doesn't support mask with rank != 4";
+            return false;
+        }
+
+        if (!isTiledSupported && !isDynamicNgraphNode(op)) {
+            // the fused mul-add-softmax kernel broadcasts the mask over the rows, so it handles padding masks only
+            const auto mask = maskShape.to_shape();
+            const auto& in0 = mha->get_input_shape(0);
+            const auto& in1 = mha->get_input_shape(1);
+            const bool isPaddingMask = mask[0] == in0[0] && mask[1] == 1 && mask[2] == 1 && mask[3] == in1[1];
+            if (!isPaddingMask) {
+                errorMessage = "Doesn't support mask with shape " + maskShape.to_string() +
+                               " for quantized MHA or MHA with FakeQuantize";
+                return false;
+            }
+        }
     } catch (...) {
         return false;
     }
@@ -923,11 +1015,30 @@ void MHA::prepareParams() {
     std::vector<size_t> orderTranspose2 = {0, 2, 1, 3};
     dimsMatMul1In1 = transpose(dimsTranspose2In0, orderTranspose2);
 
+    // The fused mul-add-softmax kernel broadcasts the mask over the rows, so it handles padding masks only.
+    // Any other mask requires the tiled implementation which is also preferred for long sequences.
+    const bool isPaddingMask = dimsAddIn1[0] == dimsMatMul0In0[0] && dimsAddIn1[1] == 1 && dimsAddIn1[2] == 1 &&
+                               dimsAddIn1[3] == dimsMatMul0In1[3];
+    // The fused kernel computes the whole rows of the scores, so every rows block reads all the keys and values of the
+    // head. Once they don't fit the L2 cache together with the scores, the tiled implementation which streams them by
+    // blocks is faster.
+    const size_t l2CacheSize = dnnl::utils::get_cache_size(2, true);
+    const size_t bytesPerKey = (dimsMatMul0In0[3] + dimsMatMul1In1[3]) * inputPrecisions[0].size() + rowsBlk * sizeof(float);
+    const size_t flashAttentionMinSeqLen = l2CacheSize / bytesPerKey;
+    useFlashAttention = isFlashAttentionApplicable() && (!isPaddingMask || dimsMatMul0In1[3] >= flashAttentionMinSeqLen);
+    if (useFlashAttention) {
+        prepareFlashAttention();
+        return;
+    }
+    if (!isPaddingMask) {
+        THROW_ERROR << "doesn't support mask with shape " << vec2str(dimsAddIn1);
+    }
+
     bool isAMXSupported = mayiuse(avx512_core_amx);
 
     size_t numThreads = parallel_get_max_threads();
 
-    size_t matmulOptimalM = 32;
+    size_t matmulOptimalM = rowsBlk;
 
     batch0 = dimsMatMul0Out[0];
     batch1 = dimsMatMul0Out[1];
@@ -1091,16 +1202,10 @@ void MHA::prepareParams() {
         jcp.broadcast_scales0 = fqScales1.size() == 1;
         jcp.with_scales1 = !fqScales2.empty();
         jcp.broadcast_scales1 = fqScales2.size() == 1;
+        jcp.broadcast_add_in1 = false;
+        jcp.is_online = false;
 
-#if defined(OPENVINO_ARCH_X86_64)
-        if (mayiuse(cpu_isa_t::avx512_core)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx512_core>(jcp));
-        } else if (mayiuse(cpu_isa_t::avx2)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::avx2>(jcp));
-        } else if (mayiuse(cpu_isa_t::sse41)) {
-            mulAddSoftmaxKernel.reset(new jit_mul_add_softmax_kernel<cpu_isa_t::sse41>(jcp));
-        }
-#endif // OPENVINO_ARCH_X86_64
+        mulAddSoftmaxKernel = createMulAddSoftmaxKernel(jcp);
         if (!mulAddSoftmaxKernel) {
             THROW_ERROR << "cannot create jit eltwise kernel";
         }
@@ -1180,6 +1285,176 @@ void MHA::prepareParams() {
     }
 }
 
+bool MHA::isFlashAttentionApplicable() const {
+    return one_of(inputPrecisions[0], Precision::FP32, Precision::BF16) &&
+           inputPrecisions[0] == inputPrecisions[1] && inputPrecisions[0] == inputPrecisions[3] &&
+           fqScales0.empty() && fqScales1.empty() && fqScales2.empty() && fqScales3.empty() &&
+           one_of(getOriginalOutputPrecisionAtPort(0), Precision::FP32, Precision::BF16);
+}
+
+void MHA::updateBrgemm(brgemmCtx& ctx, const brgemmCtx& newCtx, std::unique_ptr<brgemm_kernel_t>& brgKernel, bool use_amx) {
+    const bool isSame = brgKernel && ctx.M == newCtx.M && ctx.N == newCtx.N && ctx.K == newCtx.K &&
+                        ctx.LDA == newCtx.LDA && ctx.LDB == newCtx.LDB && ctx.LDC == newCtx.LDC &&
+                        ctx.dt_in0 == newCtx.dt_in0 && ctx.dt_in1 == newCtx.dt_in1 && ctx.beta == newCtx.beta &&
+                        ctx.is_with_amx == use_amx;
+    if (isSame)
+        return;
+
+    ctx.M = newCtx.M;
+    ctx.N = newCtx.N;
+    ctx.K = newCtx.K;
+    ctx.LDA = newCtx.LDA;
+    ctx.LDB = newCtx.LDB;
+    ctx.LDC = newCtx.LDC;
+    ctx.dt_in0 = newCtx.dt_in0;
+    ctx.dt_in1 = newCtx.dt_in1;
+    ctx.beta = newCtx.beta;
+    ctx.is_with_amx = use_amx;
+
+    // don't create brgemm kernels for empty tiles
+    if (ctx.M != 0 && ctx.N != 0 && ctx.K != 0) {
+        init_brgemm(ctx, brgKernel, use_amx);
+    } else {
+        brgKernel.reset();
+    }
+}
+
+void MHA::prepareFlashAttention() {
+    batch0 = dimsMatMul0In0[0];
+    batch1 = dimsMatMul0In0[1];
+    M = dimsMatMul0In0[2];
+    K0 = dimsMatMul0In0[3];
+    N0 = dimsMatMul0In1[3];
+    N1 = dimsMatMul1In1[3];
+
+    M_blk = rowsBlk;
+    M_tail = M % M_blk;
+
+    const auto prc = inputPrecisions[0];
+    const auto dt = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(prc));
+    const bool isBF16 = prc == Precision::BF16;
+    // keys block is padded up to the copy kernel block, so AMX is limited by the head size only
+    const size_t N_blk = 32;
+    flashWithAMX = isBF16 && mayiuse(avx512_core_amx) && K0 % 32 == 0;
+    flashVnniFactor = 4 / prc.size();
+
+    // The keys block is as large as the half of the L2 cache allows: the keys and values panels of the block and the
+    // scores and probabilities of the rows block are reused by both brgemms and the softmax, the other half is left
+    // for the queries and the accumulator. It's a multiple of the copy kernel block and is limited to keep the tail small.
+    const size_t l2CacheSize = dnnl::utils::get_cache_size(2, true);
+    const size_t bytesPerKey = (K0 + N1) * prc.size() + M_blk * (sizeof(float) + prc.size());
+    kvBlk = rnd_dn(l2CacheSize / 2 / bytesPerKey, N_blk);
+    kvBlk = std::min(std::max(kvBlk, N_blk), maxKvBlk);
+
+    // broadcasted dimensions of the mask are addressed with zero strides
+    strMask = strAddIn1;
+    for (size_t i = 0; i < strMask.size(); i++) {
+        if (dimsAddIn1[i] == 1)
+            strMask[i] = 0;
+    }
+
+    numKvBlocks = div_up(N0, kvBlk);
+    kvTail = N0 - (numKvBlocks == 0 ? 0 : (numKvBlocks - 1) * kvBlk);
+    kvTailPad = isBF16 ? rnd_up(kvTail, N_blk) : kvTail;
+
+    for (size_t m = 0; m < 2; m++) {
+        for (size_t kv = 0; kv < 2; kv++) {
+            const auto M_ = m ? M_tail : M < M_blk ? 0 : M_blk;
+            const auto kv_ = kv ? kvTailPad : numKvBlocks > 1 ? kvBlk : 0;
+
+            // S[M_blk x kvBlk] = Q[M_blk x K0] * K^T[K0 x kvBlk]
+            brgemmCtx ctx0;
+            ctx0.M = M_;
+            ctx0.N = kv_;
+            ctx0.K = K0;
+            ctx0.LDA = strTranspose0In0[1];
+            ctx0.LDB = kvBlk;
+            ctx0.LDC = kvBlk;
+            ctx0.dt_in0 = dt;
+            ctx0.dt_in1 = dt;
+            ctx0.beta = 0.0f;
+            updateBrgemm(brgCtxsFlash0[getFlashBrgIdx(m, kv)], ctx0, brgKernelsFlash0[getFlashBrgIdx(m, kv)], flashWithAMX);
+
+            // Acc[M_blk x N1] += P[M_blk x kvBlk] * V[kvBlk x N1]
+            brgemmCtx ctx1;
+            ctx1.M = M_;
+            ctx1.N = N1;
+            ctx1.K = kv_;
+            ctx1.LDA = kvBlk;
+            ctx1.LDB = isBF16 ? rnd_up(N1, N_blk) : strTranspose2In0[1];
+            ctx1.LDC = N1;
+            ctx1.dt_in0 = dt;
+            ctx1.dt_in1 = dt;
+            ctx1.beta = 1.0f;
+            updateBrgemm(brgCtxsFlash1[getFlashBrgIdx(m, kv)], ctx1, brgKernelsFlash1[getFlashBrgIdx(m, kv)], flashWithAMX);
+        }
+    }
+
+    if (isBF16) {
+        // the copy kernels are rebuilt only if any of their parameters changes
+        const std::vector<size_t> copyB0Params = {kvBlk, N_blk, 0, kvBlk, K0, flashWithAMX, static_cast<size_t>(dt)};
+        if (!brgCopyBKernelFlash0 || flashCopyB0Params != copyB0Params) {
+            init_brgemm_copy_b(brgCopyBKernelFlash0, kvBlk, N_blk, 0, kvBlk, K0, flashWithAMX, dt, dt);
+            flashCopyB0Params = copyB0Params;
+        }
+        const std::vector<size_t> copyB1Params = {strTranspose2In0[1], N_blk, N1 % N_blk, rnd_up(N1, N_blk), kvBlk,
+                                                  flashWithAMX, static_cast<size_t>(dt)};
+        if (!brgCopyBKernelFlash1 || flashCopyB1Params != copyB1Params) {
+            init_brgemm_copy_b(brgCopyBKernelFlash1, strTranspose2In0[1], N_blk, N1 % N_blk, rnd_up(N1, N_blk), kvBlk,
+                               flashWithAMX, dt, dt);
+            flashCopyB1Params = copyB1Params;
+        }
+    }
+
+    const std::vector<size_t> softmaxParams = {kvBlk, kvTail, static_cast<size_t>(dt), strMask.back() == 0};
+    if (flashSoftmaxParams != softmaxParams) {
+        for (size_t kv = 0; kv < 2; kv++) {
+            jit_mul_add_softmax_compile_params jcp;
+            jcp.src_prc = Precision::FP32;
+            jcp.dst_prc = prc;
+            jcp.work_amount = kv ? kvTail : kvBlk;
+            jcp.with_mul_scales = !mulScales.empty();
+            jcp.is_mul_first = isMulFirst;
+            jcp.with_scales0 = false;
+            jcp.broadcast_scales0 = false;
+            jcp.with_scales1 = false;
+            jcp.broadcast_scales1 = false;
+            jcp.broadcast_add_in1 = strMask.back() == 0;
+            jcp.is_online = true;
+
+            flashSoftmaxKernels[kv] = createMulAddSoftmaxKernel(jcp);
+            if (!flashSoftmaxKernels[kv]) {
+                THROW_ERROR << "cannot create jit online softmax kernel";
+            }
+            flashSoftmaxKernels[kv]->create_ker();
+        }
+        flashSoftmaxParams = softmaxParams;
+    }
+
+    size_t numThreads = parallel_get_max_threads();
+
+    bufferScoresSize = M_blk * kvBlk;
+    bufferProbsSize = M_blk * kvBlk * prc.size();
+    bufferAccSize = M_blk * N1;
+    bufferKeysPanelSize = rnd_up(K0, flashVnniFactor) * kvBlk * prc.size();
+    bufferValuesPanelSize = isBF16 ? kvBlk * rnd_up(N1, N_blk) * prc.size() : 0;
+    bufferTransposeSize = isBF16 ? K0 * kvBlk * prc.size() : 0;
+
+    bufferScores.resize(numThreads * bufferScoresSize);
+    bufferProbs.resize(numThreads * bufferProbsSize);
+    bufferAcc.resize(numThreads * bufferAccSize);
+    bufferStats.resize(numThreads * 2 * M_blk);
+    bufferKeys.resize(numThreads * numKvBlocks * bufferKeysPanelSize);
+    bufferValues.resize(numThreads * numKvBlocks * bufferValuesPanelSize);
+    bufferTranspose.resize(numThreads * bufferTransposeSize);
+    if (flashWithAMX) {
+        wsp.resize(numThreads * wsp_size_per_thread);
+    }
+
+    const auto& selectedPD = getSelectedPrimitiveDescriptor();
+    selectedPD->setImplementationType(flashWithAMX ? jit_avx512_amx : jit_avx512);
+}
+
 template<typename srcT, typename dstT>
 static void reorder2D(const srcT* pin, dstT* pout, const std::vector<size_t>& dimsOut,
                const std::vector<size_t>& stridesOut, const std::vector<size_t>& stridesIn) {
@@ -1411,7 +1686,176 @@ void MHA::mhaImpl() {
     });
 }
 
+template <typename in_type>
+void MHA::flashAttentionImpl() {
+    const auto pQ = reinterpret_cast<const in_type*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto pK = reinterpret_cast<const in_type*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    const auto pMask = reinterpret_cast<const float*>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
+    const auto pV = reinterpret_cast<const in_type*>(getParentEdgeAt(3)->getMemoryPtr()->GetPtr());
+    auto pOut = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    constexpr bool isBF16 = std::is_same<in_type, bfloat16_t>::value;
+    const bool isOutBF16 = getOriginalOutputPrecisionAtPort(0) == Precision::BF16;
+    const auto outPrcSize = getOriginalOutputPrecisionAtPort(0).size();
+    const float minusInf = -std::numeric_limits<float>::infinity();
+    const size_t N_blk = 32;
+
+    parallel_for2d(batch0, batch1, [&](size_t i0, size_t i1) {
+        size_t threadNum = parallel_get_thread_num();
+
+        auto pQ_aux = pQ + i0 * strTranspose0In0[0] + i1 * strTranspose0In0[2]; // order 0213
+        auto pK_aux = pK + i0 * strTranspose1In0[0] + i1 * strTranspose1In0[2]; // order 0231
+        auto pV_aux = pV + i0 * strTranspose2In0[0] + i1 * strTranspose2In0[2]; // order 0213
+        auto pMask_aux = pMask + i0 * strMask[0] + i1 * strMask[1];
+        const float scale = mulScales.empty() ? 1.f : mulScales.size() > 1 ? mulScales[i1] : mulScales[0];
+
+        auto keys = bufferKeys.data() + threadNum * numKvBlocks * bufferKeysPanelSize;
+        auto values = bufferValues.data() + threadNum * numKvBlocks * bufferValuesPanelSize;
+        auto scores = bufferScores.data() + threadNum * bufferScoresSize;
+        auto probs = reinterpret_cast<in_type*>(bufferProbs.data() + threadNum * bufferProbsSize);
+        auto acc = bufferAcc.data() + threadNum * bufferAccSize;
+        auto rowMax = bufferStats.data() + threadNum * 2 * M_blk;
+        auto rowSum = rowMax + M_blk;
+        auto wsp_local = !wsp.empty() ? wsp.data() + threadNum * wsp_size_per_thread : nullptr;
+
+        // keys (and values for bf16) are repacked once per head and reused by all the rows blocks
+        for (size_t kb = 0; kb < numKvBlocks; kb++) {
+            const size_t kvStart = kb * kvBlk;
+            const size_t kvCur = std::min(kvBlk, N0 - kvStart);
+            const size_t kvCurPad = kb == numKvBlocks - 1 ? kvTailPad : kvBlk;
+            auto keysPanel = keys + kb * bufferKeysPanelSize;
+
+            if (!isBF16) {
+                reorder2D(pK_aux + kvStart * strTranspose1In0[1], reinterpret_cast<in_type*>(keysPanel), {K0, kvCur}, {kvBlk, 1},
+                          {strTranspose1In0[3], strTranspose1In0[1]});
+                continue;
+            }
+
+            auto transposed = reinterpret_cast<in_type*>(bufferTranspose.data() + threadNum * bufferTransposeSize);
+            if (kvCur != kvBlk)
+                std::fill(transposed, transposed + K0 * kvBlk, static_cast<in_type>(0));
+            reorder2D(pK_aux + kvStart * strTranspose1In0[1], transposed, {K0, kvCur}, {kvBlk, 1},
+                      {strTranspose1In0[3], strTranspose1In0[1]});
+            for (size_t nb = 0; nb < kvCurPad / N_blk; nb++) {
+                auto ctx = jit_brgemm_matmul_copy_b_t::ctx_t();
+                ctx.current_N_blk = N_blk;
+                ctx.src = transposed + nb * N_blk;
+                ctx.tr_src = keysPanel + nb * N_blk * flashVnniFactor * sizeof(in_type);
+                ctx.compensation_ptr = nullptr;
+                ctx.zp_a_compensation_ptr = nullptr;
+                ctx.zp_a_neg_value_ptr = nullptr;
+                ctx.current_K_start = 0;
+                ctx.current_K_iters = K0;
+
+                (*brgCopyBKernelFlash0)(&ctx);
+            }
+
+            auto valuesPanel = values + kb * bufferValuesPanelSize;
+            if (kvCur != kvBlk)
+                std::fill(valuesPanel, valuesPanel + bufferValuesPanelSize, 0);
+            for (size_t nb = 0; nb < div_up(N1, N_blk); nb++) {
+                auto ctx = jit_brgemm_matmul_copy_b_t::ctx_t();
+                const bool is_N_tail = (N1 - nb * N_blk < N_blk);
+                ctx.current_N_blk = is_N_tail ? N1 % N_blk : N_blk;
+                ctx.src = pV_aux + kvStart * strTranspose2In0[1] + nb * N_blk;
+                ctx.tr_src = valuesPanel + nb * N_blk * flashVnniFactor * sizeof(in_type);
+                ctx.compensation_ptr = nullptr;
+                ctx.zp_a_compensation_ptr = nullptr;
+                ctx.zp_a_neg_value_ptr = nullptr;
+                ctx.current_K_start = 0;
+                ctx.current_K_iters = kvCur;
+
+                (*brgCopyBKernelFlash1)(&ctx);
+            }
+        }
+
+        for (size_t mb = 0; mb < div_up(M, M_blk); mb++) {
+            const bool is_M_tail = (M - mb * M_blk < M_blk);
+            const size_t cur_M_blk = is_M_tail ? M_tail : M_blk;
+            const size_t mIdx = is_M_tail ? 1 : 0;
+
+            std::fill(rowMax, rowMax + cur_M_blk, minusInf);
+            std::fill(rowSum, rowSum + cur_M_blk, 0.f);
+            std::fill(acc, acc + cur_M_blk * N1, 0.f);
+
+            auto pMatMul0In0 = pQ_aux + mb * M_blk * strTranspose0In0[1];
+            for (size_t kb = 0; kb < numKvBlocks; kb++) {
+                const size_t kvIdx = kb == numKvBlocks - 1 ? 1 : 0;
+                const size_t kvStart = kb * kvBlk;
+                const size_t kvCur = std::min(kvBlk, N0 - kvStart);
+                const size_t kvCurPad = kvIdx ? kvTailPad : kvBlk;
+
+                callBrgemm(brgCtxsFlash0[getFlashBrgIdx(mIdx, kvIdx)], brgKernelsFlash0[getFlashBrgIdx(mIdx, kvIdx)],
+                           pMatMul0In0, keys + kb * bufferKeysPanelSize, scores, wsp_local);
+
+                // online softmax: running max and sum are updated per keys block and the accumulator is rescaled accordingly
+                for (size_t m = 0; m < cur_M_blk; m++) {
+                    auto s = scores + m * kvBlk;
+                    auto p = probs + m * kvBlk;
+                    float newMax = rowMax[m];
+                    float blkSum = 0.f;
+
+                    jit_mul_add_softmax_call_args call_args;
+                    call_args.p_in0 = s;
+                    call_args.p_mul_in1 = &scale;
+                    call_args.p_add_in1 = pMask_aux + (mb * M_blk + m) * strMask[2] + kvStart * strMask[3];
+                    call_args.p_out = p;
+                    call_args.p_buffer = s;
+                    call_args.p_max = &newMax;
+                    call_args.p_sum = &blkSum;
+                    (*flashSoftmaxKernels[kvIdx])(&call_args);
+
+                    if (newMax == minusInf) {
+                        // the row is fully masked so far
+                        std::fill(p, p + kvCurPad, static_cast<in_type>(0));
+                        continue;
+                    }
+                    std::fill(p + kvCur, p + kvCurPad, static_cast<in_type>(0));
+
+                    const float alpha = rowMax[m] == minusInf ? 0.f : std::exp(rowMax[m] - newMax);
+                    if (alpha != 1.f) {
+                        auto accRow = acc + m * N1;
+                        for (size_t n = 0; n < N1; n++)
+                            accRow[n] *= alpha;
+                    }
+                    rowSum[m] = rowSum[m] * alpha + blkSum;
+                    rowMax[m] = newMax;
+                }
+
+                const void* pMatMul1In1 = isBF16 ? static_cast<const void*>(values + kb * bufferValuesPanelSize)
+                                                 : static_cast<const void*>(pV_aux + kvStart * strTranspose2In0[1]);
+                callBrgemm(brgCtxsFlash1[getFlashBrgIdx(mIdx, kvIdx)], brgKernelsFlash1[getFlashBrgIdx(mIdx, kvIdx)],
+                           probs, pMatMul1In1, acc, wsp_local);
+            }
+
+            for (size_t m = 0; m < cur_M_blk; m++) {
+                const float norm = rowSum[m] != 0.f ? 1.f / rowSum[m] : 0.f;
+                auto accRow = acc + m * N1;
+                auto pOut_aux = pOut + (i0 * strOut[0] + (mb * M_blk + m) * strOut[1] + i1 * strOut[2]) * outPrcSize;
+                if (isOutBF16) {
+                    auto outRow = reinterpret_cast<bfloat16_t*>(pOut_aux);
+                    for (size_t n = 0; n < N1; n++)
+                        outRow[n] = static_cast<bfloat16_t>(accRow[n] * norm);
+                } else {
+                    auto outRow = reinterpret_cast<float*>(pOut_aux);
+                    for (size_t n = 0; n < N1; n++)
+                        outRow[n] = accRow[n] * norm;
+                }
+            }
+        }
+    });
+}
+
 void MHA::execute(dnnl::stream strm) {
+    if (useFlashAttention) {
+        if (inputPrecisions[0] == Precision::BF16) {
+            flashAttentionImpl<bfloat16_t>();
+        } else {
+            flashAttentionImpl<float>();
+        }
+        return;
+    }
+
     if (inputPrecisions[1] == Precision::FP32) {
         mhaImpl<float>();
     } else if (inputPrecisions[1] == Precision::BF16) {
@@ -28,6 +28,11 @@ struct jit_mul_add_softmax_compile_params {
     bool broadcast_scales0;
     bool with_scales1;
     bool broadcast_scales1;
+    // the add input is a single value broadcasted over the row
+    bool broadcast_add_in1;
+    // one block of the online softmax: the exponents aren't normalized, the running max is updated in p_max
+    // and the sum of the exponents is stored to p_sum
+    bool is_online;
 };
 
 struct jit_mul_add_softmax_call_args {
@@ -38,6 +43,8 @@ struct jit_mul_add_softmax_call_args {
     void *p_buffer;
     const void *p_scales0;
     const void *p_scales1;
+    float *p_max;
+    float *p_sum;
 };
 
 struct jit_uni_mul_add_softmax_kernel {
@@ -154,6 +161,14 @@ private:
     template <typename in1_type>
     void mhaImpl();
 
+    // Tiled implementation with online softmax: scores are computed for a single block of keys at a time,
+    // so the mask may have any broadcastable shape (e.g. causal) and the sequence length is not limited by buffers size
+    template <typename in_type>
+    void flashAttentionImpl();
+    bool isFlashAttentionApplicable() const;
+    void prepareFlashAttention();
+    void updateBrgemm(brgemmCtx& ctx, const brgemmCtx& newCtx, std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& brgKernel, bool use_amx);
+
     void init_brgemm(brgemmCtx& ctx, std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t>& brgKernel, bool use_amx);
     void init_brgemm_copy_a(std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_a_t>& brgCopyKernel,
         size_t K, size_t K_blk, size_t K_tail, size_t LDA, dnnl_data_type_t dt_in0);
@@ -167,6 +182,10 @@ private:
         return mIdx * 4 + kIdx * 2 + nIdx;
     }
 
+    size_t getFlashBrgIdx(size_t mIdx, size_t kvIdx) {
+        return mIdx * 2 + kvIdx;
+    }
+
     std::vector<InferenceEngine::Precision> inputPrecisions;
     InferenceEngine::Precision accPrecision0;
     InferenceEngine::Precision accPrecision1;
@@ -237,6 +256,41 @@ private:
     std::unique_ptr<jit_uni_mul_add_softmax_kernel> mulAddSoftmaxKernel;
     std::unique_ptr<jit_uni_convert_reorder_kernel> convertReorderKernel;
     std::unique_ptr<jit_uni_convert_transpose_kernel> convertTransposeKernel;
+
+    bool useFlashAttention = false;
+    // the keys block is chosen by the L2 cache size
+    size_t kvBlk = 0;
+    size_t numKvBlocks = 0, kvTail = 0, kvTailPad = 0;
+    size_t flashVnniFactor = 1;
+    // parameters of the current copy kernels of the keys and the values
+    std::vector<size_t> flashCopyB0Params, flashCopyB1Params;
+    bool flashWithAMX = false;
+    VectorDims strMask;
+
+    size_t bufferScoresSize = 0;
+    size_t bufferProbsSize = 0;
+    size_t bufferAccSize = 0;
+    size_t bufferKeysPanelSize = 0;
+    size_t bufferValuesPanelSize = 0;
+    size_t bufferTransposeSize = 0;
+
+    std::vector<float> bufferScores;
+    std::vector<uint8_t> bufferProbs;
+    std::vector<float> bufferAcc;
+    std::vector<float> bufferStats;
+    std::vector<uint8_t> bufferKeys;
+    std::vector<uint8_t> bufferValues;
+    std::vector<uint8_t> bufferTranspose;
+
+    brgemmCtx brgCtxsFlash0[4];
+    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgKernelsFlash0[4];
+    brgemmCtx brgCtxsFlash1[4];
+    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> brgKernelsFlash1[4];
+    std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t> brgCopyBKernelFlash0;
+    std::unique_ptr<dnnl::impl::cpu::x64::matmul::jit_brgemm_matmul_copy_b_t> brgCopyBKernelFlash1;
+    // online softmax of the full and the tail keys blocks
+    std::unique_ptr<jit_uni_mul_add_softmax_kernel> flashSoftmaxKernels[2];
+    std::vector<size_t> flashSoftmaxParams;
 };
 
 }   // namespace node
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "ie_parallel.hpp"
+#include "common/nms_blocked.h"
 #include "utils/general_utils.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
@@ -532,58 +533,61 @@ void MultiClassNms::nmsWithoutEta(const float* boxes,
                                 const SizeVector& scoresStrides,
                                 const SizeVector& roisnumStrides,
                                 const bool shared) {
-    parallel_for2d(m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
-        /*
-        // nms over a class over an image
-        // boxes:       num_priors, 4
-        // scores:      num_priors, 1
-        */
-        if (!shared) {
-            if (roisnum[batch_idx] <= 0) {
-                m_numFiltBox[batch_idx][class_idx] = 0;
-                return;
-            }
-        }
-        if (class_idx != m_backgroundClass) {
-            const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
-            const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
-
-            std::vector<std::pair<float, int>> sorted_boxes;
-            int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
-            for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
-                if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
-                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+    const float norm = static_cast<float>(m_normalized == false);
+    const Extensions::Cpu::nms_iou_conf iouConf = {norm, false};
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        std::vector<std::pair<float, int>> sorted_boxes;
+        NmsBoxes candidates;
+        NmsBlockedSelector selector;
+        std::vector<size_t> selected;
+
+        for_2d(ithr, nthr, m_numBatches, m_numClasses, [&](int batch_idx, int class_idx) {
+            /*
+            // nms over a class over an image
+            // boxes:       num_priors, 4
+            // scores:      num_priors, 1
+            */
+            if (!shared) {
+                if (roisnum[batch_idx] <= 0) {
+                    m_numFiltBox[batch_idx][class_idx] = 0;
+                    return;
+                }
             }
+            if (class_idx != m_backgroundClass) {
+                const float* boxesPtr = slice_class(batch_idx, class_idx, boxes, boxesStrides, true, roisnum, roisnumStrides, shared);
+                const float* scoresPtr = slice_class(batch_idx, class_idx, scores, scoresStrides, false, roisnum, roisnumStrides, shared);
+
+                sorted_boxes.clear();
+                int cur_numBoxes = shared ? m_numBoxes : roisnum[batch_idx];
+                for (int box_idx = 0; box_idx < cur_numBoxes; box_idx++) {
+                    if (scoresPtr[box_idx] >= m_scoreThreshold)  // align with ref
+                        sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+                }
 
-            int io_selection_size = 0;
-            if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                    return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                });
-                int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
-                m_filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-                io_selection_size++;
-                int max_out_box = (m_nmsRealTopk > sorted_boxes.size()) ? sorted_boxes.size() : m_nmsRealTopk;
-                for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4],
-                            &boxesPtr[m_filtBoxes[offset + idx].box_index * 4], m_normalized);
-                        if (iou >= m_iouThreshold) {
-                            box_is_selected = false;
-                            break;
-                        }
+                int io_selection_size = 0;
+                if (sorted_boxes.size() > 0) {
+                    parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                        return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                    });
+                    // nms top k is applied to the candidates
+                    size_t max_out_box = (std::min)(sorted_boxes.size(), static_cast<size_t>(m_nmsRealTopk));
+
+                    candidates.resize(max_out_box);
+                    for (size_t i = 0; i < max_out_box; i++) {
+                        const float* box = &boxesPtr[sorted_boxes[i].second * 4];
+                        candidates.set(i, box[0], box[1], box[2], box[3], (box[2] - box[0] + norm) * (box[3] - box[1] + norm));
                     }
 
-                    if (box_is_selected) {
-                        m_filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx,
-                            sorted_boxes[box_idx].second);
-                        io_selection_size++;
-                    }
+                    selector.select(candidates, max_out_box, max_out_box, m_iouThreshold, iouConf, selected);
+
+                    int offset = batch_idx * m_numClasses * m_nmsRealTopk + class_idx * m_nmsRealTopk;
+                    for (const auto idx : selected)
+                        m_filtBoxes[offset + io_selection_size++] = filteredBoxes(sorted_boxes[idx].first, batch_idx, class_idx,
+                            sorted_boxes[idx].second);
                 }
+                m_numFiltBox[batch_idx][class_idx] = io_selection_size;
             }
-            m_numFiltBox[batch_idx][class_idx] = io_selection_size;
-        }
+        });
     });
 }
 
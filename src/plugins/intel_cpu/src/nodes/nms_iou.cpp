@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_iou.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+inline float iou_scalar(const nms_box& ref, const nms_boxes& boxes, size_t j, const nms_iou_conf& conf) {
+    const float w0 = (std::min)(ref.c2, boxes.c2[j]) - (std::max)(ref.c0, boxes.c0[j]);
+    const float w1 = (std::min)(ref.c3, boxes.c3[j]) - (std::max)(ref.c1, boxes.c1[j]);
+    if (conf.disjoint_zero) {
+        if (boxes.c0[j] > ref.c2 || boxes.c2[j] < ref.c0 || boxes.c1[j] > ref.c3 || boxes.c3[j] < ref.c1)
+            return 0.f;
+        const float intersection = (w0 + conf.norm) * (w1 + conf.norm);
+        return intersection / (ref.area + boxes.area[j] - intersection);
+    }
+    if (boxes.area[j] <= 0.f)
+        return 0.f;
+    const float intersection = (std::max)(w0 + conf.norm, 0.f) * (std::max)(w1 + conf.norm, 0.f);
+    return intersection / (ref.area + boxes.area[j] - intersection);
+}
+
+}  // namespace
+
+void nms_iou(const nms_box& ref, const nms_boxes& boxes, size_t begin, size_t end, const nms_iou_conf& conf, float* dst) {
+    size_t j = begin;
+    if (!conf.disjoint_zero && ref.area <= 0.f) {
+        std::fill(dst, dst + (end - begin), 0.f);
+        return;
+    }
+#if defined(HAVE_AVX512F)
+    const __m512 r0 = _mm512_set1_ps(ref.c0);
+    const __m512 r1 = _mm512_set1_ps(ref.c1);
+    const __m512 r2 = _mm512_set1_ps(ref.c2);
+    const __m512 r3 = _mm512_set1_ps(ref.c3);
+    const __m512 rarea = _mm512_set1_ps(ref.area);
+    const __m512 norm = _mm512_set1_ps(conf.norm);
+    const __m512 zero = _mm512_setzero_ps();
+    for (; j + 16 <= end; j += 16) {
+        const __m512 b0 = _mm512_loadu_ps(boxes.c0 + j);
+        const __m512 b1 = _mm512_loadu_ps(boxes.c1 + j);
+        const __m512 b2 = _mm512_loadu_ps(boxes.c2 + j);
+        const __m512 b3 = _mm512_loadu_ps(boxes.c3 + j);
+        const __m512 barea = _mm512_loadu_ps(boxes.area + j);
+        __m512 w0 = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(r2, b2), _mm512_max_ps(r0, b0)), norm);
+        __m512 w1 = _mm512_add_ps(_mm512_sub_ps(_mm512_min_ps(r3, b3), _mm512_max_ps(r1, b1)), norm);
+        __mmask16 is_zero;
+        if (conf.disjoint_zero) {
+            is_zero = _mm512_cmp_ps_mask(b0, r2, _CMP_GT_OQ) | _mm512_cmp_ps_mask(b2, r0, _CMP_LT_OQ) |
+                      _mm512_cmp_ps_mask(b1, r3, _CMP_GT_OQ) | _mm512_cmp_ps_mask(b3, r1, _CMP_LT_OQ);
+        } else {
+            w0 = _mm512_max_ps(w0, zero);
+            w1 = _mm512_max_ps(w1, zero);
+            is_zero = _mm512_cmp_ps_mask(barea, zero, _CMP_LE_OQ);
+        }
+        const __m512 intersection = _mm512_mul_ps(w0, w1);
+        const __m512 iou = _mm512_div_ps(intersection, _mm512_sub_ps(_mm512_add_ps(rarea, barea), intersection));
+        _mm512_storeu_ps(dst + j - begin, _mm512_mask_mov_ps(iou, is_zero, zero));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 r0 = _mm256_set1_ps(ref.c0);
+    const __m256 r1 = _mm256_set1_ps(ref.c1);
+    const __m256 r2 = _mm256_set1_ps(ref.c2);
+    const __m256 r3 = _mm256_set1_ps(ref.c3);
+    const __m256 rarea = _mm256_set1_ps(ref.area);
+    const __m256 norm = _mm256_set1_ps(conf.norm);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; j + 8 <= end; j += 8) {
+        const __m256 b0 = _mm256_loadu_ps(boxes.c0 + j);
+        const __m256 b1 = _mm256_loadu_ps(boxes.c1 + j);
+        const __m256 b2 = _mm256_loadu_ps(boxes.c2 + j);
+        const __m256 b3 = _mm256_loadu_ps(boxes.c3 + j);
+        const __m256 barea = _mm256_loadu_ps(boxes.area + j);
+        __m256 w0 = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(r2, b2), _mm256_max_ps(r0, b0)), norm);
+        __m256 w1 = _mm256_add_ps(_mm256_sub_ps(_mm256_min_ps(r3, b3), _mm256_max_ps(r1, b1)), norm);
+        __m256 is_zero;
+        if (conf.disjoint_zero) {
+            is_zero = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(b0, r2, _CMP_GT_OQ), _mm256_cmp_ps(b2, r0, _CMP_LT_OQ)),
+                                   _mm256_or_ps(_mm256_cmp_ps(b1, r3, _CMP_GT_OQ), _mm256_cmp_ps(b3, r1, _CMP_LT_OQ)));
+        } else {
+            w0 = _mm256_max_ps(w0, zero);
+            w1 = _mm256_max_ps(w1, zero);
+            is_zero = _mm256_cmp_ps(barea, zero, _CMP_LE_OQ);
+        }
+        const __m256 intersection = _mm256_mul_ps(w0, w1);
+        const __m256 iou = _mm256_div_ps(intersection, _mm256_sub_ps(_mm256_add_ps(rarea, barea), intersection));
+        _mm256_storeu_ps(dst + j - begin, _mm256_blendv_ps(iou, zero, is_zero));
+    }
+#endif
+    for (; j < end; j++)
+        dst[j - begin] = iou_scalar(ref, boxes, j, conf);
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Boxes in SoA layout: (c0, c1) is the min corner and (c2, c3) is the max corner of the box,
+// the area is precomputed the way the operation defines it
+struct nms_boxes {
+    const float* c0;
+    const float* c1;
+    const float* c2;
+    const float* c3;
+    const float* area;
+};
+
+struct nms_box {
+    float c0;
+    float c1;
+    float c2;
+    float c3;
+    float area;
+};
+
+struct nms_iou_conf {
+    float norm;         // 1 for not normalized coordinates, which are the pixel indices
+    bool disjoint_zero; // MatrixNms: IoU is zero only for disjoint boxes, the area isn't checked
+};
+
+namespace XARCH {
+
+/**
+ * Computes IoU of the box 'ref' with each of the boxes [begin, end) to dst[0, end - begin).
+ */
+void nms_iou(const nms_box& ref, const nms_boxes& boxes, size_t begin, size_t end, const nms_iou_conf& conf, float* dst);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -11,6 +11,7 @@
 
 #include "non_max_suppression.h"
 #include "ie_parallel.hpp"
+#include "common/nms_blocked.h"
 #include <ngraph/opsets/opset5.hpp>
 #include <ov_ops/nms_ie_internal.hpp>
 #include "utils/general_utils.h"
@@ -994,88 +995,59 @@ void NonMaxSuppression::nmsWithSoftSigma(const float *boxes, const float *scores
 
 void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
                                                                 const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
-    int max_out_box = static_cast<int>(maxOutputBoxesPerClass);
-    parallel_for2d(numBatches, numClasses, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
-        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
-
+    const Extensions::Cpu::nms_iou_conf iouConf = {0.f, false};
+    parallel_nt(0, [&](const int ithr, const int nthr) {
         std::vector<std::pair<float, int>> sorted_boxes;  // score, box_idx
-        for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
-            if (scoresPtr[box_idx] > scoreThreshold)
-                sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
-        }
-
-        int io_selection_size = 0;
-        size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
-            int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            if (sortedBoxSize > 1) {
-                if (nms_kernel) {
-                    std::vector<float> boxCoord0(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord1(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord2(sortedBoxSize, 0.0f);
-                    std::vector<float> boxCoord3(sortedBoxSize, 0.0f);
-
-                    boxCoord0[0] = boxesPtr[sorted_boxes[0].second * 4];
-                    boxCoord1[0] = boxesPtr[sorted_boxes[0].second * 4 + 1];
-                    boxCoord2[0] = boxesPtr[sorted_boxes[0].second * 4 + 2];
-                    boxCoord3[0] = boxesPtr[sorted_boxes[0].second * 4 + 3];
-
-                    auto arg = jit_nms_args();
-                    arg.iou_threshold = static_cast<float*>(&iouThreshold);
-                    arg.score_threshold = static_cast<float*>(&scoreThreshold);
-                    arg.scale = static_cast<float*>(&scale);
-                    // box start index do not change for hard supresion
-                    arg.selected_boxes_coord[0] = static_cast<float*>(&boxCoord0[0]);
-                    arg.selected_boxes_coord[1] = static_cast<float*>(&boxCoord1[0]);
-                    arg.selected_boxes_coord[2] = static_cast<float*>(&boxCoord2[0]);
-                    arg.selected_boxes_coord[3] = static_cast<float*>(&boxCoord3[0]);
-
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        arg.selected_boxes_num = io_selection_size;
-                        arg.candidate_box = static_cast<const float*>(&boxesPtr[sorted_boxes[candidate_idx].second * 4]);
-                        arg.candidate_status = static_cast<int*>(&candidateStatus);
-                        (*nms_kernel)(&arg);
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            boxCoord0[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4];
-                            boxCoord1[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 1];
-                            boxCoord2[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 2];
-                            boxCoord3[io_selection_size] = boxesPtr[sorted_boxes[candidate_idx].second * 4 + 3];
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
-                    }
-                } else {
-                    for (size_t candidate_idx = 1; (candidate_idx < sortedBoxSize) && (io_selection_size < max_out_box); candidate_idx++) {
-                        int candidateStatus = NMSCandidateStatus::SELECTED; // 0 for suppressed, 1 for selected
-                        for (int selected_idx = io_selection_size - 1; selected_idx >= 0; selected_idx--) {
-                            float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[candidate_idx].second * 4],
-                                &boxesPtr[filtBoxes[offset + selected_idx].box_index * 4]);
-                            if (iou >= iouThreshold) {
-                                candidateStatus = NMSCandidateStatus::SUPPRESSED;
-                                break;
-                            }
-                        }
+        NmsBoxes candidates;
+        NmsBlockedSelector selector;
+        std::vector<size_t> selected;
+
+        for_2d(ithr, nthr, numBatches, numClasses, [&](int batch_idx, int class_idx) {
+            const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+
+            sorted_boxes.clear();
+            for (int box_idx = 0; box_idx < numBoxes; box_idx++) {
+                if (scoresPtr[box_idx] > scoreThreshold)
+                    sorted_boxes.emplace_back(std::make_pair(scoresPtr[box_idx], box_idx));
+            }
 
-                        if (candidateStatus == NMSCandidateStatus::SELECTED) {
-                            filtBoxes[offset + io_selection_size] =
-                                filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
-                            io_selection_size++;
-                        }
+            size_t io_selection_size = 0;
+            if (!sorted_boxes.empty()) {
+                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
+                              [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                                  return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                              });
+
+                candidates.resize(sorted_boxes.size());
+                for (size_t i = 0; i < sorted_boxes.size(); i++) {
+                    const float *box = &boxesPtr[sorted_boxes[i].second * 4];
+                    float ymin, xmin, ymax, xmax;
+                    if (boxEncodingType == NMSBoxEncodeType::CENTER) {
+                        //  box format: x_center, y_center, width, height
+                        ymin = box[1] - box[3] / 2.f;
+                        xmin = box[0] - box[2] / 2.f;
+                        ymax = box[1] + box[3] / 2.f;
+                        xmax = box[0] + box[2] / 2.f;
+                    } else {
+                        //  box format: y1, x1, y2, x2
+                        ymin = (std::min)(box[0], box[2]);
+                        xmin = (std::min)(box[1], box[3]);
+                        ymax = (std::max)(box[0], box[2]);
+                        xmax = (std::max)(box[1], box[3]);
                     }
+                    candidates.set(i, ymin, xmin, ymax, xmax, (ymax - ymin) * (xmax - xmin));
                 }
+
+                selector.select(candidates, sorted_boxes.size(), maxOutputBoxesPerClass, iouThreshold, iouConf, selected);
+
+                const size_t offset = batch_idx * numClasses * maxOutputBoxesPerClass + class_idx * maxOutputBoxesPerClass;
+                for (const auto idx : selected)
+                    filtBoxes[offset + io_selection_size++] = filteredBoxes(sorted_boxes[idx].first, batch_idx, class_idx, sorted_boxes[idx].second);
             }
-        }
 
-        numFiltBox[batch_idx][class_idx] = io_selection_size;
+            numFiltBox[batch_idx][class_idx] = io_selection_size;
+        });
     });
 }
 
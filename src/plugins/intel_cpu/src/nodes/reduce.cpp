@@ -1677,6 +1677,40 @@ private:
 
 #endif // OPENVINO_ARCH_X86_64
 
+namespace {
+// Output positions of the merged sibling reductions processed by a thread, and the minimal number of the input
+// elements in a part of the reduced dimension
+constexpr size_t multiPositionsChunk = 16;
+constexpr size_t multiPartMinSize = 4096;
+
+// The outputs of the merged sibling reductions have the shape of the first one
+class MultiOutputReduceShapeInfer : public IShapeInfer {
+public:
+    MultiOutputReduceShapeInfer(ShapeInferPtr shapeInfer, size_t outputsNum) : m_shapeInfer(shapeInfer), m_outputsNum(outputsNum) {}
+
+    Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+                 const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        auto result = m_shapeInfer->infer(input_shapes, data_dependency);
+        if (ShapeInferStatus::success == result.status)
+            result.dims.resize(m_outputsNum, result.dims.front());
+        return result;
+    }
+    const ov::CoordinateDiff& get_pads_begin() override {
+        return m_shapeInfer->get_pads_begin();
+    }
+    const ov::CoordinateDiff& get_pads_end() override {
+        return m_shapeInfer->get_pads_end();
+    }
+    port_mask_t get_port_mask() const override {
+        return m_shapeInfer->get_port_mask();
+    }
+
+private:
+    ShapeInferPtr m_shapeInfer;
+    size_t m_outputsNum;
+};
+}   // namespace
+
 const std::map<const ngraph::DiscreteTypeInfo, std::function<void(const std::shared_ptr<ngraph::Node>&, Reduce&)>> Reduce::initializers = {
     {ngraph::opset4::ReduceL1::get_type_info_static(), [](const std::shared_ptr<ngraph::Node>& op, Reduce& node) {
         node.algorithm = Algorithm::ReduceL1;
@@ -1797,6 +1831,27 @@ void Reduce::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    auto& creatorsMap = BlockedDescCreator::getCommonCreators();
+
+    if (!multiOutputs.empty()) {
+        input_prec = output_prec = Precision::FP32;
+        jit_mode = false;
+        layout = ReduceLayoutType::reduce_ncsp;
+
+        NodeConfig config;
+        config.inConfs.resize(2);
+        config.outConfs.resize(multiOutputs.size());
+        config.inConfs[REDUCE_DATA].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(Precision::FP32,
+                                                                                                  getInputShapeAtPort(REDUCE_DATA)));
+        config.inConfs[REDUCE_INDEXES].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(Precision::I32,
+                                                                                                     getInputShapeAtPort(REDUCE_INDEXES)));
+        for (size_t i = 0; i < config.outConfs.size(); i++)
+            config.outConfs[i].setMemDesc(creatorsMap.at(LayoutType::ncsp)->createSharedDesc(Precision::FP32, getOutputShapeAtPort(i)));
+        // the multi-output kernel is cross-compiled C++ code, not JIT
+        supportedPrimitiveDescriptors.push_back({config, impl_desc_type::ref_any});
+        return;
+    }
+
     input_prec = getOriginalInputPrecisionAtPort(REDUCE_DATA);
     output_prec = getOriginalOutputPrecisionAtPort(0);
 
@@ -1836,8 +1891,6 @@ void Reduce::initSupportedPrimitiveDescriptors() {
     config.inConfs[REDUCE_INDEXES].inPlace(-1);
     config.outConfs[0].inPlace(-1);
 
-    auto& creatorsMap = BlockedDescCreator::getCommonCreators();
-
     auto pushDesc = [&](LayoutType inFormat, LayoutType outFormat, InferenceEngine::Precision inPrecision,
             InferenceEngine::Precision outPrecision, impl_desc_type impl_type, bool useAclExecutor = false) {
         config.inConfs[REDUCE_DATA].setMemDesc(creatorsMap.at(inFormat)->createSharedDesc(inPrecision, getInputShapeAtPort(REDUCE_DATA)));
@@ -1935,6 +1988,11 @@ void Reduce::prepareParams() {
         return;
     }
 
+    if (!multiOutputs.empty()) {
+        prepareMultiOutputParams();
+        return;
+    }
+
     src_dims = getParentEdgesAtPort(REDUCE_DATA)[0]->getMemory().getDesc().getShape().getDims();
     std::vector<int> reduce_axes;
     if (jit_mode && jit_beyond_5D) {
@@ -2000,6 +2058,15 @@ void Reduce::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << errorPrefix << " has nullable preferable primitive descriptor";
 
+    if (!multiOutputs.empty()) {
+        if (inputShapesDefined()) {
+            if (needPrepareParams())
+                prepareParams();
+            updateLastInputDims();
+        }
+        return;
+    }
+
     if (srcMemPtr->getDesc().hasLayoutType(LayoutType::ncsp)) {
         layout = ReduceLayoutType::reduce_ncsp;
     } else if (srcMemPtr->getDesc().hasLayoutType(LayoutType::nspc)) {
@@ -2076,6 +2143,11 @@ void Reduce::executeDynamicImpl(dnnl::stream strm) {
 }
 
 void Reduce::execute(dnnl::stream strm) {
+    if (!multiOutputs.empty()) {
+        executeMultiOutput();
+        return;
+    }
+
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(REDUCE_DATA)->getMemoryPtr();
 
@@ -3096,6 +3168,9 @@ int Reduce::getFusingAxis() const {
 }
 
 bool Reduce::canFuse(const NodePtr& node) const {
+    if (!multiOutputs.empty())
+        return false;
+
     Precision input_prec = getOriginalInputPrecisionAtPort(REDUCE_DATA);
     Precision output_prec = getOriginalOutputPrecisionAtPort(0);
     if (!canApplyJIT(input_prec, output_prec) || jit_beyond_5D || algorithm == Algorithm::ReduceAnd || algorithm == Algorithm::ReduceOr) {
@@ -3115,6 +3190,136 @@ bool Reduce::canFuse(const NodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+std::vector<int> Reduce::getNormalizedAxes() const {
+    const int rank = static_cast<int>(getInputShapeAtPort(REDUCE_DATA).getRank());
+    std::set<int> axes;
+    for (auto axis : raw_axes)
+        axes.insert(axis < 0 ? axis + rank : axis);
+    return {axes.begin(), axes.end()};
+}
+
+bool Reduce::canComputeMultiOutput() const {
+    static const Algorithm supportedAlgorithms[] = {
+            Algorithm::ReduceSum,
+            Algorithm::ReduceMean,
+            Algorithm::ReduceSumSquare,
+            Algorithm::ReduceL2,
+            Algorithm::ReduceMax,
+            Algorithm::ReduceMin
+    };
+
+    if (!fusedWith.empty() || getOriginalInputPrecisionAtPort(REDUCE_DATA) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32 ||
+        std::find(std::begin(supportedAlgorithms), std::end(supportedAlgorithms), algorithm) == std::end(supportedAlgorithms)) {
+        return false;
+    }
+
+    // the input is viewed as [outer, reduced, inner] in planar layout
+    const auto axes = getNormalizedAxes();
+    return !axes.empty() && axes.back() - axes.front() + 1 == static_cast<int>(axes.size());
+}
+
+bool Reduce::canMergeSibling(const Reduce& sibling, bool squaredInput) const {
+    if (!canComputeMultiOutput() || !sibling.canComputeMultiOutput())
+        return false;
+    if (squaredInput && sibling.getAlgorithm() != Algorithm::ReduceSum && sibling.getAlgorithm() != Algorithm::ReduceMean)
+        return false;
+
+    return keep_dims == sibling.keep_dims &&
+           getInputShapeAtPort(REDUCE_DATA).getRank() == sibling.getInputShapeAtPort(REDUCE_DATA).getRank() &&
+           getNormalizedAxes() == sibling.getNormalizedAxes();
+}
+
+size_t Reduce::mergeSibling(const Reduce& sibling, bool squaredInput) {
+    if (multiOutputs.empty())
+        multiOutputs.push_back({algorithm, false});
+    multiOutputs.push_back({sibling.getAlgorithm(), squaredInput});
+
+    outputShapes.push_back(outputShapes.front());
+    addOriginalOutputPrecision(Precision::FP32);
+    addOriginalLayer(sibling.getOriginalLayers());
+    shapeInference = std::make_shared<MultiOutputReduceShapeInfer>(shapeInference, multiOutputs.size());
+
+    return multiOutputs.size() - 1;
+}
+
+void Reduce::prepareMultiOutputParams() {
+    const auto& dims = getParentEdgesAtPort(REDUCE_DATA)[0]->getMemory().getStaticDims();
+    const auto axes = getNormalizedAxes();
+    multiOuter = std::accumulate(dims.begin(), dims.begin() + axes.front(), size_t(1), std::multiplies<size_t>());
+    multiReduced = std::accumulate(dims.begin() + axes.front(), dims.begin() + axes.back() + 1, size_t(1), std::multiplies<size_t>());
+    multiInner = std::accumulate(dims.begin() + axes.back() + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+
+    // The threads split the output positions. When they are too few to feed all the threads, the reduced dimension
+    // is split in parts as well, which are accumulated in parallel and merged at the end.
+    const size_t threadsNum = parallel_get_max_threads();
+    const size_t positionsChunks = div_up(multiOuter * multiInner, multiPositionsChunk);
+    multiParts = 1;
+    if (positionsChunks < threadsNum) {
+        const size_t maxParts = multiReduced * multiOuter * multiInner / multiPartMinSize;
+        multiParts = std::max(std::min({div_up(threadsNum, positionsChunks), maxParts, multiReduced}), size_t(1));
+    }
+    if (multiParts > 1)
+        multiPartials.resize(multiParts * multiOuter * multiInner);
+}
+
+void Reduce::executeMultiOutput() {
+    using namespace InferenceEngine::Extensions::Cpu;
+
+    std::vector<multi_reduce_output> outputs(multiOutputs.size());
+    for (size_t i = 0; i < multiOutputs.size(); i++) {
+        auto& output = outputs[i];
+        output.scale = 1.f;
+        output.sqrt = false;
+        output.dst = reinterpret_cast<float *>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+        switch (multiOutputs[i].algorithm) {
+            case Algorithm::ReduceMean:
+                output.scale = 1.f / multiReduced;
+                output.stat = multiOutputs[i].squaredInput ? multi_reduce_stat::sum_square : multi_reduce_stat::sum;
+                break;
+            case Algorithm::ReduceSum:
+                output.stat = multiOutputs[i].squaredInput ? multi_reduce_stat::sum_square : multi_reduce_stat::sum;
+                break;
+            case Algorithm::ReduceL2:
+                output.sqrt = true;
+                output.stat = multi_reduce_stat::sum_square;
+                break;
+            case Algorithm::ReduceSumSquare:
+                output.stat = multi_reduce_stat::sum_square;
+                break;
+            case Algorithm::ReduceMax:
+                output.stat = multi_reduce_stat::max;
+                break;
+            case Algorithm::ReduceMin:
+                output.stat = multi_reduce_stat::min;
+                break;
+            default:
+                IE_THROW() << errorPrefix << " gets unsupported reduction of the merged siblings";
+        }
+    }
+
+    const multi_reduce_args args = {reinterpret_cast<const float *>(getParentEdgeAt(REDUCE_DATA)->getMemoryPtr()->GetPtr()),
+                                    multiOuter, multiReduced, multiInner, outputs.data(), outputs.size(),
+                                    multiParts, multiPartials.data()};
+    const size_t positions = multiOuter * multiInner;
+    if (multiParts == 1) {
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(positions, nthr, ithr, start, end);
+            XARCH::multi_reduce(args, 0, start, end);
+        });
+        return;
+    }
+
+    const size_t chunks = div_up(positions, multiPositionsChunk);
+    parallel_for2d(multiParts, chunks, [&](size_t part, size_t chunk) {
+        XARCH::multi_reduce(args, part, chunk * multiPositionsChunk, std::min(positions, (chunk + 1) * multiPositionsChunk));
+    });
+    parallel_for(chunks, [&](size_t chunk) {
+        XARCH::multi_reduce(args, multiParts, chunk * multiPositionsChunk, std::min(positions, (chunk + 1) * multiPositionsChunk));
+    });
+}
+
 bool Reduce::created() const {
     return getType() == Type::Reduce;
 }
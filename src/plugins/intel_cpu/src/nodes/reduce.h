@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include "executors/reduce_list.hpp"
+#include "reduce_multi.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -104,6 +105,17 @@ public:
     bool isExecutable() const override;
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * Sibling reductions of the same input over the same axes are merged into a single node, which computes all of
+     * them in one pass over the input and writes each one to its own output port. Only f32 sum, mean, sum of squares,
+     * L2, max and min reductions over contiguous axes are supported.
+     * 'squaredInput' means the sibling reduces the square of the input of this node, e.g. the mean of squares
+     * of the variance.
+     */
+    bool canMergeSibling(const Reduce& sibling, bool squaredInput) const;
+    // Returns the output port of the merged reduction
+    size_t mergeSibling(const Reduce& sibling, bool squaredInput);
+
 private:
     void reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size);
     void reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr);
@@ -127,6 +139,10 @@ private:
     void setJITBeyond5D();
     std::vector<int> update_src_dims();
     bool canApplyJIT(const InferenceEngine::Precision &input_prec, const InferenceEngine::Precision &output_prec) const;
+    bool canComputeMultiOutput() const;
+    std::vector<int> getNormalizedAxes() const;
+    void prepareMultiOutputParams();
+    void executeMultiOutput();
 
     size_t blk_size;
     size_t dst_size;
@@ -175,6 +191,16 @@ private:
 
     std::string errorPrefix;
 
+    struct MultiReduceOutput {
+        Algorithm algorithm;
+        bool squaredInput;
+    };
+    // The reductions of the output ports, empty for a single reduction
+    std::vector<MultiReduceOutput> multiOutputs;
+    size_t multiOuter = 0, multiReduced = 0, multiInner = 0;
+    size_t multiParts = 1;
+    std::vector<InferenceEngine::Extensions::Cpu::multi_reduce_stats> multiPartials;
+
     ReduceAttrs reduceAttrs;
     bool canUseAclExecutor = false;
     std::shared_ptr<ReduceExecutor> aclExecPtr = nullptr;
@@ -0,0 +1,228 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "reduce_multi.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+// the second operand is returned if any of them is NaN, as vmaxps / vminps in the single-output Reduce kernels
+inline float max_op(float x, float y) {
+    return x > y ? x : y;
+}
+inline float min_op(float x, float y) {
+    return x < y ? x : y;
+}
+
+inline multi_reduce_stats init_stats() {
+    return {0.f, 0.f, std::numeric_limits<float>::lowest(), (std::numeric_limits<float>::max)()};
+}
+inline void accumulate_stats(multi_reduce_stats& s, float value) {
+    s.sum += value;
+    s.sum_square += value * value;
+    s.max = max_op(s.max, value);
+    s.min = min_op(s.min, value);
+}
+inline void merge_stats(multi_reduce_stats& s, const multi_reduce_stats& other) {
+    s.sum += other.sum;
+    s.sum_square += other.sum_square;
+    s.max = max_op(s.max, other.max);
+    s.min = min_op(s.min, other.min);
+}
+
+#if defined(HAVE_AVX512F)
+struct stats_vec {
+    static constexpr size_t width = 16;
+    __m512 sum = _mm512_setzero_ps();
+    __m512 sum_square = _mm512_setzero_ps();
+    __m512 max = _mm512_set1_ps(std::numeric_limits<float>::lowest());
+    __m512 min = _mm512_set1_ps((std::numeric_limits<float>::max)());
+
+    void accumulate(const float* src) {
+        const __m512 value = _mm512_loadu_ps(src);
+        sum = _mm512_add_ps(sum, value);
+        sum_square = _mm512_fmadd_ps(value, value, sum_square);
+        max = _mm512_max_ps(max, value);
+        min = _mm512_min_ps(min, value);
+    }
+    void merge(const stats_vec& other) {
+        sum = _mm512_add_ps(sum, other.sum);
+        sum_square = _mm512_add_ps(sum_square, other.sum_square);
+        max = _mm512_max_ps(max, other.max);
+        min = _mm512_min_ps(min, other.min);
+    }
+    void store(multi_reduce_stats* lanes) const {
+        float s[width], q[width], mx[width], mn[width];
+        _mm512_storeu_ps(s, sum);
+        _mm512_storeu_ps(q, sum_square);
+        _mm512_storeu_ps(mx, max);
+        _mm512_storeu_ps(mn, min);
+        for (size_t i = 0; i < width; i++)
+            lanes[i] = {s[i], q[i], mx[i], mn[i]};
+    }
+};
+#elif defined(HAVE_AVX2)
+struct stats_vec {
+    static constexpr size_t width = 8;
+    __m256 sum = _mm256_setzero_ps();
+    __m256 sum_square = _mm256_setzero_ps();
+    __m256 max = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+    __m256 min = _mm256_set1_ps((std::numeric_limits<float>::max)());
+
+    void accumulate(const float* src) {
+        const __m256 value = _mm256_loadu_ps(src);
+        sum = _mm256_add_ps(sum, value);
+        sum_square = _mm256_fmadd_ps(value, value, sum_square);
+        max = _mm256_max_ps(max, value);
+        min = _mm256_min_ps(min, value);
+    }
+    void merge(const stats_vec& other) {
+        sum = _mm256_add_ps(sum, other.sum);
+        sum_square = _mm256_add_ps(sum_square, other.sum_square);
+        max = _mm256_max_ps(max, other.max);
+        min = _mm256_min_ps(min, other.min);
+    }
+    void store(multi_reduce_stats* lanes) const {
+        float s[width], q[width], mx[width], mn[width];
+        _mm256_storeu_ps(s, sum);
+        _mm256_storeu_ps(q, sum_square);
+        _mm256_storeu_ps(mx, max);
+        _mm256_storeu_ps(mn, min);
+        for (size_t i = 0; i < width; i++)
+            lanes[i] = {s[i], q[i], mx[i], mn[i]};
+    }
+};
+#else
+struct stats_vec {
+    static constexpr size_t width = 1;
+    multi_reduce_stats value = init_stats();
+
+    void accumulate(const float* src) {
+        accumulate_stats(value, *src);
+    }
+    void merge(const stats_vec& other) {
+        merge_stats(value, other.value);
+    }
+    void store(multi_reduce_stats* lanes) const {
+        lanes[0] = value;
+    }
+};
+#endif
+
+constexpr size_t width = stats_vec::width;
+// output positions processed together, the statistics are kept on the stack
+constexpr size_t positions_block = 64;
+
+inline void finalize(const multi_reduce_args& args, const multi_reduce_stats& s, size_t idx) {
+    for (size_t i = 0; i < args.outputs_num; i++) {
+        const auto& output = args.outputs[i];
+        float value = 0.f;
+        switch (output.stat) {
+            case multi_reduce_stat::sum: value = s.sum; break;
+            case multi_reduce_stat::sum_square: value = s.sum_square; break;
+            case multi_reduce_stat::max: value = s.max; break;
+            case multi_reduce_stat::min: value = s.min; break;
+        }
+        value *= output.scale;
+        output.dst[idx] = output.sqrt ? std::sqrt(value) : value;
+    }
+}
+
+// the reduced dimension is the innermost one: the row is accumulated in the vector lanes, which are merged at the end
+multi_reduce_stats reduce_row(const float* src, size_t r_begin, size_t r_end) {
+    stats_vec acc0, acc1;
+    size_t r = r_begin;
+    for (; r + 2 * width <= r_end; r += 2 * width) {
+        acc0.accumulate(src + r);
+        acc1.accumulate(src + r + width);
+    }
+    for (; r + width <= r_end; r += width)
+        acc0.accumulate(src + r);
+    acc0.merge(acc1);
+
+    multi_reduce_stats lanes[width];
+    acc0.store(lanes);
+    multi_reduce_stats s = lanes[0];
+    for (size_t i = 1; i < width; i++)
+        merge_stats(s, lanes[i]);
+    for (; r < r_end; r++)
+        accumulate_stats(s, src[r]);
+    return s;
+}
+
+// the inner dimension is kept: the vector lanes are the inner positions [i_begin, i_end)
+void reduce_columns(const float* src, size_t inner, size_t r_begin, size_t r_end, size_t i_begin, size_t i_end,
+                    multi_reduce_stats* dst) {
+    size_t i = i_begin;
+    for (; i + width <= i_end; i += width) {
+        stats_vec acc;
+        for (size_t r = r_begin; r < r_end; r++)
+            acc.accumulate(src + r * inner + i);
+        acc.store(dst + i - i_begin);
+    }
+    for (; i < i_end; i++) {
+        multi_reduce_stats s = init_stats();
+        for (size_t r = r_begin; r < r_end; r++)
+            accumulate_stats(s, src[r * inner + i]);
+        dst[i - i_begin] = s;
+    }
+}
+
+}  // namespace
+
+void multi_reduce(const multi_reduce_args& args, size_t part, size_t begin, size_t end) {
+    const size_t inner = args.inner;
+    const size_t positions = args.outer * inner;
+
+    if (args.parts > 1 && part == args.parts) {
+        for (size_t pos = begin; pos < end; pos++) {
+            multi_reduce_stats s = args.partials[pos];
+            for (size_t p = 1; p < args.parts; p++)
+                merge_stats(s, args.partials[p * positions + pos]);
+            finalize(args, s, pos);
+        }
+        return;
+    }
+
+    const size_t r_begin = part * args.reduced / args.parts;
+    const size_t r_end = (part + 1) * args.reduced / args.parts;
+    multi_reduce_stats* partials = args.parts > 1 ? args.partials + part * positions : nullptr;
+
+    multi_reduce_stats stats[positions_block];
+    size_t pos = begin;
+    while (pos < end) {
+        const size_t o = pos / inner;
+        const size_t i_begin = pos % inner;
+        const size_t i_end = (std::min)(inner, i_begin + (std::min)(positions_block, end - pos));
+        const float* src = args.src + o * args.reduced * inner;
+        if (inner == 1)
+            stats[0] = reduce_row(src, r_begin, r_end);
+        else
+            reduce_columns(src, inner, r_begin, r_end, i_begin, i_end, stats);
+
+        for (size_t i = i_begin; i < i_end; i++) {
+            if (partials)
+                partials[o * inner + i] = stats[i - i_begin];
+            else
+                finalize(args, stats[i - i_begin], o * inner + i);
+        }
+        pos = o * inner + i_end;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
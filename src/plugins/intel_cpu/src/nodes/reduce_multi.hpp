@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Statistics which are computed together in a single pass over the input
+enum class multi_reduce_stat {
+    sum,
+    sum_square,
+    max,
+    min
+};
+
+struct multi_reduce_output {
+    multi_reduce_stat stat;
+    float scale;            // the statistic is multiplied by it, e.g. 1 / reduced size for mean
+    bool sqrt;              // square root of the scaled statistic, e.g. for L2
+    float* dst;             // [outer, inner]
+};
+
+// Statistics of a part of the reduced dimension
+struct multi_reduce_stats {
+    float sum;
+    float sum_square;
+    float max;
+    float min;
+};
+
+struct multi_reduce_args {
+    const float* src;       // [outer, reduced, inner]
+    size_t outer;
+    size_t reduced;
+    size_t inner;
+    const multi_reduce_output* outputs;
+    size_t outputs_num;
+    size_t parts;           // the reduced dimension is split in parts when the outputs are too few for the threads
+    multi_reduce_stats* partials;   // [parts, outer, inner], used if parts > 1
+};
+
+namespace XARCH {
+
+/**
+ * Reduces the output positions [begin, end) of the [outer, inner] output, each input element is read only once
+ * whatever the number of the outputs. If the reduced dimension is split in parts, part < parts accumulates the
+ * statistics of the part into the partials and part == parts merges them into the outputs, otherwise part is 0.
+ * Max and min follow the single-output Reduce: max(acc, x) and min(acc, x) are x if any of them is NaN.
+ */
+void multi_reduce(const multi_reduce_args& args, size_t part, size_t begin, size_t end);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -153,8 +153,9 @@ void Split::initSupportedPrimitiveDescriptors() {
         }
         supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::ref);
 
-        if (itr->first == LayoutType::ncsp) {
-            // at least the plain layout can be optimized inplace.
+        if (itr->first == LayoutType::ncsp || itr->first == LayoutType::nspc) {
+            // the plain and nspc layouts can be optimized inplace for any axis,
+            // the strided nspc views are selected only if a consumer accepts the strides (see isInPlaceApplicable)
             pdIndexesToReuse.emplace_back(supportedPrimitiveDescriptors.size() - 1);
         } else if (itr->first == LayoutType::nCsp8c || itr->first == LayoutType::nCsp16c) {
             if (axis < 2) {
@@ -173,6 +174,7 @@ void Split::initSupportedPrimitiveDescriptors() {
             const auto& order = inBlockingDesc->getOrder();
             const auto& blkDims = inBlockingDesc->getBlockDims();
             auto numOfDim = blkDims.size();
+            const auto realAxis = getRealAxis(order);
 
             SizeVector offsets(numOfDim, 0lu);
             SizeVector strides(numOfDim);
@@ -181,7 +183,7 @@ void Split::initSupportedPrimitiveDescriptors() {
             BlockedMemoryDesc::CmpMask mask = BLOCKED_DESC_SKIP_OFFSET_MASK; // accepts any offset
 
             for (size_t i = 2; i <= numOfDim; i++) {
-                if (numOfDim - i < axis) {
+                if (numOfDim - i < realAxis) {
                     strides[numOfDim - i] = Shape::UNDEFINED_DIM;
                     mask.reset(numOfDim - i); // accepts any strides on axis
                 } else {
@@ -319,6 +321,41 @@ void Split::execute(dnnl::stream strm) {
     execPtr->exec(srcData, getRawDstMemPtrs());
 }
 
+bool Split::isInPlaceApplicable(const NodeConfig& config) const {
+    const auto inDesc = config.inConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+    // the plain and blocked layouts go in place as before, the consumers take the strided views or reorder them
+    if (!inDesc->hasLayoutType(LayoutType::nspc))
+        return true;
+
+    // the views are dense if the dims before the axis are equal to 1, so any consumer may read them
+    const auto& blkDims = inDesc->getBlockDims();
+    const auto realAxis = getRealAxis(inDesc->getOrder());
+    if (std::all_of(blkDims.begin(), blkDims.begin() + realAxis, [](size_t dim) { return dim == 1; }))
+        return true;
+
+    // otherwise at least one consumer has to accept the strides of the input on the outer dims,
+    // the rest of the outputs are copied from the views by the reorders which is not worse than the split itself.
+    // The consumers are selected after the split, so the strided views are taken when the split is selected again
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        const auto childEdge = getChildEdgeAt(i);
+        const auto childPd = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+        const int outputNum = childEdge->getInputNum();
+        const int inputNum = childEdge->getOutputNum();
+        if (childPd == nullptr || outputNum < 0 || outputNum >= config.outConfs.size() ||
+            inputNum < 0 || inputNum >= childPd->getConfig().inConfs.size())
+            continue;
+
+        const auto& childConf = childPd->getConfig().inConfs[inputNum];
+        if (childConf.getPortDesc()->isCompatible(*config.outConfs[outputNum].getPortDesc()))
+            return true;
+    }
+    return false;
+}
+
+size_t Split::getRealAxis(const VectorDims& order) const {
+    return std::find(order.begin(), order.end(), axis) - order.begin();
+}
+
 bool Split::created() const {
     return getType() == Type::Split;
 }
@@ -357,6 +394,8 @@ void Split::initOptimalPrimitiveDescriptor() {
             THROW_ERROR << "has invalid config";
 
         auto firstInBlockingDesc = config.inConfs[0].getMemDesc()->as<BlockedMemoryDesc>();
+        const auto& inStrides = firstInBlockingDesc->getStrides();
+        const auto realAxis = getRealAxis(firstInBlockingDesc->getOrder());
         size_t offset = 0;
         for (size_t i = 0; i < outputShapes.size(); i++) {
             auto oldDesc = config.outConfs[i].getMemDesc();
@@ -370,13 +409,11 @@ void Split::initOptimalPrimitiveDescriptor() {
                                                                              firstInBlockingDesc->getOffsetPadding() + offset,
                                                                              firstInBlockingDesc->getOffsetPaddingToData(),
                                                                              (shape.hasZeroDims() ? VectorDims(blkDims.size(), 0) :
-                                                                              firstInBlockingDesc->getStrides())), BLOCKED_DESC_FULL_MASK);
+                                                                              inStrides)), BLOCKED_DESC_FULL_MASK);
 
-            size_t axisSize = 1;
-            for (size_t j = axis; j < outBlockingDesc->getBlockDims().size(); j++) {
-                axisSize *= outBlockingDesc->getBlockDims()[j];
-            }
-            offset += axisSize;
+            // the next view starts after the current one along the axis, it works for the plain, nspc and blocked layouts
+            // as the axis dim is the outermost one of the view in the memory order
+            offset += blkDims[realAxis] * inStrides[realAxis];
         }
         initDescriptor(config);
     }
@@ -412,6 +449,9 @@ void Split::selectOptimalPrimitiveDescriptor() {
     // check the descriptors and select the ones that have the same data format as the input
     std::vector<size_t> canSelectPrimitive;
     for (size_t i = 0; i < supportedPrimitiveDescriptors.size(); i++) {
+        if (supportedPrimitiveDescriptors[i].getImplementationType() == impl_desc_type::unknown &&
+            !isInPlaceApplicable(supportedPrimitiveDescriptors[i].getConfig()))
+            continue;
         auto parentEdge = getParentEdgeAt(0);
         auto parentPtr = parentEdge->getParent();
         auto parent_spd = parentPtr->getSelectedPrimitiveDescriptor();
@@ -52,6 +52,8 @@ private:
             size_t countStrides;
     };
 
+    bool isInPlaceApplicable(const NodeConfig& config) const;
+    size_t getRealAxis(const VectorDims& order) const;
     void optimizedNspc2Ncsp(size_t MB);
     std::vector<uint8_t*> getRawDstMemPtrs() const;
 
@@ -9,7 +9,9 @@
 #include <vector>
 #include <algorithm>
 #include <array>
+#include <sstream>
 #include <tuple>
+#include <unordered_map>
 
 #include <dnnl_debug.h>
 #include <onednn/dnnl.h>
@@ -23,6 +25,7 @@
 #include <snippets/op/subgraph.hpp>
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "utils/cpu_utils.hpp"
+#include <common/primitive_hashing_utils.hpp>
 #include "emitters/x64/cpu_generator.hpp"
 #include "transformations/snippets/x64/pass/fuse_load_store_and_convert.hpp"
 #include "transformations/snippets/x64/pass/mul_add_to_fma.hpp"
@@ -72,6 +75,211 @@ public:
 private:
     Snippet* m_node;
 };
+
+// Serializes the node attributes to a stream, the names of the attributes are skipped.
+// The attributes which can't be serialized (ValueAccessor<void>) mark the signature as incomplete
+class SignatureVisitor : public ov::AttributeVisitor {
+public:
+    explicit SignatureVisitor(std::ostringstream& stream) : m_stream(stream) {
+        m_stream << std::hexfloat;
+    }
+
+    bool is_complete() const {
+        return m_complete;
+    }
+
+    using ov::AttributeVisitor::on_adapter;
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        m_complete = false;
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<void*>& adapter) override {
+        const auto data = static_cast<const char*>(adapter.get_ptr());
+        m_stream << "[" << adapter.size() << ":";
+        m_stream.write(data, adapter.size());
+        m_stream << "]";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        m_stream << "\"" << adapter.get() << "\";";
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        write(adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        write(adapter.get());
+    }
+
+private:
+    template <typename T>
+    void write(const T& value) {
+        // int8_t and uint8_t are promoted to be written as numbers
+        m_stream << +value << ";";
+    }
+    template <typename T>
+    void write(const std::vector<T>& values) {
+        m_stream << "{";
+        for (const auto& value : values)
+            m_stream << value << ",";
+        m_stream << "}";
+    }
+    void write(const std::vector<int8_t>& values) {
+        write(std::vector<int64_t>(values.begin(), values.end()));
+    }
+    void write(const std::vector<uint8_t>& values) {
+        write(std::vector<uint64_t>(values.begin(), values.end()));
+    }
+    void write(const std::vector<std::string>& values) {
+        m_stream << "{";
+        for (const auto& value : values)
+            m_stream << "\"" << value << "\",";
+        m_stream << "}";
+    }
+
+    std::ostringstream& m_stream;
+    bool m_complete = true;
+};
+
+// Canonical description of the Subgraph body: operation types with versions, connections, precisions, shapes and attributes
+// in the topological order. The friendly names of the nodes are ignored, so the same bodies from different nodes
+// (e.g. the repeated blocks of a model) have the same signature.
+// Returns an empty string if the body can't be described completely
+std::string getBodySignature(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
+    std::ostringstream signature;
+    SignatureVisitor visitor(signature);
+    const auto& body = subgraph->body_ptr();
+    std::unordered_map<const ov::Node*, size_t> ids;
+    for (const auto& op : body->get_ordered_ops()) {
+        const auto& typeInfo = op->get_type_info();
+        signature << ids.size() << "=" << typeInfo.name << ":" << typeInfo.get_version() << "(";
+        for (const auto& input : op->input_values())
+            signature << ids.at(input.get_node()) << "." << input.get_index() << ",";
+        signature << ")->(";
+        for (const auto& output : op->outputs())
+            signature << output.get_element_type() << output.get_partial_shape() << ",";
+        signature << ")";
+        if (const auto& parameter = ov::as_type_ptr<ov::op::v0::Parameter>(op))
+            signature << "p" << body->get_parameter_index(parameter);
+        else if (const auto& result = ov::as_type_ptr<ov::op::v0::Result>(op))
+            signature << "r" << body->get_result_index(result);
+        signature << "[";
+        op->visit_attributes(visitor);
+        signature << "];";
+        ids.emplace(op.get(), ids.size());
+    }
+    signature << "v" << subgraph->get_virtual_port_count() << "b" << subgraph->is_buffer_needed();
+    return visitor.is_complete() ? signature.str() : std::string{};
+}
+
+struct SnippetKey {
+    std::string bodySignature;
+    // the body signature is the same for all the kernels of the node, so its hash is computed once
+    size_t bodySignatureHash;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputBlockedShapes;
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputBlockedShapes;
+    std::vector<VectorDims> ioShapes;
+    VectorDims masterShape;
+    size_t tileRank;
+    bool isShapeAgnostic;
+    dnnl::impl::cpu::x64::cpu_isa_t isa;
+    bool enforceBF16;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = bodySignatureHash;
+        auto hash_combine_blockedShapes = [](size_t seed, const ngraph::snippets::op::Subgraph::BlockedShapeVector& shapes) {
+            for (const auto& shape : shapes) {
+                for (const auto& dim : std::get<0>(shape))
+                    seed = hash_combine(seed, dim.is_static() ? dim.get_length() : -1);
+                seed = get_vector_hash(seed, std::get<1>(shape));
+                seed = hash_combine(seed, std::get<2>(shape).hash());
+            }
+            return seed;
+        };
+        seed = hash_combine_blockedShapes(seed, inputBlockedShapes);
+        seed = hash_combine_blockedShapes(seed, outputBlockedShapes);
+        for (const auto& shape : ioShapes)
+            seed = get_vector_hash(seed, shape);
+        seed = get_vector_hash(seed, masterShape);
+        seed = hash_combine(seed, tileRank);
+        seed = hash_combine(seed, isShapeAgnostic);
+        seed = hash_combine(seed, isa);
+        seed = hash_combine(seed, enforceBF16);
+        return seed;
+    }
+
+    bool operator==(const SnippetKey& rhs) const {
+        return bodySignatureHash == rhs.bodySignatureHash &&
+               bodySignature == rhs.bodySignature &&
+               inputBlockedShapes == rhs.inputBlockedShapes &&
+               outputBlockedShapes == rhs.outputBlockedShapes &&
+               ioShapes == rhs.ioShapes &&
+               masterShape == rhs.masterShape &&
+               tileRank == rhs.tileRank &&
+               isShapeAgnostic == rhs.isShapeAgnostic &&
+               isa == rhs.isa &&
+               enforceBF16 == rhs.enforceBF16;
+    }
+};
 } // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
@@ -85,21 +293,26 @@ Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CP
 }
 
 void Snippet::copy_snippet() {
+    snippet = clone_snippet();
+    isa_num_lanes =  snippet->get_generator()->get_target_machine()->get_lanes();
+}
+
+std::shared_ptr<ngraph::snippets::op::Subgraph> Snippet::clone_snippet() const {
     ngraph::OutputVector subgraph_node_inputs;
     for (const auto &input : original_snippet->input_values()) {
         auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
         subgraph_node_inputs.push_back(new_input);
     }
     std::shared_ptr<ov::Model> new_body = original_snippet->body_ptr()->clone();
-    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-    ngraph::copy_runtime_info(original_snippet, snippet);
-    snippet->set_friendly_name(original_snippet->get_friendly_name());
+    auto subgraph = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original_snippet, subgraph);
+    subgraph->set_friendly_name(original_snippet->get_friendly_name());
 #if defined(OPENVINO_ARCH_X86_64)
-    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
-    isa_num_lanes =  snippet->get_generator()->get_target_machine()->get_lanes();
+    subgraph->set_generator(std::make_shared<CPUGenerator>(host_isa));
 #else
     IE_THROW(NotImplemented) << "CPU plugin: code-generation is not supported on non-x64 platforms";
 #endif // OPENVINO_ARCH_X86_64
+    return subgraph;
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
@@ -330,26 +543,30 @@ ov::PartialShape Snippet::canonicalizeBody() {
     };
     inputShapeIsBlocked.resize(inputShapes.size(), false);
     masterShapeIsBlocked = false;
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
+    inputBlockedShapes.clear();
     for (size_t i = 0; i < inputShapes.size(); i++) {
         auto blockedShape = edgeToBlockedShape(getParentEdgesAtPort(i)[0]);
         inputShapeIsBlocked[i] = std::get<0>(blockedShape).size() != std::get<1>(blockedShape).size();
         masterShapeIsBlocked = masterShapeIsBlocked || inputShapeIsBlocked[i];
-        input_blocked_shapes.push_back(blockedShape);
+        inputBlockedShapes.push_back(blockedShape);
     }
 
     outputShapeIsBlocked.resize(outputShapes.size(), false);
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
+    outputBlockedShapes.clear();
     for (size_t i = 0; i < outputShapes.size(); i++) {
         auto blockedShape = edgeToBlockedShape(getChildEdgesAtPort(i)[0]);
         outputShapeIsBlocked[i] = std::get<0>(blockedShape).size() != std::get<1>(blockedShape).size();
-        output_blocked_shapes.push_back(blockedShape);
+        outputBlockedShapes.push_back(blockedShape);
     }
 
-    const auto& canonicalShape = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    const auto& canonicalShape = snippet->canonicalize(outputBlockedShapes, inputBlockedShapes);
     return canonicalShape;
 }
 void Snippet::createPrimitive() {
+    // the signature is taken before canonicalization, since the canonicalization depends on the blocked shapes
+    // which are the separate part of the kernel cache key
+    bodySignature = getBodySignature(snippet);
+    bodySignatureHash = std::hash<std::string>{}(bodySignature);
     // determine canonicalize, determine master_shape and prepend up to 6D
     // NB! normInputShapes are updated, so body reshape might be needed
     const auto& canonicalShape = canonicalizeBody();
@@ -368,9 +585,18 @@ void Snippet::createPrimitive() {
     };
     initDataSizes();
 
+    if (canonicalShape.is_dynamic()) {
+        // The kernels are generated in prepareParams, when the broadcasting pattern of the input shapes is known
+        if (snippet->has_domain_sensitive_ops())
+            IE_THROW() << "Snippets: Canonicalization returned dynamic shape for subgraph with domain sensitive ops";
+        if (tensorRank != rank6D)
+            IE_THROW() << "Snippets: shape-agnostic kernels support only " << rank6D << "D scheduling, got rank " << tensorRank;
+        normInputShapes.resize(inputShapes.size());
+        normOutputShapes.resize(outputShapes.size());
+        return;
+    }
+
     jit_snippets_compile_args jcp;
-    if (canonicalShape.is_dynamic())
-        IE_THROW() << "Snippets: Canonicalization returned dynamic shape in static pipeline";
     masterShape = canonicalShape.get_shape();
     const auto &body = snippet->body_ptr();
     for (const auto& p : body->get_parameters())
@@ -381,11 +607,37 @@ void Snippet::createPrimitive() {
     prepareParams();
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet->get_buffer_scratchpad_size();
+    std::vector<VectorDims> ioShapes(normInputShapes);
+    std::copy(normOutputShapes.begin(), normOutputShapes.end(), std::back_inserter(ioShapes));
+    compiledSnippet = compile(ioShapes, jcp, [this]() { return snippet; });
+    schedule = compiledSnippet->schedule;
+    buffer_scratchpad_size = compiledSnippet->snippet->get_buffer_scratchpad_size();
     buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
 }
 
+Snippet::CompiledSnippetPtr Snippet::compile(const std::vector<VectorDims>& ioShapes,
+                                             const jit_snippets_compile_args& jcp,
+                                             const std::function<std::shared_ptr<ngraph::snippets::op::Subgraph>()>& prepareSubgraph) {
+    auto builder = [this, &jcp, &prepareSubgraph](const SnippetKey&) -> CompiledSnippetPtr {
+        auto compiled = std::make_shared<CompiledSnippet>();
+        compiled->snippet = prepareSubgraph();
+        compiled->schedule = generate(compiled->snippet, &jcp);
+        return compiled;
+    };
+
+    SnippetKey key{bodySignature, bodySignatureHash, inputBlockedShapes, outputBlockedShapes, ioShapes,
+                   jcp.master_shape, jcp.tile_rank, jcp.is_shape_agnostic, host_isa, context->getConfig().enforceBF16};
+    // the body can't be compared with the other ones, so the kernel isn't shared
+    if (bodySignature.empty())
+        return builder(key);
+
+    auto cache = context->getSnippetsCache();
+    auto result = cache->getOrCreate(key, builder);
+    if (result.second == CacheEntryBase::LookUpStatus::Hit)
+        kernelCacheHits++;
+    return result.first;
+}
+
 std::vector<VectorDims> Snippet::shapeInfer() {
     // todo: it's very strange that we don't have broadcast_merge_into for cpu shapes
     auto broadcast_merge = [](VectorDims& dst, const VectorDims& src){
@@ -495,6 +747,11 @@ void Snippet::prepareParams() {
         dim = 1;
     }
 
+    if (isDynamic) {
+        prepareShapeAgnosticKernel();
+        return;
+    }
+
     auto& body_rt_info = snippet->body_ptr()->get_rt_info();
     std::vector<std::vector<size_t>> new_shapes(normInputShapes);
     std::copy(normOutputShapes.begin(), normOutputShapes.end(), std::back_inserter(new_shapes));
@@ -503,6 +760,82 @@ void Snippet::prepareParams() {
     snippet->set_tile_rank(tileRank);
 }
 
+void Snippet::prepareShapeAgnosticKernel() {
+    const size_t numInputs = normInputShapes.size();
+    std::vector<VectorDims> ioShapes(normInputShapes);
+    std::copy(normOutputShapes.begin(), normOutputShapes.end(), std::back_inserter(ioShapes));
+    if (ioShapes.size() > SNIPPETS_MAX_SNIPPETS_DIMS)
+        IE_THROW() << "Snippet node with name " << getName() << " has too many inputs and outputs for shape-agnostic kernel";
+
+    // The generated code depends only on the dims processed inside the kernel and on whether they are broadcasted,
+    // so the kernel is generated for the proxy shapes which keep the broadcasting pattern of the actual ones
+    const size_t rank = masterShape.size();
+    const size_t innerDim = rank - 1;
+    const size_t outerDim = rank - 2;
+    auto isBroadcasted = [this](const VectorDims& dims, size_t dim) {
+        return dims[dim] == 1 && masterShape[dim] != 1;
+    };
+    std::vector<bool> key{tileRank == 2};
+    VectorDims proxyMasterShape(rank, 1);
+    proxyMasterShape[innerDim] = isa_num_lanes;
+    if (tileRank == 2)
+        proxyMasterShape[outerDim] = 2;
+    std::vector<VectorDims> proxyShapes(ioShapes.size(), proxyMasterShape);
+    for (size_t i = 0; i < ioShapes.size(); i++) {
+        for (size_t dim = rank - tileRank; dim < rank; dim++) {
+            const bool broadcasted = isBroadcasted(ioShapes[i], dim);
+            key.push_back(broadcasted);
+            if (broadcasted)
+                proxyShapes[i][dim] = 1;
+        }
+    }
+
+    auto kernelIt = shapeAgnosticKernels.find(key);
+    if (kernelIt == shapeAgnosticKernels.end()) {
+        jit_snippets_compile_args jcp;
+        jcp.master_shape = proxyMasterShape;
+        jcp.tile_rank = tileRank;
+        jcp.is_shape_agnostic = true;
+        auto prepareSubgraph = [&]() {
+            auto subgraph = clone_snippet();
+            subgraph->canonicalize(outputBlockedShapes, inputBlockedShapes);
+            subgraph->reshape_body(std::vector<ov::Shape>(proxyShapes.begin(), proxyShapes.begin() + numInputs));
+            subgraph->body_ptr()->get_rt_info()["PluginShapesOverride"] = proxyShapes;
+            subgraph->set_master_shape(ov::PartialShape(proxyMasterShape));
+            subgraph->set_tile_rank(tileRank);
+            subgraph->set_shape_agnostic(true);
+            return subgraph;
+        };
+        kernelIt = shapeAgnosticKernels.emplace(key, compile(proxyShapes, jcp, prepareSubgraph)).first;
+    } else {
+        kernelCacheHits++;
+    }
+    schedule = kernelIt->second->schedule;
+    buffer_scratchpad_size = kernelIt->second->snippet->get_buffer_scratchpad_size();
+    buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+
+    // data offsets of the harness dims: byte strides, broadcasted dims don't move the pointers
+    for (size_t i = 0; i < ioShapes.size(); i++) {
+        const auto& dims = ioShapes[i];
+        int64_t stride = static_cast<int64_t>(dataSize[i]);
+        for (int64_t j = static_cast<int64_t>(rank) - 1; j >= 0; j--) {
+            if (j < SNIPPETS_MAX_HARNESS_DIMS)
+                runtimeArgs.data_offsets[i][j] = dims[j] != 1 ? stride : 0;
+            stride *= static_cast<int64_t>(dims[j]);
+        }
+    }
+    // the work amounts of the tile dims, the inner Loop rewinds the pointers by its work amount
+    // (multiplied by data size, finalization_offsets are indexed by log2(data size))
+    for (size_t dim = 0; dim < tileRank; dim++) {
+        auto& loopArgs = runtimeArgs.loop_args[dim];
+        const auto workAmount = static_cast<int64_t>(masterShape[innerDim - dim]);
+        loopArgs.work_amount = workAmount;
+        loopArgs.tail_work_amount = dim == 0 ? workAmount % static_cast<int64_t>(isa_num_lanes) : 0;
+        for (size_t k = 0; k < SNIPPETS_MAX_DATA_SIZE_LOG2; k++)
+            loopArgs.finalization_offsets[k] = -(workAmount << k);
+    }
+}
+
 bool Snippet::needPrepareParams() const {
     return inputShapesModified() || !schedule.ptr;
 }
@@ -536,10 +869,11 @@ bool Snippet::created() const {
     return getType() == Type::Subgraph;
 }
 
-void Snippet::generate(const jit_snippets_compile_args* jcp) {
+ngraph::snippets::Schedule Snippet::generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph,
+                                             const jit_snippets_compile_args* jcp) {
     ov::pass::Manager pre_dialect;
     pre_dialect.register_pass<ConvertToSwishCPU>();
-    if (context->getConfig().enforceBF16 && snippet->has_domain_sensitive_ops()) {
+    if (context->getConfig().enforceBF16 && subgraph->has_domain_sensitive_ops()) {
         // enforce BF16 precisions to supported operations
         // MatMul has to be decomposed to Brgemm operations before enforcement
         // Note, MatMul decomposition will be ran later again for case if BF16 enforcement is not happened
@@ -570,7 +904,7 @@ void Snippet::generate(const jit_snippets_compile_args* jcp) {
             });
     CPU_REGISTER_PASS_X64(post_precision, ov::intel_cpu::pass::MulAddToFMA);
 
-    schedule = snippet->generate(
+    return subgraph->generate(
         pre_dialect,
         post_dialect,
         post_precision,
@@ -588,6 +922,8 @@ void Snippet::update_ptrs(jit_snippets_call_args& call_args) {
         call_args.buffer_scratchpad_ptr =
                 reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
     }
+    if (isDynamic)
+        call_args.runtime_args = &runtimeArgs;
 }
 
 void Snippet::execute(dnnl::stream strm) {
@@ -601,6 +937,10 @@ void Snippet::execute(dnnl::stream strm) {
     }
 }
 
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
 void Snippet::schedule_6d() {
     const auto& dom = exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
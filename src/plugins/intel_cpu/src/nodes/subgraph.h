@@ -14,6 +14,8 @@
 #include "snippets/op/subgraph.hpp"
 
 #include <array>
+#include <functional>
+#include <map>
 
 namespace ov {
 namespace intel_cpu {
@@ -47,6 +49,17 @@ public:
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
+
+    // the generated code of the current kernel, it's shared between the nodes with the same body and shapes
+    const void* getKernelCode() const {
+        return schedule.ptr;
+    }
+
+    // the number of the kernels taken from the node or the runtime cache instead of being generated
+    size_t getKernelCacheHits() const {
+        return kernelCacheHits;
+    }
 
 private:
     static const size_t rank6D {6};
@@ -57,12 +70,28 @@ private:
     // TODO: Probably better to implement a proper copy constructor
     // NOTE: Before call mutex should be initialized
     void copy_snippet();
+    std::shared_ptr<ngraph::snippets::op::Subgraph> clone_snippet() const;
 
     ov::PartialShape canonicalizeBody();
     // returns true if exec domain was modified
     bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
-    void generate(const jit_snippets_compile_args*);
+    ngraph::snippets::Schedule generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>&, const jit_snippets_compile_args*);
+
+    // Generated kernel with the lowered subgraph copy that owns the generated code
+    struct CompiledSnippet {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+    using CompiledSnippetPtr = std::shared_ptr<CompiledSnippet>;
+    // Takes the kernel from the runtime cache or generates it for the subgraph returned by prepareSubgraph.
+    // The kernels are shared between the nodes with the same body signature, shapes and precisions
+    CompiledSnippetPtr compile(const std::vector<VectorDims>& ioShapes,
+                               const jit_snippets_compile_args& jcp,
+                               const std::function<std::shared_ptr<ngraph::snippets::op::Subgraph>()>& prepareSubgraph);
+    // Selects (and generates on the first use) the shape-agnostic kernel for the broadcasting pattern of the current shapes
+    // and fills the runtime args for them
+    void prepareShapeAgnosticKernel();
     inline void update_ptrs(jit_snippets_call_args&);
     // Evaluates generated snippet using parallel backend
     void schedule_6d();
@@ -75,6 +104,23 @@ private:
 
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
+    // Keeps the generated code of the schedule alive, since the kernel may be evicted from the cache
+    CompiledSnippetPtr compiledSnippet;
+
+    // Canonical description of the body (ops, connections, types, shapes and attributes without names), it's the part of the kernel
+    // cache key. Empty if the body has attributes that can't be described, in this case the kernels aren't shared
+    std::string bodySignature;
+    size_t bodySignatureHash = 0;
+
+    // Canonicalization input, it's needed to prepare the subgraph copies for shape-agnostic kernels
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputBlockedShapes = {};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector outputBlockedShapes = {};
+
+    // Dynamic shapes: one kernel per broadcasting pattern
+    // the key is the tile rank flag followed by the broadcasting flags of the tile dims of each input and output
+    std::map<std::vector<bool>, CompiledSnippetPtr> shapeAgnosticKernels;
+    size_t kernelCacheHits = 0;
+    jit_snippets_runtime_args runtimeArgs = {};
 
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
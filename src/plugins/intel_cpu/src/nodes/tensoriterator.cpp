@@ -4,10 +4,12 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include <utils/general_utils.h>
 #include "common/blocked_desc_creator.h"
 #include "utils/ngraph_utils.hpp"
@@ -26,6 +28,9 @@ namespace node {
 
 #define THROW_ERROR IE_THROW() << getTypeStr() << " layer with name '" << getName() << "' "
 
+// Upper bound of the body copies used to execute independent iterations in parallel
+static constexpr int maxParallelBodies = 4;
+
 static NodeConfig make_plain_config(const std::shared_ptr<ov::Node>& op) {
     NodeConfig config;
 
@@ -145,6 +150,115 @@ private:
     int iter_count;
 };
 
+/**
+ * Zero-copy alternative of PortIteratorHelper for slices which are contiguous in the full tensor.
+ * Instead of copying the chunk, the body memory is pointed directly to it on each iteration.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &full_blob, const std::vector<MemoryPtr> &part_blobs, const PortMap &slice_rule)
+                   : full_blob(full_blob), part_blobs(part_blobs) {
+        const auto axis = slice_rule.axis;
+        const auto stride = slice_rule.stride;
+
+        auto full_dims = full_blob->getStaticDims();
+        const auto &part_dims = part_blobs.front()->getStaticDims();
+
+        auto abs_stride = std::abs(stride);
+        auto sign_of_stride = stride < 0.0f ? -1 : 1;
+
+        iter_count = full_dims[axis] / abs_stride;
+
+        full_dims[axis] = abs_stride;
+        IE_ASSERT(full_dims == part_dims) << "Shape mismatch for tensor iterator port";
+
+        const size_t elem_size = full_blob->getDesc().getPrecision().size();
+        chunk_stride_in_byte = std::accumulate(full_dims.begin() + axis, full_dims.end(), elem_size, std::multiplies<size_t>());
+        chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= sign_of_stride;
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk = static_cast<uint8_t *>(full_blob->GetData()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (const auto &part_blob : part_blobs)
+            part_blob->setDataHandle(chunk);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_blob;
+    std::vector<MemoryPtr> part_blobs;
+
+    int iter_count;
+};
+
+// The chunk may be used in place only if it occupies a single continuous block of the full tensor
+static bool isContiguousSlice(const MemoryPtr &full_blob, const MemoryPtr &part_blob, const PortMap &slice_rule) {
+    const auto &full_desc = full_blob->getDesc();
+    const auto &part_desc = part_blob->getDesc();
+    if (!full_desc.hasLayoutType(LayoutType::ncsp) || !part_desc.hasLayoutType(LayoutType::ncsp) ||
+        full_desc.getPrecision() != part_desc.getPrecision())
+        return false;
+
+    const auto &full_dims = full_blob->getStaticDims();
+    return std::all_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim == 1; });
+}
+
+// Body input may be pointed to the external tensor only if none of its consumers can modify the data.
+// Follows the rules used for zero-copy inputs of the graph (see InferRequestBase::changeDefaultPtr)
+static bool canReadInPlace(const NodePtr &input) {
+    for (const auto &edge : input->getChildEdges()) {
+        auto childEdge = edge.lock();
+        if (!childEdge)
+            IE_THROW() << "Node " << input->getName() << " contains empty child edge";
+
+        const auto &child = childEdge->getChild();
+        // Concat and Split use different ptrs without offsets
+        if (child->isConstant() || child->isInPlace() || one_of(child->getType(), Type::Concatenation, Type::Split))
+            return false;
+
+        for (const auto &grandChildEdge : child->getChildEdges()) {
+            auto e = grandChildEdge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == childEdge->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// Body output may be computed directly into the external tensor only if its producer doesn't share the memory
+// with anybody else. Follows the rules used for zero-copy outputs of the graph (see InferRequestBase::changeDefaultPtr)
+static bool canWriteInPlace(const NodePtr &output) {
+    const auto parentEdge = output->getParentEdgeAt(0);
+    const void* defaultPtr = parentEdge->getMemory().GetData();
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getType() == Type::Input || parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        for (const auto &edge : parent->getParentEdges()) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -409,25 +523,7 @@ void TensorIterator::getSupportedDescriptors() {
     }
     const std::shared_ptr<const ov::Model> body = tiOp->get_function();
     sub_graph.CreateGraph(body, context);
-
-    const auto &inMap = sub_graph.GetInputNodesMap();
-    for (const auto &param : tiOp->get_function()->get_parameters()) {
-        auto inNode = inMap.find(param->get_friendly_name());
-        if (inNode != inMap.end()) {
-            input_mems.push_back(getToMemories(inNode->second.get(), 0));
-        }
-    }
-
-    const auto &outMap = sub_graph.GetOutputNodesMap();
-    for (const auto &out : tiOp->get_function()->get_results()) {
-        const auto prev = out->input_value(0);
-        const auto inputID = ov::op::util::create_ie_output_name(prev);
-        auto outNode = outMap.find(inputID);
-        if (outNode != outMap.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            output_mem.push_back(outMem);
-        }
-    }
+    collectBodyPorts(sub_graph, input_mems, output_mem, input_in_place, output_in_place);
 
     // Port map: outputs
     for (const auto& desc : tiOp->get_output_descriptions()) {
@@ -498,6 +594,37 @@ void TensorIterator::getSupportedDescriptors() {
     }
 }
 
+void TensorIterator::collectBodyPorts(Graph& graph,
+                                      std::vector<std::vector<MemoryPtr>>& inputMems,
+                                      std::vector<MemoryPtr>& outputMems,
+                                      std::vector<bool>& inputInPlace,
+                                      std::vector<bool>& outputInPlace) const {
+    auto tiOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
+    // in-place access to the external tensors is possible only when their shapes are known in advance
+    const bool canBeInPlace = !isDynamicNode();
+
+    const auto &inMap = graph.GetInputNodesMap();
+    for (const auto &param : tiOp->get_function()->get_parameters()) {
+        auto inNode = inMap.find(param->get_friendly_name());
+        if (inNode != inMap.end()) {
+            inputMems.push_back(getToMemories(inNode->second.get(), 0));
+            inputInPlace.push_back(canBeInPlace && canReadInPlace(inNode->second));
+        }
+    }
+
+    const auto &outMap = graph.GetOutputNodesMap();
+    for (const auto &out : tiOp->get_function()->get_results()) {
+        const auto prev = out->input_value(0);
+        const auto inputID = ov::op::util::create_ie_output_name(prev);
+        auto outNode = outMap.find(inputID);
+        if (outNode != outMap.end()) {
+            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            outputMems.push_back(outMem);
+            outputInPlace.push_back(canBeInPlace && canWriteInPlace(outNode->second));
+        }
+    }
+}
+
 void TensorIterator::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
@@ -546,7 +673,9 @@ void TensorIterator::prepareParams() {
     prepareInitialCond();
 
     first_mappers.clear();
+    last_mappers.clear();
     before_mappers.clear();
+    after_mappers.clear();
     back_mappers.clear();
 
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
@@ -557,8 +686,11 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // back edges must read the outputs of the previous iteration before
+            // the outputs computed in place are switched to the chunks of the current one
             prepareBackEdges();
+            prepareOutputPorts();
+            prepareBodyReplicas();
         }
 
         // reset local states of DynamicBuffer
@@ -573,6 +705,11 @@ void TensorIterator::execute(dnnl::stream strm) {
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
 
+    if (!replicas.empty() && continue_cond && max_num_iter > 1) {
+        executeInParallel(strm, max_num_iter);
+        return;
+    }
+
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
@@ -629,32 +766,115 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     reshapeAndFillOutput(strm);
 }
 
+bool TensorIterator::hasIndependentIterations() const {
+    // Only the static bodies without back edges are executed in parallel: without back edges an iteration doesn't
+    // depend on the results of the previous ones, and without the condition output all the iterations are executed
+    // anyway. The recurrent bodies (LSTM/GRU cells, seq2seq decoders) pass the state through the back edges, so they
+    // are always executed sequentially.
+    if (isDynamicNode() || !backEdges.empty() || loopBodyConditionOutputIdx != -1)
+        return false;
+    // the replicas share the cached executors with the body, the Interpolate executor keeps its working buffer
+    // between the calls, so it can't be executed by several bodies simultaneously
+    const auto &nodes = sub_graph.GetNodes();
+    return std::none_of(nodes.begin(), nodes.end(), [](const NodePtr &node) {
+        return node->getType() == Type::Interpolate;
+    });
+}
+
+void TensorIterator::executeInParallel(dnnl::stream strm, int num_iter) {
+    const auto &eng = getEngine();
+    const int num_bodies = std::min(static_cast<int>(replicas.size()) + 1, num_iter);
+
+    parallel_nt(num_bodies, [&](const int ithr, const int nthr) {
+        int start = 0, end = 0;
+        splitter(num_iter, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        const bool is_main = ithr == 0;
+        auto &body = is_main ? sub_graph : replicas[ithr - 1]->graph;
+        const auto &first = is_main ? first_mappers : replicas[ithr - 1]->first_mappers;
+        const auto &last = is_main ? last_mappers : replicas[ithr - 1]->last_mappers;
+        const auto &before = is_main ? before_mappers : replicas[ithr - 1]->before_mappers;
+        const auto &after = is_main ? after_mappers : replicas[ithr - 1]->after_mappers;
+        auto body_strm = is_main ? strm : dnnl::stream(eng);
+
+        body.ResetInferCount();
+        for (auto &mapper : first)
+            mapper->execute(body_strm);
+
+        for (int i = start; i < end; i++) {
+            for (auto &mapper : before)
+                mapper->execute(body_strm, i);
+
+            body.Infer();
+
+            for (auto &mapper : after)
+                mapper->execute(body_strm, i);
+        }
+
+        // the body which has executed the last iteration provides the final values
+        if (end == num_iter) {
+            for (auto &mapper : last)
+                mapper->execute(body_strm);
+        }
+    });
+}
+
 /* *==============* Prepare reorders, edges between body and TI *==============* */
 
 void TensorIterator::prepareInputPorts() {
+    createInputMappers(input_mems, input_in_place, first_mappers, before_mappers);
+}
+
+void TensorIterator::prepareOutputPorts() {
+    createOutputMappers(output_mem, output_in_place, last_mappers, before_mappers, after_mappers);
+}
+
+void TensorIterator::createInputMappers(const std::vector<std::vector<MemoryPtr>>& inputMems,
+                                        const std::vector<bool>& inputInPlace,
+                                        std::vector<std::shared_ptr<PortMapHelper>>& first,
+                                        std::vector<std::shared_ptr<PortMapHelper>>& before) {
     const auto &eng = getEngine();
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
+        auto &to_mems = inputMems[map_rule.to];
+        auto &to_mem = to_mems.front();  // first memory is enough to access the shared underlying physical memory
 
         if (map_rule.axis == -1)
-            first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+            first.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (inputInPlace[map_rule.to] && isContiguousSlice(from_mem, to_mem, map_rule))
+            before.emplace_back(std::make_shared<PortViewHelper>(from_mem, to_mems, map_rule));
         else
-            before_mappers.emplace_back(
+            before.emplace_back(
                     std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, true, map_rule, eng));
     }
 }
 
-void TensorIterator::prepareOutputPorts() {
+void TensorIterator::createOutputMappers(const std::vector<MemoryPtr>& outputMems,
+                                         const std::vector<bool>& outputInPlace,
+                                         std::vector<std::shared_ptr<PortMapHelper>>& last,
+                                         std::vector<std::shared_ptr<PortMapHelper>>& before,
+                                         std::vector<std::shared_ptr<PortMapHelper>>& after) {
     const auto &eng = getEngine();
     for (auto map_rule : outputPortMap) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &from_mem = output_mem[map_rule.to];
+        auto &from_mem = outputMems[map_rule.to];
+
+        // the body output may be placed into a single concatenated output only
+        const auto isConcatenatedOnce = [&]() {
+            return std::count_if(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& rule) {
+                return rule.to == map_rule.to && rule.axis != -1;
+            }) == 1;
+        };
 
         if (map_rule.axis == -1)
-            last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+            last.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+        else if (outputInPlace[map_rule.to] && isContiguousSlice(to_mem, from_mem, map_rule) && isConcatenatedOnce())
+            // the body has to write the chunk of current iteration, so the view is set before the iteration
+            before.emplace_back(std::make_shared<PortViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
         else
-            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
+            after.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
 }
 
@@ -725,6 +945,39 @@ void TensorIterator::prepareTripCount() {
     lastUsedTripCount = trip_count_check->getStatus();
 }
 
+void TensorIterator::prepareBodyReplicas() {
+    for (auto &replica : replicas) {
+        replica->first_mappers.clear();
+        replica->last_mappers.clear();
+        replica->before_mappers.clear();
+        replica->after_mappers.clear();
+    }
+
+    if (!hasIndependentIterations())
+        return;
+
+    // every body allocates its own memory, so the number of bodies executed in parallel is limited
+    const int num_bodies = std::min({parallel_get_max_threads(), lastUsedTripCount, maxParallelBodies});
+    auto tiOp = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp);
+    while (static_cast<int>(replicas.size()) + 1 < num_bodies) {
+        auto replica = std::make_shared<BodyReplica>();
+        // the replica has the same shapes and configuration as the body, so its primitives are taken from the shared
+        // cache instead of being compiled again, only the memory and the scratchpad are allocated per replica
+        replica->graph.CreateGraph(tiOp->get_function(), context->cloneWithSharedCache());
+        collectBodyPorts(replica->graph, replica->input_mems, replica->output_mem, replica->input_in_place, replica->output_in_place);
+        replicas.push_back(replica);
+    }
+
+    const auto &eng = getEngine();
+    for (auto &replica : replicas) {
+        createInputMappers(replica->input_mems, replica->input_in_place, replica->first_mappers, replica->before_mappers);
+        for (auto idx : loopBodyCurrentIterationIdx)
+            replica->before_mappers.emplace_back(std::make_shared<IterCountPortHelper>(replica->input_mems[idx].front(), eng));
+        createOutputMappers(replica->output_mem, replica->output_in_place,
+                            replica->last_mappers, replica->before_mappers, replica->after_mappers);
+    }
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 inline SizeVector sliced_input_dims(const MemoryPtr& mem, const int axis, const int stride) {
@@ -101,6 +101,21 @@ private:
     MemoryPtr mem_holder_buffer;
 };
 
+/**
+ * Copy of the body with its own memory, scratchpad and port mappers, the primitives are shared with the body.
+ * Used to execute iterations which don't depend on each other in parallel, i.e. only for the static bodies
+ * without back edges and the condition output, the recurrent bodies are executed sequentially.
+ */
+struct BodyReplica {
+    Graph graph;
+    std::vector<std::vector<MemoryPtr>> input_mems;
+    std::vector<MemoryPtr> output_mem;
+    std::vector<bool> input_in_place;
+    std::vector<bool> output_in_place;
+
+    std::vector<std::shared_ptr<PortMapHelper>> first_mappers, last_mappers, before_mappers, after_mappers;
+};
+
 class TensorIterator : public Node {
 public:
     TensorIterator(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr context);
@@ -132,6 +147,24 @@ private:
     void prepareContinueCond();
     void prepareInitialCond();
     void prepareTripCount();
+    void prepareBodyReplicas();
+
+    void collectBodyPorts(Graph& graph,
+                          std::vector<std::vector<MemoryPtr>>& inputMems,
+                          std::vector<MemoryPtr>& outputMems,
+                          std::vector<bool>& inputInPlace,
+                          std::vector<bool>& outputInPlace) const;
+    void createInputMappers(const std::vector<std::vector<MemoryPtr>>& inputMems,
+                            const std::vector<bool>& inputInPlace,
+                            std::vector<std::shared_ptr<PortMapHelper>>& first,
+                            std::vector<std::shared_ptr<PortMapHelper>>& before);
+    void createOutputMappers(const std::vector<MemoryPtr>& outputMems,
+                             const std::vector<bool>& outputInPlace,
+                             std::vector<std::shared_ptr<PortMapHelper>>& last,
+                             std::vector<std::shared_ptr<PortMapHelper>>& before,
+                             std::vector<std::shared_ptr<PortMapHelper>>& after);
+    bool hasIndependentIterations() const;
+    void executeInParallel(dnnl::stream strm, int num_iter);
 
     /* Dynamic support */
     void reshapeSubgraphInput();
@@ -143,6 +176,8 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<bool> input_in_place;   /// < Body input may be pointed directly into the sliced input of the node
+    std::vector<bool> output_in_place;  /// < Body output may be computed directly into the concatenated output of the node
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -158,6 +193,8 @@ private:
 
     std::vector<std::shared_ptr<DynamicBuffer>> buffers;
 
+    std::vector<std::shared_ptr<BodyReplica>> replicas;  /// < Additional bodies to run independent iterations in parallel
+
     std::vector<PortMap> inputPortMap;  //!< Input ports map
     std::vector<PortMap> outputPortMap;  //!< Output ports map
     std::vector<PortMap> backEdges;  //!< Back edges map
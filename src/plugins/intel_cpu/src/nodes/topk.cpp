@@ -18,6 +18,7 @@
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
 #include "common/cpu_memcpy.h"
+#include "memory_desc/dnnl_blocked_memory_desc.h"
 
 #include <ngraph/opsets/opset1.hpp>
 
@@ -2051,7 +2052,23 @@ void TopK::prepareParams() {
             }
         }
 
-        prepare_original_idx();
+        // [case 5]: for a big axis and top_k the cost of the sorting algorithms above grows with top_k,
+        //           while radix select scans the data a constant number of times and then sorts top_k elements only.
+        //           It is applied for planar layouts with 32-bit data if topk is imposed on innermost dimension.
+        auto data_prc = getSelectedPrimitiveDescriptor()->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
+        radix_select = context->getConfig().enableTopKRadixSelect &&
+                       (layout == TopKLayoutType::topk_ncsp || layout == TopKLayoutType::topk_nspc) && I == 1 &&
+                       (data_prc == Precision::FP32 || data_prc == Precision::I32) &&
+                       axis_dim >= radix_select_min_axis_dim && static_cast<size_t>(top_k) >= radix_select_min_top_k;
+        radix_conf = {data_prc == Precision::FP32, mode_max, sort_index};
+
+        if (radix_select) {
+            const size_t scratch_size = InferenceEngine::Extensions::Cpu::topk_radix_scratch_size(
+                O, axis_dim, top_k, parallel_get_max_threads());
+            radix_scratch = getScratchPadMem(std::make_shared<DnnlBlockedMemoryDesc>(Precision::U8, Shape{scratch_size}));
+        } else {
+            prepare_original_idx();
+        }
     } else { //reference mode
         int j;
         for (j = src_dims.size() - 1; j >= 0; j--) {
@@ -2145,7 +2162,10 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetPtr());
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->GetPtr());
 
-    if (jit_mode) {
+    if (jit_mode && radix_select) {
+        InferenceEngine::Extensions::Cpu::XARCH::topk_radix_select(src_data, dst_data, reinterpret_cast<int32_t *>(dst_idx),
+                                                                  O, axis_dim, top_k, radix_conf, radix_scratch->GetData());
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -10,6 +10,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "topk_radix_select.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -131,6 +132,12 @@ private:
     bool bubble_inplace = false;
     bool preset_params_done = false;
 
+    bool radix_select = false;
+    InferenceEngine::Extensions::Cpu::topk_radix_conf radix_conf = {};
+    MemoryPtr radix_scratch;
+    static constexpr size_t radix_select_min_axis_dim = 4096;
+    static constexpr size_t radix_select_min_top_k = 16;
+
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
     TopKAlgorithm algorithm = TopKAlgorithm::topk_bubble_sort;
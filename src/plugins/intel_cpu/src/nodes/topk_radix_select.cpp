@@ -0,0 +1,310 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_radix_select.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cstring>
+#include <numeric>
+#if defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+namespace {
+
+constexpr size_t digit_bits = 8;
+constexpr size_t digit_num = 1 << digit_bits;
+static_assert(digit_num == topk_radix_digit_num, "the histogram size doesn't match the digit size");
+
+using segment = topk_radix_segment;
+
+// Places the segment at the beginning of its scratch and returns the end of its buffers
+uint8_t* init_segment(uint8_t* scratch, size_t chunk_size, size_t top_k, segment*& seg) {
+    seg = reinterpret_cast<segment*>(scratch);
+    auto data = reinterpret_cast<uint32_t*>(scratch + sizeof(segment));
+    seg->keys = data;
+    seg->idx = reinterpret_cast<int32_t*>(data + chunk_size);
+    seg->sel_keys = data + 2 * chunk_size;
+    seg->sel_idx = reinterpret_cast<int32_t*>(data + 2 * chunk_size + top_k);
+    seg->size = 0;
+    seg->sel = 0;
+    return scratch + topk_radix_segment_scratch_size(chunk_size, top_k);
+}
+
+// The selected keys, their indices and the order of the output
+struct top_buffers {
+    uint32_t* keys;
+    int32_t* idx;
+    uint32_t* order;
+
+    top_buffers(uint8_t* scratch, size_t top_k)
+        : keys(reinterpret_cast<uint32_t*>(scratch)),
+          idx(reinterpret_cast<int32_t*>(scratch) + top_k),
+          order(reinterpret_cast<uint32_t*>(scratch) + 2 * top_k) {}
+};
+
+// Maps the data to unsigned keys, so that a bigger key means a better element for any mode
+struct key_mapper {
+    explicit key_mapper(const topk_radix_conf& conf)
+        : is_float(conf.is_float), invert(conf.mode_max ? 0u : 0xFFFFFFFFu) {}
+
+    inline uint32_t operator()(uint32_t bits) const {
+        // float: negative values are inverted, positive ones get the sign bit set; int: the sign bit is flipped
+        const uint32_t flip = is_float ? (static_cast<uint32_t>(static_cast<int32_t>(bits) >> 31) | 0x80000000u) : 0x80000000u;
+        return bits ^ flip ^ invert;
+    }
+
+    bool is_float;
+    uint32_t invert;
+};
+
+// Finds the digit of the element with rank 'need' and updates 'need' to the rank within the digit bucket
+inline uint32_t pick_digit(const size_t* hist, size_t& need) {
+    size_t above = 0;
+    for (size_t d = digit_num - 1; d > 0; d--) {
+        if (above + hist[d] >= need) {
+            need -= above;
+            return static_cast<uint32_t>(d);
+        }
+        above += hist[d];
+    }
+    need -= above;
+    return 0;
+}
+
+#if defined(HAVE_AVX512F)
+inline size_t mask_count(__mmask16 mask) {
+    return std::bitset<16>(mask).count();
+}
+#endif
+
+// The first pass over the row: the elements with the top digit above 'digit' are selected,
+// the ones equal to it become candidates
+void partition_row(const uint32_t* src, size_t start, size_t end, const key_mapper& to_key, uint32_t digit, segment& seg) {
+    const size_t shift = 32 - digit_bits;
+    size_t i = start;
+    seg.size = 0;
+    seg.sel = 0;
+#if defined(HAVE_AVX512F)
+    const __m512i vinvert = _mm512_set1_epi32(static_cast<int>(to_key.invert));
+    const __m512i vsign = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+    const __m512i vdigit = _mm512_set1_epi32(static_cast<int>(digit));
+    const __m512i vstep = _mm512_set1_epi32(16);
+    __m512i vidx = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(start)),
+                                    _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+    for (; i + 16 <= end; i += 16) {
+        const __m512i vbits = _mm512_loadu_si512(src + i);
+        const __m512i vflip = to_key.is_float ? _mm512_or_si512(_mm512_srai_epi32(vbits, 31), vsign) : vsign;
+        const __m512i vkey = _mm512_xor_si512(_mm512_xor_si512(vbits, vflip), vinvert);
+        const __m512i vkey_digit = _mm512_srli_epi32(vkey, shift);
+        const __mmask16 gt = _mm512_cmpgt_epu32_mask(vkey_digit, vdigit);
+        const __mmask16 eq = _mm512_cmpeq_epi32_mask(vkey_digit, vdigit);
+        _mm512_mask_compressstoreu_epi32(seg.sel_keys + seg.sel, gt, vkey);
+        _mm512_mask_compressstoreu_epi32(seg.sel_idx + seg.sel, gt, vidx);
+        seg.sel += mask_count(gt);
+        _mm512_mask_compressstoreu_epi32(seg.keys + seg.size, eq, vkey);
+        _mm512_mask_compressstoreu_epi32(seg.idx + seg.size, eq, vidx);
+        seg.size += mask_count(eq);
+        vidx = _mm512_add_epi32(vidx, vstep);
+    }
+#endif
+    for (; i < end; i++) {
+        const uint32_t key = to_key(src[i]);
+        const uint32_t key_digit = key >> shift;
+        if (key_digit > digit) {
+            seg.sel_keys[seg.sel] = key;
+            seg.sel_idx[seg.sel++] = static_cast<int32_t>(i);
+        } else if (key_digit == digit) {
+            seg.keys[seg.size] = key;
+            seg.idx[seg.size++] = static_cast<int32_t>(i);
+        }
+    }
+}
+
+// The next passes over the candidates, which are compacted in place
+void partition_candidates(segment& seg, size_t shift, uint32_t digit) {
+    size_t i = 0, kept = 0;
+#if defined(HAVE_AVX512F)
+    const __m512i vdigit = _mm512_set1_epi32(static_cast<int>(digit));
+    const __m512i vdigit_mask = _mm512_set1_epi32(static_cast<int>(digit_num - 1));
+    const __m128i vshift = _mm_cvtsi32_si128(static_cast<int>(shift));
+    for (; i + 16 <= seg.size; i += 16) {
+        const __m512i vkey = _mm512_loadu_si512(seg.keys + i);
+        const __m512i vidx = _mm512_loadu_si512(seg.idx + i);
+        const __m512i vkey_digit = _mm512_and_si512(_mm512_srl_epi32(vkey, vshift), vdigit_mask);
+        const __mmask16 gt = _mm512_cmpgt_epu32_mask(vkey_digit, vdigit);
+        const __mmask16 eq = _mm512_cmpeq_epi32_mask(vkey_digit, vdigit);
+        _mm512_mask_compressstoreu_epi32(seg.sel_keys + seg.sel, gt, vkey);
+        _mm512_mask_compressstoreu_epi32(seg.sel_idx + seg.sel, gt, vidx);
+        seg.sel += mask_count(gt);
+        // kept <= i, so the store doesn't reach the elements which are not loaded yet
+        _mm512_mask_compressstoreu_epi32(seg.keys + kept, eq, vkey);
+        _mm512_mask_compressstoreu_epi32(seg.idx + kept, eq, vidx);
+        kept += mask_count(eq);
+    }
+#endif
+    for (; i < seg.size; i++) {
+        const uint32_t key = seg.keys[i];
+        const uint32_t key_digit = (key >> shift) & (digit_num - 1);
+        if (key_digit > digit) {
+            seg.sel_keys[seg.sel] = key;
+            seg.sel_idx[seg.sel++] = seg.idx[i];
+        } else if (key_digit == digit) {
+            seg.keys[kept] = key;
+            seg.idx[kept++] = seg.idx[i];
+        }
+    }
+    seg.size = kept;
+}
+
+template <typename F>
+inline void for_segments(size_t segments_num, const F& func) {
+    if (segments_num == 1) {
+        func(0);
+    } else {
+        parallel_for(segments_num, func);
+    }
+}
+
+void select_row(const uint32_t* src, uint32_t* dst, int32_t* dst_idx, size_t axis_dim, size_t top_k,
+                const topk_radix_conf& conf, segment* const* segs, size_t segments_num, const top_buffers& top) {
+    const key_mapper to_key(conf);
+    size_t total[digit_num];
+
+    auto reduce_hist = [&]() {
+        std::fill(std::begin(total), std::end(total), 0);
+        for (size_t s = 0; s < segments_num; s++)
+            for (size_t d = 0; d < digit_num; d++)
+                total[d] += segs[s]->hist[d];
+    };
+
+    // the top digit is taken directly from the data
+    const size_t top_shift = 32 - digit_bits;
+    for_segments(segments_num, [&](size_t s) {
+        size_t start = 0, end = 0;
+        splitter(axis_dim, segments_num, s, start, end);
+        auto& seg = *segs[s];
+        std::fill(std::begin(seg.hist), std::end(seg.hist), 0);
+        for (size_t i = start; i < end; i++)
+            seg.hist[to_key(src[i]) >> top_shift]++;
+    });
+    reduce_hist();
+
+    size_t need = top_k;
+    uint32_t digit = pick_digit(total, need);
+    bool done = total[digit] == need;
+    for_segments(segments_num, [&](size_t s) {
+        size_t start = 0, end = 0;
+        splitter(axis_dim, segments_num, s, start, end);
+        partition_row(src, start, end, to_key, digit, *segs[s]);
+    });
+
+    // the lower digits are refined on the candidates only
+    for (size_t shift = top_shift - digit_bits; !done; shift -= digit_bits) {
+        for_segments(segments_num, [&](size_t s) {
+            auto& seg = *segs[s];
+            std::fill(std::begin(seg.hist), std::end(seg.hist), 0);
+            for (size_t i = 0; i < seg.size; i++)
+                seg.hist[(seg.keys[i] >> shift) & (digit_num - 1)]++;
+        });
+        reduce_hist();
+
+        digit = pick_digit(total, need);
+        done = total[digit] == need || shift == 0;
+        for_segments(segments_num, [&](size_t s) {
+            partition_candidates(*segs[s], shift, digit);
+        });
+    }
+
+    // the selected elements and the first 'need' candidates, which are equal, in the order of indices
+    size_t count = 0;
+    for (size_t s = 0; s < segments_num; s++) {
+        const auto& seg = *segs[s];
+        std::copy(seg.sel_keys, seg.sel_keys + seg.sel, top.keys + count);
+        std::copy(seg.sel_idx, seg.sel_idx + seg.sel, top.idx + count);
+        count += seg.sel;
+    }
+    for (size_t s = 0; s < segments_num; s++) {
+        const auto& seg = *segs[s];
+        const size_t taken = std::min(need, seg.size);
+        std::copy(seg.keys, seg.keys + taken, top.keys + count);
+        std::copy(seg.idx, seg.idx + taken, top.idx + count);
+        count += taken;
+        need -= taken;
+    }
+
+    const auto top_keys = top.keys;
+    const auto top_idx = top.idx;
+    std::iota(top.order, top.order + top_k, 0);
+    if (conf.sort_index) {
+        std::sort(top.order, top.order + top_k, [&](uint32_t a, uint32_t b) {
+            return top_idx[a] < top_idx[b];
+        });
+    } else {
+        std::sort(top.order, top.order + top_k, [&](uint32_t a, uint32_t b) {
+            return top_keys[a] > top_keys[b] || (top_keys[a] == top_keys[b] && top_idx[a] < top_idx[b]);
+        });
+    }
+    for (size_t j = 0; j < top_k; j++) {
+        const auto idx = top_idx[top.order[j]];
+        dst[j] = src[idx];
+        dst_idx[j] = idx;
+    }
+}
+
+}  // namespace
+
+void topk_radix_select(const void* src, void* dst, int32_t* dst_idx,
+        size_t rows, size_t axis_dim, size_t top_k, const topk_radix_conf& conf, void* scratch) {
+    if (top_k == 0 || rows == 0)
+        return;
+
+    auto src_data = static_cast<const uint32_t*>(src);
+    auto dst_data = static_cast<uint32_t*>(dst);
+    auto scratch_data = static_cast<uint8_t*>(scratch);
+    const size_t threads_num = static_cast<size_t>(parallel_get_max_threads());
+    const size_t segments_num = topk_radix_segments_num(rows, axis_dim, threads_num);
+
+    if (segments_num == 1) {
+        // enough rows to load all the threads, each of them takes its own segment and top buffers
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(rows, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+            auto thread_scratch = scratch_data + ithr * (topk_radix_segment_scratch_size(axis_dim, top_k) +
+                                                         topk_radix_top_scratch_size(top_k));
+            segment* seg = nullptr;
+            const top_buffers top(init_segment(thread_scratch, axis_dim, top_k, seg), top_k);
+            for (size_t r = start; r < end; r++) {
+                select_row(src_data + r * axis_dim, dst_data + r * top_k, dst_idx + r * top_k, axis_dim, top_k,
+                           conf, &seg, 1, top);
+            }
+        });
+    } else {
+        // each row is split between the threads, the segments are placed one after another
+        segment* segs[topk_radix_max_segments];
+        const size_t chunk_size = (axis_dim + segments_num - 1) / segments_num;
+        auto ptr = scratch_data;
+        for (size_t s = 0; s < segments_num; s++)
+            ptr = init_segment(ptr, chunk_size, top_k, segs[s]);
+        const top_buffers top(ptr, top_k);
+        for (size_t r = 0; r < rows; r++) {
+            select_row(src_data + r * axis_dim, dst_data + r * top_k, dst_idx + r * top_k, axis_dim, top_k,
+                       conf, segs, segments_num, top);
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
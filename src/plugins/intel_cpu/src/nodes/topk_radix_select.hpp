@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct topk_radix_conf {
+    bool is_float;    // f32 or i32 data
+    bool mode_max;
+    bool sort_index;  // sort the output by index, otherwise by value
+};
+
+constexpr size_t topk_radix_digit_num = 256;
+// a single row is split between the threads only if each of them gets at least that many elements
+constexpr size_t topk_radix_min_chunk_size = 4096;
+constexpr size_t topk_radix_max_segments = 256;
+
+// The part of the row processed by a single thread. It's placed in the scratch and followed by its buffers:
+// the elements which are known to be in top_k are moved to sel_*, the ones which still can be in top_k
+// are kept in keys/idx in the order of indices.
+struct topk_radix_segment {
+    uint32_t* keys;
+    int32_t* idx;
+    size_t size;
+    uint32_t* sel_keys;
+    int32_t* sel_idx;
+    size_t sel;
+    size_t hist[topk_radix_digit_num];
+};
+
+// The number of the parts each row is split into, the rows are split only if there are fewer of them than threads
+inline size_t topk_radix_segments_num(size_t rows, size_t axis_dim, size_t threads_num) {
+    if (rows >= threads_num)
+        return 1;
+    return std::max(size_t(1), std::min({threads_num, axis_dim / topk_radix_min_chunk_size, topk_radix_max_segments}));
+}
+
+inline size_t topk_radix_segment_scratch_size(size_t chunk_size, size_t top_k) {
+    return sizeof(topk_radix_segment) + 2 * (chunk_size + top_k) * sizeof(uint32_t);
+}
+
+// the selected keys, their indices and the order in which they are written, the next segment is kept aligned
+inline size_t topk_radix_top_scratch_size(size_t top_k) {
+    return (3 * top_k * sizeof(uint32_t) + sizeof(size_t) - 1) / sizeof(size_t) * sizeof(size_t);
+}
+
+/**
+ * The size of the scratch topk_radix_select() needs, it depends on the shapes only, so it's allocated in advance.
+ * Each thread takes a segment and the top buffers, or each of the segments of a split row takes a thread.
+ */
+inline size_t topk_radix_scratch_size(size_t rows, size_t axis_dim, size_t top_k, size_t threads_num) {
+    const size_t segments_num = topk_radix_segments_num(rows, axis_dim, threads_num);
+    if (segments_num == 1)
+        return threads_num * (topk_radix_segment_scratch_size(axis_dim, top_k) + topk_radix_top_scratch_size(top_k));
+    const size_t chunk_size = (axis_dim + segments_num - 1) / segments_num;
+    return segments_num * topk_radix_segment_scratch_size(chunk_size, top_k) + topk_radix_top_scratch_size(top_k);
+}
+
+namespace XARCH {
+
+/**
+ * Selects top_k of each of the rows of 32-bit data with the radix select, so the cost doesn't depend on top_k.
+ * The rows are dense (the sorted axis is innermost), if there are fewer rows than threads, each row is split
+ * between the threads. Equal values are taken in the order of indices, i.e. the selection is stable.
+ * The scratch must be at least topk_radix_scratch_size() bytes for the maximal number of threads.
+ */
+void topk_radix_select(const void* src, void* dst, int32_t* dst_idx,
+        size_t rows, size_t axis_dim, size_t top_k, const topk_radix_conf& conf, void* scratch);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
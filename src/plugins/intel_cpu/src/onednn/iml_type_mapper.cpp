@@ -75,6 +75,8 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(gemm_avx);
     CASE(gemm_sse42);
     CASE(jit_gemm);
+    CASE(gemm_sparse_avx512);
+    CASE(gemm_sparse_avx2);
     CASE(jit_avx512_winograd);
     CASE(jit_avx512);
     CASE(jit_avx2);
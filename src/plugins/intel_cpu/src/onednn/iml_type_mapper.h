@@ -49,6 +49,8 @@ enum impl_desc_type {
     gemm_avx            = gemm | avx,
     gemm_sse42          = gemm | sse42,
     jit_gemm            = jit | gemm,
+    gemm_sparse_avx512  = gemm | sparse | avx512,
+    gemm_sparse_avx2    = gemm | sparse | avx2,
 
     jit_avx512_winograd = jit  | avx512 | winograd,
     jit_avx512          = jit  | avx512,
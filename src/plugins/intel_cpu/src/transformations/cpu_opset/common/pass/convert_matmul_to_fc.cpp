@@ -8,13 +8,82 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 #include "itt.hpp"
 
+namespace {
+// Convert -> [Subtract] -> Multiply -> [Reshape] chain over compressed weights kept by MarkMatMulWeightsDecompression,
+// the chain is fused into the FullyConnected node by the graph optimizer
+bool is_decompressed_weights(const std::shared_ptr<ngraph::Node>& node) {
+    auto n = node;
+    if (ngraph::is_type<ngraph::opset1::Reshape>(n)) {
+        if (!ngraph::op::is_constant(n->get_input_node_ptr(1)))
+            return false;
+        n = n->get_input_node_shared_ptr(0);
+    }
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(n) || !ngraph::op::is_constant(n->get_input_node_ptr(1)))
+        return false;
+    n = n->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(n)) {
+        if (!ngraph::op::is_constant(n->get_input_node_ptr(1)))
+            return false;
+        n = n->get_input_node_shared_ptr(0);
+    }
+    return ngraph::is_type<ngraph::opset1::Convert>(n) && ngraph::op::is_constant(n->get_input_node_ptr(0)) &&
+           ov::pass::constant_folding_is_disabled(n);
+}
+
+// Transposes decompressed rank 2 weights by transposing the constants of the decompression chain,
+// so the weights stay compressed. Returns an empty output if the chain can't be transposed this way.
+ngraph::Output<ngraph::Node> transpose_decompressed_weights(const ngraph::Output<ngraph::Node>& weights, ngraph::NodeVector& new_ops) {
+    const auto multiply = weights.get_node_shared_ptr();
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(multiply) || multiply->get_output_partial_shape(0).size() != 2)
+        return {};
+    auto subtract = std::dynamic_pointer_cast<ngraph::opset1::Subtract>(multiply->get_input_node_shared_ptr(0));
+    auto convert = subtract ? subtract->get_input_node_shared_ptr(0) : multiply->get_input_node_shared_ptr(0);
+    if (convert->get_input_partial_shape(0).size() != 2)
+        return {};
+
+    // broadcasting commutes with transposition once the constant has the rank of the weights
+    auto transpose_constant = [&](const ngraph::Output<ngraph::Node>& input) -> std::shared_ptr<ngraph::Node> {
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(input.get_node_shared_ptr());
+        auto shape = constant->get_shape();
+        if (shape.size() > 2)
+            return nullptr;
+        shape.insert(shape.begin(), 2 - shape.size(), 1);
+        const auto reshaped = std::make_shared<ngraph::opset1::Constant>(*constant, shape);
+        const auto order = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{2}, {1, 0});
+        return ov::op::util::make_try_fold<ngraph::opset1::Transpose>(reshaped, order);
+    };
+
+    const auto weights_const = transpose_constant(convert->input_value(0));
+    const auto scales_const = transpose_constant(multiply->input_value(1));
+    const auto zero_points_const = subtract ? transpose_constant(subtract->input_value(1)) : nullptr;
+    if (!weights_const || !scales_const || (subtract && !zero_points_const))
+        return {};
+
+    std::shared_ptr<ngraph::Node> new_convert = convert->clone_with_new_inputs({weights_const});
+    ov::disable_constant_folding(new_convert);
+    new_convert->set_friendly_name(convert->get_friendly_name());
+    new_ops.insert(new_ops.end(), {weights_const, new_convert});
+    std::shared_ptr<ngraph::Node> dequantized = new_convert;
+    if (subtract) {
+        dequantized = subtract->clone_with_new_inputs({new_convert, zero_points_const});
+        dequantized->set_friendly_name(subtract->get_friendly_name());
+        new_ops.insert(new_ops.end(), {zero_points_const, dequantized});
+    }
+    const auto new_multiply = multiply->clone_with_new_inputs({dequantized, scales_const});
+    new_multiply->set_friendly_name(multiply->get_friendly_name() + "/transposed");
+    new_ops.insert(new_ops.end(), {scales_const, new_multiply});
+    return new_multiply;
+}
+}  // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Multiply, ngraph::opset1::Reshape>();
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -29,6 +98,10 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
         auto fc_input_b = pattern_map.at(weights_m);
+        const bool compressed_weights = !ngraph::op::is_constant(fc_input_b.get_node_shared_ptr());
+        if (compressed_weights && !is_decompressed_weights(fc_input_b.get_node_shared_ptr())) {
+            return false;
+        }
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
@@ -45,8 +118,7 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -127,7 +199,13 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+            ngraph::Output<ngraph::Node> transposed;
+            if (compressed_weights)
+                transposed = transpose_decompressed_weights(fc_input_b, new_ops);
+            if (transposed.get_node())
+                fc_input_b = transposed;
+            else
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
         }
 
         if (rank_b != 2) {
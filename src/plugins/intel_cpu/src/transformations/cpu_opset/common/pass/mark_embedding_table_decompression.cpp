@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_embedding_table_decompression.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <openvino/pass/pattern/op/or.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "transformations/itt.hpp"
+
+using namespace ov::pass::pattern;
+ov::intel_cpu::MarkEmbeddingTableDecompression::MarkEmbeddingTableDecompression() {
+    MATCHER_SCOPE(MarkEmbeddingTableDecompression);
+    auto table_m = wrap_type<ov::opset1::Constant>(type_matches_any({ov::element::i8, ov::element::u8}));
+    auto convert_m = wrap_type<ov::opset1::Convert>({table_m}, consumers_count(1));
+    auto zero_points_m = wrap_type<ov::opset1::Constant>();
+    auto subtract_m = wrap_type<ov::opset1::Subtract>({convert_m, zero_points_m}, consumers_count(1));
+    auto scales_m = wrap_type<ov::opset1::Constant>();
+    auto dequantized_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{convert_m, subtract_m});
+    auto multiply_m = wrap_type<ov::opset1::Multiply>({dequantized_m, scales_m}, consumers_count(1));
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto consumer = m.get_match_root()->output(0).get_target_inputs().begin();
+        const auto emb_bag = consumer->get_node();
+        if (consumer->get_index() != 0 ||
+            !(ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(emb_bag) ||
+              ov::is_type<ov::opset3::EmbeddingBagPackedSum>(emb_bag) ||
+              ov::is_type<ov::opset3::EmbeddingSegmentsSum>(emb_bag)))
+            return false;
+
+        const auto& table_shape = pattern_map.at(table_m).get_shape();
+        if (table_shape.empty())
+            return false;
+
+        // one value per table row or a single value for the whole table
+        auto is_per_row = [&](const ov::Output<ov::Node>& constant) {
+            const auto& shape = constant.get_shape();
+            if (shape.size() > table_shape.size() || constant.get_element_type() != ov::element::f32)
+                return false;
+            const size_t rank_diff = table_shape.size() - shape.size();
+            for (size_t i = 0; i < shape.size(); i++) {
+                const bool row_axis = i + rank_diff == 0;
+                if (shape[i] != 1 && !(row_axis && shape[i] == table_shape[0]))
+                    return false;
+            }
+            return true;
+        };
+        if (!is_per_row(pattern_map.at(scales_m)))
+            return false;
+        if (pattern_map.count(zero_points_m) && !is_per_row(pattern_map.at(zero_points_m)))
+            return false;
+
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        if (convert->get_output_element_type(0) != ov::element::f32 || ov::pass::constant_folding_is_disabled(convert))
+            return false;
+        ov::disable_constant_folding(convert);
+        return false;
+    };
+
+    auto m = std::make_shared<Matcher>(multiply_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Keeps per-row dequantization of a quantized embedding table from being constant folded,
+ *     so the CPU plugin can read the table in int8/uint8 and dequantize rows on the fly in EmbeddingBag nodes.
+ *
+ *     Constant(i8/u8) -> Convert(f32) -> [Subtract(zero points)] -> Multiply(scales) -> EmbeddingBag*(table input)
+ *
+ *     Scales and zero points must be constants with one value per table row (or a single value).
+ */
+class MarkEmbeddingTableDecompression: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkEmbeddingTableDecompression", "0");
+    MarkEmbeddingTableDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
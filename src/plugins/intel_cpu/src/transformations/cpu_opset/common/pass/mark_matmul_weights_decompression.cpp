@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_matmul_weights_decompression.hpp"
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+#include <openvino/pass/pattern/op/or.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "transformations/itt.hpp"
+#include "utils/general_utils.h"
+
+using namespace ov::pass::pattern;
+ov::intel_cpu::MarkMatMulWeightsDecompression::MarkMatMulWeightsDecompression() {
+    MATCHER_SCOPE(MarkMatMulWeightsDecompression);
+    auto weights_m = wrap_type<ov::opset1::Constant>(
+        type_matches_any({ov::element::i8, ov::element::u8, ov::element::i4, ov::element::u4}));
+    auto convert_m = wrap_type<ov::opset1::Convert>({weights_m}, consumers_count(1));
+    auto zero_points_m = wrap_type<ov::opset1::Constant>();
+    auto subtract_m = wrap_type<ov::opset1::Subtract>({convert_m, zero_points_m}, consumers_count(1));
+    auto scales_m = wrap_type<ov::opset1::Constant>();
+    auto dequantized_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{convert_m, subtract_m});
+    auto multiply_m = wrap_type<ov::opset1::Multiply>({dequantized_m, scales_m}, consumers_count(1));
+    auto reshape_pattern_m = wrap_type<ov::opset1::Constant>();
+    auto reshape_m = wrap_type<ov::opset1::Reshape>({multiply_m, reshape_pattern_m}, consumers_count(1));
+    auto decompressed_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{multiply_m, reshape_m});
+    auto activations_m = any_input(has_static_rank());
+    auto matmul_m = wrap_type<ov::opset1::MatMul>({activations_m, decompressed_m});
+
+    ov::matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = std::dynamic_pointer_cast<ov::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        if (!matmul || matmul->get_output_element_type(0) != ov::element::f32)
+            return false;
+
+        const auto activations_rank = pattern_map.at(activations_m).get_partial_shape().size();
+        const auto& matmul_weights_shape = matmul->get_input_partial_shape(1);
+        if (!one_of(activations_rank, 2u, 3u) || matmul_weights_shape.is_dynamic() || matmul_weights_shape.size() != 2)
+            return false;
+
+        // per output channel and, for grouped decompression, per group values
+        const auto& weights_shape = pattern_map.at(weights_m).get_shape();
+        const bool grouped = pattern_map.count(reshape_m);
+        size_t channels = 0, groups = 1;
+        size_t channel_axis = 0;
+        if (grouped) {
+            if (weights_shape.size() != 3 || !matmul->get_transpose_b() ||
+                matmul_weights_shape.to_shape() != ov::Shape{weights_shape[0], weights_shape[1] * weights_shape[2]})
+                return false;
+            channels = weights_shape[0];
+            groups = weights_shape[1];
+        } else {
+            if (weights_shape.size() != 2)
+                return false;
+            channel_axis = matmul->get_transpose_b() ? 0 : 1;
+            channels = weights_shape[channel_axis];
+        }
+
+        auto is_per_channel = [&](const ov::Output<ov::Node>& constant) {
+            const auto& shape = constant.get_shape();
+            if (shape.size() > weights_shape.size() || constant.get_element_type() != ov::element::f32)
+                return false;
+            const size_t rank_diff = weights_shape.size() - shape.size();
+            for (size_t i = 0; i < shape.size(); i++) {
+                const size_t axis = i + rank_diff;
+                if (shape[i] != 1 && !(axis == channel_axis && shape[i] == channels) &&
+                    !(grouped && axis == 1 && shape[i] == groups))
+                    return false;
+            }
+            return true;
+        };
+        if (!is_per_channel(pattern_map.at(scales_m)))
+            return false;
+        if (pattern_map.count(zero_points_m) && !is_per_channel(pattern_map.at(zero_points_m)))
+            return false;
+
+        const auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+        if (convert->get_output_element_type(0) != ov::element::f32 || ov::pass::constant_folding_is_disabled(convert))
+            return false;
+        // the plugin checks that the MatMul will fuse the decompression
+        if (transformation_callback(matmul))
+            return false;
+        ov::disable_constant_folding(convert);
+        return false;
+    };
+
+    auto m = std::make_shared<Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
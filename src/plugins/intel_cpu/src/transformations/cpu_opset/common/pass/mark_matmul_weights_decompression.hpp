@@ -0,0 +1,33 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/*
+ * Description:
+ *     Keeps weights decompression of a MatMul with compressed weights from being constant folded,
+ *     so the CPU plugin can keep the weights in int8/int4 and decompress them on the fly in FullyConnected nodes.
+ *
+ *     Constant(i8/u8/i4/u4) -> Convert(f32) -> [Subtract(zero points)] -> Multiply(scales) -> MatMul(weights input)
+ *
+ *     Scales and zero points must be constants with one value per output channel (or a single value).
+ *     Grouped decompression is matched as well when the weights are transposed:
+ *
+ *     Constant[N, G, S] -> Convert -> [Subtract[N, G, 1]] -> Multiply[N, G, 1] -> Reshape[N, G * S] -> MatMul(transpose_b)
+ *
+ *     The transformation callback is called for the MatMul and the decompression is left to be folded if it returns true.
+ */
+class MarkMatMulWeightsDecompression: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkMatMulWeightsDecompression", "0");
+    MarkMatMulWeightsDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -33,6 +33,17 @@ namespace {
                ov::is_type<ngraph::op::v8::Gather>(node);
     }
 
+    bool is_reshape_operation(const std::shared_ptr<ngraph::Node>& node) {
+        return ov::is_type<ngraph::op::v0::Squeeze>(node) ||
+               ov::is_type<ngraph::op::v0::Unsqueeze>(node) ||
+               ov::is_type<ngraph::op::v1::Reshape>(node);
+    }
+
+    bool is_eltwise_operation(const std::shared_ptr<ngraph::Node>& node) {
+        return ov::is_type<ngraph::op::util::UnaryElementwiseArithmetic>(node) ||
+               ov::is_type<ngraph::op::util::BinaryElementwiseArithmetic>(node);
+    }
+
     bool is_scalar_like(const std::shared_ptr<ngraph::Node>& node) {
         auto constantNode = std::dynamic_pointer_cast<ngraph::opset8::Constant>(node);
         return constantNode != nullptr && shape_size(constantNode->get_shape()) == 1;
@@ -60,16 +71,20 @@ ov::intel_cpu::MoveEltwiseUpThroughDataMov::MoveEltwiseUpThroughDataMov() {
         }
 
         bool is_binary_op = std::dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(eltwise) != nullptr;
-        if (is_binary_op && !is_scalar_like(eltwise->get_input_node_shared_ptr(1))) {
+        // A binary eltwise with a second input of the output shape (e.g. a residual Add after a Reshape) is moved
+        // only through the shape changing operations, along with a Reshape of the second input. It is done only
+        // when the eltwise is moved right after another eltwise, so both are executed as one fused Eltwise node.
+        const bool reshape_second_input = is_binary_op && !is_scalar_like(eltwise->get_input_node_shared_ptr(1));
+        if (reshape_second_input &&
+            (eltwise->get_output_partial_shape(0).is_dynamic() ||
+             eltwise->get_input_partial_shape(1) != eltwise->get_output_partial_shape(0))) {
             return false;
         }
 
-
-
         auto current = eltwise->get_input_node_shared_ptr(0);
         auto child = eltwise;
 
-        while (is_data_movement_operation(current)) {
+        while (reshape_second_input ? is_reshape_operation(current) : is_data_movement_operation(current)) {
             if (current->get_output_size() != 1 ||
                 current->get_output_target_inputs(0).size() != 1 ||
                 current->get_output_element_type(0) != current->get_input_element_type(0)) {
@@ -85,8 +100,15 @@ ov::intel_cpu::MoveEltwiseUpThroughDataMov::MoveEltwiseUpThroughDataMov() {
             return false;
         }
 
-        // eltwise constant shape should match new input shape
-        if (is_binary_op && current->get_output_partial_shape(0).rank().get_length() != eltwise->get_input_partial_shape(1).rank().get_length()) {
+        if (reshape_second_input &&
+            (!is_eltwise_operation(current) || current->get_output_partial_shape(0).is_dynamic() ||
+             current->get_output_element_type(0) != eltwise->get_input_element_type(1))) {
+            return false;
+        }
+
+        // eltwise constant shape should match new input shape, the full shape second input is reshaped below
+        if (is_binary_op && !reshape_second_input &&
+            current->get_output_partial_shape(0).rank().get_length() != eltwise->get_input_partial_shape(1).rank().get_length()) {
             auto old_eltwise_const = std::dynamic_pointer_cast<ngraph::opset8::Constant>(eltwise->get_input_node_shared_ptr(1));
             auto new_constant = std::make_shared<ngraph::opset8::Constant>(*old_eltwise_const.get(), ngraph::Shape{});
             ngraph::copy_runtime_info(old_eltwise_const, new_constant);
@@ -96,6 +118,13 @@ ov::intel_cpu::MoveEltwiseUpThroughDataMov::MoveEltwiseUpThroughDataMov() {
 
         ngraph::OutputVector eltwiseInputs = eltwise->input_values();
         eltwiseInputs[0] = child->input_value(0);
+        if (reshape_second_input) {
+            const auto& shape = current->get_output_shape(0);
+            auto target_shape = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{shape.size()}, shape);
+            auto reshape = std::make_shared<ngraph::opset8::Reshape>(eltwiseInputs[1], target_shape, false);
+            ngraph::copy_runtime_info(eltwise, {reshape, target_shape});
+            eltwiseInputs[1] = reshape;
+        }
         auto newEltwise = eltwise->clone_with_new_inputs(eltwiseInputs);
         // WA: it's necessary to set empty friendly name here
         // to avoid name duplication in TypeRelaxed cases
@@ -61,16 +61,16 @@ std::shared_ptr<ngraph::Node> ov::intel_cpu::MHANode::clone_with_new_inputs(cons
 void ov::intel_cpu::MHANode::validate_and_infer_types() {
     INTERNAL_OP_SCOPE(MHANode_validate_and_infer_types);
 
-    auto transpose = [](const ov::Shape& shape, const std::vector<size_t>& order) -> ov::Shape {
-        std::vector<size_t> new_shape(shape.size());
-        for (int i = 0; i < shape.size(); i++) {
+    auto transpose = [](const ov::PartialShape& shape, const std::vector<size_t>& order) -> ov::PartialShape {
+        std::vector<ov::Dimension> new_shape(shape.size());
+        for (size_t i = 0; i < shape.size(); i++) {
             new_shape[i] = shape[order[i]];
         }
         return new_shape;
     };
 
-    const auto matmul0_shape0 = transpose(get_input_partial_shape(0).get_shape(), {0, 2, 1, 3});
-    const auto matmul0_shape1 = transpose(get_input_partial_shape(1).get_shape(), {0, 2, 3, 1});
+    const auto matmul0_shape0 = transpose(get_input_partial_shape(0), {0, 2, 1, 3});
+    const auto matmul0_shape1 = transpose(get_input_partial_shape(1), {0, 2, 3, 1});
 
     auto matmul0_in0 = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, matmul0_shape0);
     auto matmul0_in1 = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, matmul0_shape1);
@@ -82,7 +82,7 @@ void ov::intel_cpu::MHANode::validate_and_infer_types() {
     shape_infer(matmul0.get(), matmul0_input_shapes, matmul0_output_shapes);
 
     const auto matmul1_shape0 = matmul0_output_shapes[0];
-    const auto matmul1_shape1 = transpose(get_input_partial_shape(3).get_shape(), {0, 2, 1, 3});
+    const auto matmul1_shape1 = transpose(get_input_partial_shape(3), {0, 2, 1, 3});
 
     auto matmul1_in0 = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, matmul1_shape0);
     auto matmul1_in1 = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, matmul1_shape1);
@@ -93,7 +93,7 @@ void ov::intel_cpu::MHANode::validate_and_infer_types() {
 
     shape_infer(matmul1.get(), matmul1_input_shapes, matmul1_output_shapes);
 
-    const auto output_shape = transpose(matmul1_output_shapes[0].get_shape(), {0, 2, 1, 3});
+    const auto output_shape = transpose(matmul1_output_shapes[0], {0, 2, 1, 3});
 
     set_output_type(
         0,
@@ -6,8 +6,10 @@
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset3.hpp>
+#include <ngraph/opsets/opset8.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include "transformations/cpu_opset/x64/op/mha.hpp"
 #include "simplify_fakequantize.hpp"
 
@@ -577,3 +579,111 @@ ov::intel_cpu::MHAQuantFusion2::MHAQuantFusion2() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(transpose3, matcher_name);
     this->register_matcher(m, callback);
 }
+
+ov::intel_cpu::MHADynamicFusion::MHADynamicFusion() {
+    MATCHER_SCOPE(MHADynamicFusion);
+
+    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in2 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
+    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in4 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
+    auto in5 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
+    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in9 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
+    auto in10 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
+    auto transpose0 = std::make_shared<ngraph::opset3::Transpose>(in0, in4);
+    auto transpose1 = std::make_shared<ngraph::opset3::Transpose>(in1, in5);
+    auto matmul0 = std::make_shared<ngraph::opset3::MatMul>(transpose0, transpose1);
+    auto mul = std::make_shared<ngraph::opset3::Multiply>(matmul0, in2);
+    auto add_in0 = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{matmul0, mul});
+    auto add = std::make_shared<ngraph::opset4::Add>(add_in0, in3);
+    auto softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax, ngraph::opset8::Softmax>({add});
+    auto transpose2 = std::make_shared<ngraph::opset3::Transpose>(in8, in9);
+    auto matmul1 = std::make_shared<ngraph::opset3::MatMul>(softmax, transpose2);
+    auto transpose3 = std::make_shared<ngraph::opset3::Transpose>(matmul1, in10);
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto& pattern_to_output = m.get_pattern_value_map();
+        auto transpose0_in = pattern_to_output.at(in0);
+        auto transpose1_in = pattern_to_output.at(in1);
+        auto add_in1 = pattern_to_output.at(in3);
+        auto transpose2_in = pattern_to_output.at(in8);
+
+        // static attention is handled by the fusions above or by snippets
+        if (transpose0_in.get_partial_shape().is_static() && transpose1_in.get_partial_shape().is_static() &&
+            transpose2_in.get_partial_shape().is_static() && add_in1.get_partial_shape().is_static()) {
+            return false;
+        }
+
+        if (transpose0_in.get_partial_shape().size() != 4 || transpose1_in.get_partial_shape().size() != 4 ||
+            transpose2_in.get_partial_shape().size() != 4 || add_in1.get_partial_shape().size() != 4) {
+            return false;
+        }
+
+        if (!valid_transpose_order(pattern_to_output.at(in4).get_node_shared_ptr(), {0, 2, 1, 3})) return false;
+        if (!valid_transpose_order(pattern_to_output.at(in5).get_node_shared_ptr(), {0, 2, 3, 1})) return false;
+        if (!valid_transpose_order(pattern_to_output.at(in9).get_node_shared_ptr(), {0, 2, 1, 3})) return false;
+        if (!valid_transpose_order(pattern_to_output.at(in10).get_node_shared_ptr(), {0, 2, 1, 3})) return false;
+
+        auto matmul0_node = ngraph::as_type_ptr<ngraph::opset3::MatMul>(pattern_to_output.at(matmul0).get_node_shared_ptr());
+        if (!matmul0_node)
+            return false;
+        if (matmul0_node->get_transpose_a() || matmul0_node->get_transpose_b())
+            return false;
+
+        std::vector<float> mul_scales;
+        const bool with_mul = pattern_to_output.count(mul) != 0;
+        if (with_mul) {
+            auto scale_node = ngraph::as_type_ptr<ngraph::opset4::Constant>(pattern_to_output.at(in2).get_node_shared_ptr());
+            if (!scale_node || ngraph::shape_size(scale_node->get_shape()) != 1)
+                return false;
+            mul_scales = scale_node->cast_vector<float>();
+        }
+
+        int64_t softmax_axis = -1;
+        const auto softmax_node = pattern_to_output.at(softmax).get_node_shared_ptr();
+        if (auto softmax_v1 = ngraph::as_type_ptr<ngraph::opset1::Softmax>(softmax_node)) {
+            softmax_axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else if (auto softmax_v8 = ngraph::as_type_ptr<ngraph::opset8::Softmax>(softmax_node)) {
+            softmax_axis = softmax_v8->get_axis();
+            if (softmax_axis < 0)
+                softmax_axis += 4;
+        }
+        if (softmax_axis != 3)
+            return false;
+
+        auto matmul1_node = ngraph::as_type_ptr<ngraph::opset3::MatMul>(pattern_to_output.at(matmul1).get_node_shared_ptr());
+        if (!matmul1_node)
+            return false;
+        if (matmul1_node->get_transpose_a() || matmul1_node->get_transpose_b())
+            return false;
+
+        auto transpose3_node = pattern_to_output.at(transpose3).get_node_shared_ptr();
+        auto mha = std::make_shared<ov::intel_cpu::MHANode>(transpose0_in, transpose1_in, add_in1, transpose2_in, mul_scales, with_mul,
+                                                            transpose3_node->get_output_element_type(0));
+        mha->set_friendly_name(m.get_match_root()->get_friendly_name());
+        ngraph::NodeVector fused_nodes = {pattern_to_output.at(transpose0).get_node_shared_ptr(),
+                                          pattern_to_output.at(transpose1).get_node_shared_ptr(),
+                                          pattern_to_output.at(matmul0).get_node_shared_ptr(),
+                                          pattern_to_output.at(add).get_node_shared_ptr(),
+                                          softmax_node,
+                                          pattern_to_output.at(transpose2).get_node_shared_ptr(),
+                                          pattern_to_output.at(matmul1).get_node_shared_ptr(),
+                                          transpose3_node};
+        if (with_mul)
+            fused_nodes.push_back(pattern_to_output.at(mul).get_node_shared_ptr());
+        ngraph::copy_runtime_info(fused_nodes, mha);
+
+        if (transformation_callback(mha)) {
+            return false;
+        }
+
+        ngraph::replace_node(m.get_match_root(), mha);
+
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(transpose3, matcher_name);
+    this->register_matcher(m, callback);
+}
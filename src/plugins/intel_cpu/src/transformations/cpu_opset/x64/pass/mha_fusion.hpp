@@ -49,6 +49,13 @@ public:
     MHAQuantFusion2();
 };
 
+// Matches attention with dynamic shapes: executed by the tiled (flash attention) implementation of MHA node
+class MHADynamicFusion: public MHAFusionBase {
+public:
+    OPENVINO_RTTI("MHADynamicFusion", "0");
+    MHADynamicFusion();
+};
+
 class MHAFusion : public ngraph::pass::GraphRewrite {
 public:
     OPENVINO_RTTI("MHAFusion", "0");
@@ -57,6 +64,7 @@ public:
         add_matcher<MHAFloatFusion2>();
         add_matcher<MHAQuantFusion>();
         add_matcher<MHAQuantFusion2>();
+        add_matcher<MHADynamicFusion>();
     }
 };
 
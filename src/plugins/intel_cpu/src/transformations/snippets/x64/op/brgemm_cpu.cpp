@@ -47,9 +47,11 @@ void BrgemmCPU::validate_and_infer_types() {
     NODE_VALIDATION_CHECK(this, get_input_partial_shape(0).is_static() && get_input_partial_shape(1).is_static(),
                           "BrgemmCPU currently supports only static shapes.");
 
-    OPENVINO_ASSERT(implication(one_of(m_type, Type::Floating, Type::WithDataRepacking), get_input_size() == 2),
+    // The optional bias is always the last input
+    const auto input_size = get_input_size() - m_with_bias;
+    OPENVINO_ASSERT(implication(one_of(m_type, Type::Floating, Type::WithDataRepacking), input_size == 2),
                     "BrgemmCPU expects 2 inputs in cases, when input precisions are f32|f32, u8|i8 or bf16|bf16 (non-AMX system)");
-    OPENVINO_ASSERT(implication(one_of(m_type, Type::WithCompensations, Type::AMX), get_input_size() == 3),
+    OPENVINO_ASSERT(implication(one_of(m_type, Type::WithCompensations, Type::AMX), input_size == 3),
                     "BrgemmCPU expects 3 inputs with input precisions i8|i8 and bf16|bf16 on AMX system");
 
     const auto brgemm_copy = is_with_data_repacking() ? get_brgemm_copy() : nullptr;
@@ -84,6 +86,8 @@ void BrgemmCPU::validate_and_infer_types() {
                          "BRGEMM Scratch for space workplace must be static, have U8 element type and size is equal to " + std::to_string(SCRATCH_BYTE_SIZE));
         }
     }
+    if (m_with_bias)
+        validate_bias();
 }
 
 std::shared_ptr<Node> BrgemmCPU::clone_with_new_inputs(const OutputVector& new_args) const {
@@ -97,6 +101,7 @@ std::shared_ptr<Node> BrgemmCPU::clone_with_new_inputs(const OutputVector& new_a
         new_node = std::make_shared<BrgemmCPU>(new_args.at(0), new_args.at(1), new_args.at(2), m_type,
                                                get_offset_a(), get_offset_b(), get_offset_scratch(), get_offset_c());
     }
+    copy_epilogue(new_node, new_args);
     return new_node;
 }
 
@@ -109,7 +114,7 @@ std::shared_ptr<BrgemmCopyB> BrgemmCPU::get_brgemm_copy() const {
 }
 
 size_t BrgemmCPU::get_offset_scratch() const {
-    OPENVINO_ASSERT(is_with_scratchpad() && get_input_size() == 3, "Offset of scratchpad must be only in Brgemm with scratchpad on 3rd input");
+    OPENVINO_ASSERT(is_with_scratchpad() && get_input_size() == 3 + m_with_bias, "Offset of scratchpad must be only in Brgemm with scratchpad on 3rd input");
     return get_input_offset(2);
 }
 
@@ -81,6 +81,14 @@ pass::BrgemmToBrgemmCPU::BrgemmToBrgemmCPU() {
             }
         }
 
+        if (brgemm->has_epilogue()) {
+            const auto brgemm_cpu_node = ov::as_type_ptr<BrgemmCPU>(brgemm_cpu);
+            if (brgemm->has_bias())
+                brgemm_cpu_node->set_bias(brgemm->input_value(brgemm->get_input_size() - 1), brgemm->get_offset_bias());
+            brgemm_cpu_node->set_post_ops(brgemm->get_post_ops());
+            brgemm_cpu_node->validate_and_infer_types();
+        }
+
         brgemm_cpu->set_friendly_name(brgemm->get_friendly_name());
         ngraph::snippets::utils::set_output_layout(brgemm_cpu->output(0), ngraph::snippets::utils::get_node_output_layout(brgemm));
         ngraph::copy_runtime_info(brgemm, brgemm_cpu);
@@ -3,9 +3,17 @@
 //
 #include "snippets_mark_skipped.hpp"
 #include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/reduce_decomposition.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+#include <openvino/op/i420_to_rgb.hpp>
+#include <openvino/op/nv12_to_bgr.hpp>
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/reduce_l2.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/pass/constant_folding.hpp>
 #include <utils/general_utils.h>
 #include <utils/cpu_utils.hpp>
 
@@ -174,6 +182,22 @@ bool isSuitableMiscParent(const std::shared_ptr<const Node> &node) {
     const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
     return is_suitable_node && has_only_child;
 }
+// ColorConvert fuses u8->f32 Convert and per-channel normalization (preprocessing mean/scale steps)
+bool isSuitableColorConvertParent(const std::shared_ptr<const Node> &node) {
+    const bool is_suitable_node = ov::is_type<ov::op::v8::NV12toRGB>(node) ||
+                                  ov::is_type<ov::op::v8::NV12toBGR>(node) ||
+                                  ov::is_type<ov::op::v8::I420toRGB>(node) ||
+                                  ov::is_type<ov::op::v8::I420toBGR>(node);
+    // has a single output, connected to a single child
+    const auto out = node->outputs();
+    const bool has_only_child = (out.size() == 1) && (out[0].get_target_inputs().size() == 1);
+    return is_suitable_node && has_only_child;
+}
+bool isSuitableColorConvertChild(const std::shared_ptr<const Node> &node, const int channelAxis) {
+    if (ov::is_type<ngraph::op::Convert>(node))
+        return node->get_input_element_type(0) == element::u8 && node->get_output_element_type(0) == element::f32;
+    return node->get_output_element_type(0) == element::f32 && canBePerformedAsScaleShift(node, channelAxis);
+}
 // Matmul is a special case, since it supports simple + bias fusings
 bool isSuitableMatMulParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::MatMul>(node);
@@ -189,6 +213,69 @@ inline bool isSuitableReduceParent(const std::shared_ptr<const Node> &node) {
     bool out_is_f32 = node->get_output_element_type(0) == ov::element::f32;
     return is_suitable_reduce && is_not_min_max && out_is_f32;
 }
+// The reductions which GraphOptimizer::MergeSiblingReduces computes in one multi-output Reduce node
+bool isMultiOutputReduce(const Node* node) {
+    return (ov::is_type<ov::op::v1::ReduceSum>(node) || ov::is_type<ov::op::v1::ReduceMean>(node) ||
+            ov::is_type<ov::op::v1::ReduceMax>(node) || ov::is_type<ov::op::v1::ReduceMin>(node) ||
+            ov::is_type<ov::op::v4::ReduceL2>(node)) &&
+           ngraph::op::is_constant(node->get_input_node_ptr(1)) &&
+           node->get_input_element_type(0) == element::f32 && node->get_output_element_type(0) == element::f32;
+}
+bool haveSameReduction(const Node* lhs, const Node* rhs) {
+    const auto lhsReduce = ov::as_type<const ngraph::op::util::ArithmeticReductionKeepDims>(lhs);
+    const auto rhsReduce = ov::as_type<const ngraph::op::util::ArithmeticReductionKeepDims>(rhs);
+    return lhsReduce && rhsReduce && lhsReduce->get_keep_dims() == rhsReduce->get_keep_dims() &&
+           lhs->get_input_partial_shape(0).rank() == rhs->get_input_partial_shape(0).rank() &&
+           lhsReduce->get_reduction_axes() == rhsReduce->get_reduction_axes();
+}
+// Returns the squared tensor if the node is x * x or x ^ 2 with a single consumer
+Output<Node> getSquaredTensor(const Node* node) {
+    if (node->get_output_size() != 1 || node->get_output_target_inputs(0).size() != 1)
+        return {};
+    if (ov::is_type<ngraph::opset1::Multiply>(node) && node->input_value(0) == node->input_value(1))
+        return node->input_value(0);
+    if (ov::is_type<ngraph::opset1::Power>(node)) {
+        const auto exponent = ov::as_type<const ngraph::opset1::Constant>(node->get_input_node_ptr(1));
+        if (exponent && ov::shape_size(exponent->get_shape()) == 1 && exponent->cast_vector<float>()[0] == 2.f)
+            return node->input_value(0);
+    }
+    return {};
+}
+// The reduction has a sibling reduction over the same axes of the same tensor (or of its square),
+// so they are merged into one Reduce node which reads the tensor once
+bool hasMergeableSiblingReduce(const std::shared_ptr<const Node> &node) {
+    if (!isMultiOutputReduce(node.get()))
+        return false;
+    auto isSumOrMean = [](const Node* n) {
+        return ov::is_type<ov::op::v1::ReduceSum>(n) || ov::is_type<ov::op::v1::ReduceMean>(n);
+    };
+    auto hasSiblingReduceOf = [&node](const Output<Node>& tensor) {
+        for (const auto& consumer : tensor.get_target_inputs()) {
+            const auto sibling = consumer.get_node();
+            if (sibling != node.get() && consumer.get_index() == 0 && isMultiOutputReduce(sibling) &&
+                haveSameReduction(node.get(), sibling))
+                return true;
+        }
+        return false;
+    };
+    const auto data = node->input_value(0);
+    if (hasSiblingReduceOf(data))
+        return true;
+    // the node reduces the square of the tensor which is reduced by the sibling
+    const auto squared = getSquaredTensor(data.get_node());
+    if (isSumOrMean(node.get()) && squared.get_node() && hasSiblingReduceOf(squared))
+        return true;
+    // the sibling reduces the square of the data
+    for (const auto& consumer : data.get_target_inputs()) {
+        const auto square = consumer.get_node();
+        if (getSquaredTensor(square) != data)
+            continue;
+        const auto squaredReduce = square->get_output_target_inputs(0).begin()->get_node();
+        if (isSumOrMean(squaredReduce) && isMultiOutputReduce(squaredReduce) && haveSameReduction(node.get(), squaredReduce))
+            return true;
+    }
+    return false;
+}
 // Subtract as ZeroPoints for Convolution
 bool isSuitableSubtractAsZeroPointsParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ngraph::op::v1::Subtract>(node);
@@ -449,6 +536,34 @@ bool isSuitableConvert(const std::shared_ptr<const Node>& node) {
         return false;
     }
 }
+
+// Convert -> [Subtract] -> Multiply chain over quantized constant kept by MarkEmbeddingTableDecompression
+// or MarkMatMulWeightsDecompression, it is fused into the EmbeddingBag or FullyConnected node by the graph optimizer
+bool isSuitableConstDecompression(const std::shared_ptr<const Node>& node) {
+    if (ov::is_type<ngraph::op::Convert>(node) &&
+        !(ngraph::op::is_constant(node->get_input_node_ptr(0)) && ov::pass::constant_folding_is_disabled(node.get())))
+        return false;
+    auto is_decompression_op = [](const Node* n) {
+        return ov::is_type<ngraph::op::Convert>(n) || ov::is_type<ngraph::opset1::Subtract>(n) ||
+               ov::is_type<ngraph::opset1::Multiply>(n) || ov::is_type<ngraph::opset1::Reshape>(n);
+    };
+    const Node* n = node.get();
+    while (is_decompression_op(n)) {
+        const auto consumers = n->get_output_target_inputs(0);
+        if (consumers.size() != 1)
+            return false;
+        if (!ov::is_type<ngraph::op::Convert>(n) && !ngraph::op::is_constant(n->get_input_node_ptr(1)))
+            return false;
+        const auto& consumer = *consumers.begin();
+        n = consumer.get_node();
+        if (ov::is_type<ov::opset3::EmbeddingBagOffsetsSum>(n) || ov::is_type<ov::opset3::EmbeddingBagPackedSum>(n) ||
+            ov::is_type<ov::opset3::EmbeddingSegmentsSum>(n))
+            return consumer.get_index() == 0;
+        if (ov::is_type<ngraph::opset1::MatMul>(n))
+            return consumer.get_index() == 1;
+    }
+    return false;
+}
 } // namespace
 
 bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
@@ -464,6 +579,17 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (isSuitableBinaryConvolutionParent(node)) {
             SetNodeFusingType(node, NodeFusingType::FusedWithBinaryConvolution);
             channelAxis = DEFAULT_AXIS;
+        } else if (snippets::pass::ReduceDecomposition::is_supported_reduce(node)) {
+            // Last-axis reductions are tokenized together with the surrounding normalization ops,
+            // so they aren't reserved for the Reduce node fusings. The exception is the sibling reductions of the same
+            // tensor: the merged Reduce node reads the tensor once, while the snippet would re-read it in each Loop
+            if (hasMergeableSiblingReduce(node)) {
+                SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+                const auto square = node->get_input_node_shared_ptr(0);
+                if (getSquaredTensor(square.get()).get_node())
+                    SetSnippetsNodeType(square, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            }
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableReduceParent(node)) {
             const auto reduce = std::dynamic_pointer_cast<const ngraph::op::util::ArithmeticReductionKeepDims>(node);
             channelAxis = getChannelAxis(reduce->get_reduction_axes(), reduce->get_keep_dims());
@@ -475,6 +601,10 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
                 channelAxis = DEFAULT_AXIS;
             }
             SetNodeFusingType(node, NodeFusingType::FusedWithMisc);
+        } else if (isSuitableColorConvertParent(node)) {
+            // ColorConvert output is always NHWC
+            channelAxis = 3;
+            SetNodeFusingType(node, NodeFusingType::FusedWithColorConvert);
         } else if (isSuitableMatMulParent(node)) {
             if (canBeMatMulExecutedInInt8(node->get_input_element_type(0), node->get_input_element_type(1)))
                 SetNodeFusingType(node, NodeFusingType::FusedWithMatMulI8);
@@ -490,9 +620,15 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (enableBF16 && isSuitableConvert(node)) {
             SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
             channelAxis = DEFAULT_AXIS;
+        } else if (isSuitableConstDecompression(node)) {
+            SetSnippetsNodeType(node, snippets::pass::SnippetsNodeType::SkippedByPlugin);
+            channelAxis = DEFAULT_AXIS;
         } else {
             for (const auto fusingChainType : getContinuableChains(node)) {
-                if (fusingChainType == NodeFusingType::FusedWithReduce) {
+                if (fusingChainType == NodeFusingType::FusedWithColorConvert) {
+                    if (isSuitableColorConvertChild(node, channelAxis))
+                        PropagateIfHasOnlyChild(node, fusingChainType);
+                } else if (fusingChainType == NodeFusingType::FusedWithReduce) {
                     if (isSuitableReduceChild(node, channelAxis))
                         PropagateIfHasOnlyChild(node, fusingChainType);
                 } else if (isSuitableChildForFusingSimple(node, channelAxis)) {
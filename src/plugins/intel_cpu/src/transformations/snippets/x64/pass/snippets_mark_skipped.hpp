@@ -39,7 +39,7 @@ enum class NodeFusingType : int64_t {
     NotSet,
     FusedTerminator,
     FusedWithConvolution,  FusedWithBinaryConvolution, FusedWithConvolutionSumActivation,
-    FusedWithMatMul, FusedWithMatMulI8, FusedWithReduce, FusedWithMisc};
+    FusedWithMatMul, FusedWithMatMulI8, FusedWithReduce, FusedWithMisc, FusedWithColorConvert};
 
 }   // namespace intel_cpu
 }   // namespace ov
@@ -105,6 +105,8 @@
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/ref_convert_i64_i32.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/mark_embedding_table_decompression.hpp"
+#include "transformations/cpu_opset/common/pass/mark_matmul_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -115,8 +117,10 @@
 #include "nodes/normalize.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/mha.h"
+#include "nodes/fullyconnected.h"
 
 #include "dnnl.hpp"
+#include <ie_ngraph_utils.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 namespace ov {
@@ -202,6 +206,32 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     if (useLpt) {
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
     }
+    // the kept decompression is fused only into the JIT EmbeddingBag and FullyConnected kernels
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        CPU_REGISTER_PASS_X64(manager, MarkEmbeddingTableDecompression);
+        CPU_REGISTER_PASS_X64(manager, MarkMatMulWeightsDecompression);
+    }
+    // the decompression is kept only if the FullyConnected node fuses it, otherwise it'd be executed on each inference
+    CPU_SET_CALLBACK_X64(manager,
+        [useLpt](const_node_ptr &node) -> bool {
+            // the quantized activations make LPT move the dequantization to the FullyConnected node
+            if (useLpt && ov::is_type<const ov::opset1::FakeQuantize>(node->get_input_node_ptr(0)))
+                return true;
+            auto weights = node->get_input_node_ptr(1);
+            while (!ov::is_type<const ov::opset1::Constant>(weights))
+                weights = weights->get_input_node_ptr(0);
+            // int4 weights are converted to int8 ones by ConvertPrecision
+            auto weightsType = weights->get_output_element_type(0);
+            if (weightsType == ov::element::i4)
+                weightsType = ov::element::i8;
+            else if (weightsType == ov::element::u4)
+                weightsType = ov::element::u8;
+            return !node::FullyConnected::isSupportedWeightsDecompression(
+                InferenceEngine::details::convertPrecision(weightsType),
+                InferenceEngine::details::convertPrecision(node->get_input_element_type(0)),
+                node->get_input_partial_shape(0).size());
+        },
+        MarkMatMulWeightsDecompression);
 
     auto get_convert_precisions = []() {
         precisions_map map = {
@@ -590,15 +620,19 @@ void Transformations::PostLpt() {
             // Implementation calls AMX BF16 brgemm only for tensors with K and N aligned on 2, otherwise fallbacks on vector impl
             // Vector madd BF16 instruction on SPR has reduced performance on HW level, which results in overall perf degradation
             size_t bf16Factor = 2;
+            const auto isNotAligned = [&](const ov::Dimension& dim) {
+                return dim.is_static() && dim.get_length() % bf16Factor != 0;
+            };
             if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
                 (n->get_input_element_type(0) == element::bf16 || (n->get_input_element_type(0) == element::f32 && enableBF16)) &&
-                (n->get_input_shape(0)[3] % bf16Factor != 0 || n->get_input_shape(1)[1] % bf16Factor != 0 || n->get_input_shape(3)[3] % bf16Factor != 0)) {
+                (isNotAligned(n->get_input_partial_shape(0)[3]) || isNotAligned(n->get_input_partial_shape(1)[1]) ||
+                 isNotAligned(n->get_input_partial_shape(3)[3]))) {
                 return true;
             }
 
             return false;
         }),
-        MHAFloatFusion, MHAFloatFusion2, MHAQuantFusion, MHAQuantFusion2);
+        MHAFloatFusion, MHAFloatFusion2, MHAQuantFusion, MHAQuantFusion2, MHADynamicFusion);
 
     // Float MHA is supported by snippets now
     if (!enableBF16) {
@@ -675,7 +709,7 @@ void Transformations::MainSnippets(void) {
                                                             });
                 // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                 auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
-                    // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                    // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                     return t.get_partial_shape().rank().get_length() > 6;
                 };
                 const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -5,11 +5,48 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <onednn/dnnl.h>
+#include <algorithm>
 #include <memory>
+#include <vector>
+
+#if defined(__linux__)
+#    include <linux/mempolicy.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+// Spreads the pages of the memory over all the NUMA nodes in round-robin, the already touched pages are migrated
+bool interleaveMemory(void* data, size_t size) {
+#if defined(__linux__) && defined(SYS_mbind)
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    if (numaNodes.size() < 2 || size == 0)
+        return false;
+    constexpr size_t bitsPerMask = sizeof(unsigned long) * 8;
+    const auto maxNode = static_cast<size_t>(std::max(0, *std::max_element(numaNodes.begin(), numaNodes.end())));
+    std::vector<unsigned long> nodeMask(maxNode / bitsPerMask + 1, 0);
+    for (auto node : numaNodes) {
+        if (node >= 0)
+            nodeMask[node / bitsPerMask] |= 1ul << (node % bitsPerMask);
+    }
+    // the policy is applied to the whole pages, the pages shared with the neighbour allocations are kept as is
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(data) + pageSize - 1) & ~(pageSize - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(data) + size) & ~(pageSize - 1);
+    if (end <= begin)
+        return false;
+    return syscall(SYS_mbind, begin, end - begin, MPOL_INTERLEAVE, nodeMask.data(),
+                   nodeMask.size() * bitsPerMask + 1, MPOL_MF_MOVE) == 0;
+#else
+    return false;
+#endif
+}
+}  // namespace
+
 const SimpleDataHash WeightsSharing::simpleCRC;
 
 WeightsSharing::SharedMemory::SharedMemory(
@@ -33,6 +70,50 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+WeightsSharing::WeightsSharing(int numaNodeId, Config::WeightsNumaPolicy policy, const Ptr& commonCache)
+    : numaNodeId(numaNodeId)
+    , policy(policy)
+    , commonCache(commonCache)
+    , replicationLimit(std::max(dnnl::utils::get_cache_size(3, false), dnnl::utils::get_cache_size(2, true)))
+{}
+
+WeightsSharing::MemoryInfo::Ptr WeightsSharing::find(const std::string& key, MemoryPtr& memory) const {
+    auto found = sharedWeights.find(key);
+    if (found == sharedWeights.end() || !found->second)
+        return nullptr;
+    memory = found->second->sharedMemory.lock();
+    return memory ? found->second : nullptr;
+}
+
+WeightsSharing::MemoryInfo::Ptr WeightsSharing::insert(const std::string& key,
+                                                       MemoryPtr& memory,
+                                                       bool valid,
+                                                       const std::string& placement) {
+    std::unique_lock<std::mutex> lock(guard);
+    MemoryPtr cached;
+    if (auto ptr = find(key, cached)) {
+        // the weights were created by the stream of another NUMA node at the same time
+        memory = cached;
+        return ptr;
+    }
+    auto ptr = std::make_shared<MemoryInfo>(memory, valid, placement);
+    sharedWeights[key] = ptr;
+    return ptr;
+}
+
+WeightsSharing::SharedMemory::Ptr WeightsSharing::makeShared(const MemoryInfo::Ptr& ptr, MemoryPtr memory) {
+    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
+                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
+                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, memory);
+}
+
+std::string WeightsSharing::placeMemory(const MemoryPtr& memory, bool interleave) const {
+    if (interleave && interleaveMemory(memory->GetData(), memory->GetSize()))
+        return "INTERLEAVE";
+    // the memory is touched first by the creating stream, so the pages are local to its NUMA node
+    return "NUMA" + std::to_string(numaNodeId);
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                             const std::string& key,
                             std::function<MemoryPtr(void)> create,
@@ -41,18 +122,26 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
     MemoryPtr newPtr;
     {
         std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+        ptr = find(key, newPtr);
+        if (!ptr && commonCache) {
+            std::unique_lock<std::mutex> commonLock(commonCache->guard);
+            ptr = commonCache->find(key, newPtr);
+        }
 
-        if (found == sharedWeights.end()
-            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
+        if (!ptr) {
             newPtr = create();
-            ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+            const bool replicate = !commonCache || policy == Config::WeightsNumaPolicy::Replicate ||
+                                   (policy == Config::WeightsNumaPolicy::Auto && newPtr->GetSize() <= replicationLimit);
+            if (replicate) {
+                ptr = std::make_shared<MemoryInfo>(newPtr, valid, placeMemory(newPtr, false));
+                sharedWeights[key] = ptr;
+            } else {
+                const bool interleave = policy != Config::WeightsNumaPolicy::FirstTouch;
+                ptr = commonCache->insert(key, newPtr, valid, placeMemory(newPtr, interleave));
+            }
         }
     }
-    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    return makeShared(ptr, newPtr);
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
@@ -60,20 +149,36 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
     MemoryPtr newPtr;
     {
         std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+        ptr = find(key, newPtr);
+        if (!ptr && commonCache) {
+            std::unique_lock<std::mutex> commonLock(commonCache->guard);
+            ptr = commonCache->find(key, newPtr);
+        }
 
-        if (found == sharedWeights.end()
-            || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock())))
+        if (!ptr)
             IE_THROW() << "Unknown shared memory with key " << key;
     }
-    return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
-                                                ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
-                                                : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
+    return makeShared(ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+void WeightsSharing::getPlacement(std::map<std::string, std::string>& placement) const {
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& item : sharedWeights) {
+        MemoryPtr memory;
+        if (const auto ptr = find(item.first, memory)) {
+            auto& entry = placement[item.first];
+            entry += (entry.empty() ? "" : ",") + ptr->placement;
+        }
+    }
+}
+
+NumaNodesWeights::NumaNodesWeights(Config::WeightsNumaPolicy policy) {
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    // all the weights are replicated if there is a single NUMA node
+    if (numaNodes.size() > 1 && policy != Config::WeightsNumaPolicy::Replicate)
+        _common_cache = std::make_shared<WeightsSharing>();
+    for (auto numa_id : numaNodes)
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(numa_id, policy, _common_cache);
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
@@ -90,5 +195,14 @@ const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     return found->second;
 }
 
+std::map<std::string, std::string> NumaNodesWeights::getPlacement() const {
+    std::map<std::string, std::string> placement;
+    for (const auto& cache : _cache_map)
+        cache.second->getPlacement(placement);
+    if (_common_cache)
+        _common_cache->getPlacement(placement);
+    return placement;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
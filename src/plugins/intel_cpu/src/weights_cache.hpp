@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "config.h"
 
 #include <unordered_map>
 #include <functional>
@@ -57,19 +58,30 @@ class WeightsSharing {
     struct MemoryInfo {
         typedef std::shared_ptr<MemoryInfo> Ptr;
 
-        MemoryInfo(MemoryPtr memoryPtr, bool valid)
+        MemoryInfo(MemoryPtr memoryPtr, bool valid, std::string placement)
             : sharedMemory(memoryPtr)
             , valid(valid)
+            , placement(std::move(placement))
         {}
 
         std::mutex guard;
         std::weak_ptr<Memory> sharedMemory;
         std::atomic<bool> valid;
+        // NUMA node of the memory pages (NUMA<id>) or INTERLEAVE
+        const std::string placement;
     };
 
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+    /**
+     * The cache of the streams running on the NUMA node numaNodeId.
+     * The weights which are not replicated according to the policy are stored once in the commonCache
+     * which is shared by the caches of all the NUMA nodes
+     */
+    WeightsSharing(int numaNodeId, Config::WeightsNumaPolicy policy, const Ptr& commonCache);
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,28 +106,53 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * Appends the placement of the alive weights to the placement map (key -> comma-separated placements),
+     * the replicated weights have an entry per NUMA node
+     */
+    void getPlacement(std::map<std::string, std::string>& placement) const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    // Returns the cached memory or nullptr, the guard has to be locked
+    MemoryInfo::Ptr find(const std::string& key, MemoryPtr& memory) const;
+    // Stores the memory if the key is not cached yet, otherwise the cached memory is returned
+    MemoryInfo::Ptr insert(const std::string& key, MemoryPtr& memory, bool valid, const std::string& placement);
+    static SharedMemory::Ptr makeShared(const MemoryInfo::Ptr& ptr, MemoryPtr memory);
+    std::string placeMemory(const MemoryPtr& memory, bool interleave) const;
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
+
+    int numaNodeId = -1;
+    Config::WeightsNumaPolicy policy = Config::WeightsNumaPolicy::Replicate;
+    Ptr commonCache;
+    // Auto policy: the weights which fit the last level cache are replicated, the bigger ones are interleaved
+    size_t replicationLimit = 0;
 };
 
 /**
  * Collection of memory caching store per NUMA node(former socket)
+ * The weights are replicated per NUMA node or stored once according to the policy
  *
  * Is a thread safe
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    explicit NumaNodesWeights(Config::WeightsNumaPolicy policy = Config::WeightsNumaPolicy::Replicate);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    // Placement of the alive weights: key -> comma-separated NUMA<id> or INTERLEAVE
+    std::map<std::string, std::string> getPlacement() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
+    // The weights stored once for all the NUMA nodes, nullptr if there is a single NUMA node
+    WeightsSharing::Ptr _common_cache;
 };
 
 }   // namespace intel_cpu
@@ -102,6 +102,9 @@ const auto planar_5D = CPUSpecificParams{{ncdhw}, {ncdhw}, {}, "unknown"};
 const auto planarChannels_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "ref"};
 const auto planarChannels_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "ref"};
 
+const auto planarChannels_inPlace_4D = CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown"};
+const auto planarChannels_inPlace_5D = CPUSpecificParams{{ndhwc}, {ndhwc}, {}, "unknown"};
+
 const auto blocked8_4D = CPUSpecificParams{{nChw8c}, {nChw8c}, {}, "unknown"};
 const auto blocked8_5D = CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {}, "unknown"};
 
@@ -634,7 +637,24 @@ INSTANTIATE_TEST_SUITE_P(concat_Concat4D_CPU_Block8inPlace, ConcatLayerCPUTest,
                                 ::testing::Values(0, 1),
                                 ::testing::Values(static_shapes_to_test_representation({{1, 8, 3, 5}, {1, 8, 3, 5}})),
                                 ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(planar_4D, planarChannels_4D, blocked8_4D)),
+                                ::testing::Values(planar_4D, blocked8_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(concat_Concat4D_CPU_nspc_inPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 8, 3, 5}, {1, 8, 3, 5}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(planarChannels_inPlace_4D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+// the channels are not the outermost dim in the memory and the parameters can't write via the strides of the concat output
+INSTANTIATE_TEST_SUITE_P(concat_Concat4D_CPU_nspc_strided, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(1),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 8, 3, 5}, {1, 8, 3, 5}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(planarChannels_4D)),
                         ConcatLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_SUITE_P(smoke_Concat4D_CPU_Block16inPlace, ConcatLayerCPUTest,
@@ -650,7 +670,23 @@ INSTANTIATE_TEST_SUITE_P(concat_Concat5D_CPU_Block8inPlace, ConcatLayerCPUTest,
                                 ::testing::Values(0, 1),
                                 ::testing::Values(static_shapes_to_test_representation({{1, 16, 3, 5, 7}, {1, 16, 3, 5, 7}})),
                                 ::testing::ValuesIn(netPrecisions),
-                                ::testing::Values(planar_5D, planarChannels_5D, blocked8_5D)),
+                                ::testing::Values(planar_5D, blocked8_5D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(concat_Concat5D_CPU_nspc_inPlace, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(0),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 16, 3, 5, 7}, {1, 16, 3, 5, 7}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(planarChannels_inPlace_5D)),
+                        ConcatLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(concat_Concat5D_CPU_nspc_strided, ConcatLayerCPUTest,
+                        ::testing::Combine(
+                                ::testing::Values(1),
+                                ::testing::Values(static_shapes_to_test_representation({{1, 16, 3, 5, 7}, {1, 16, 3, 5, 7}})),
+                                ::testing::ValuesIn(netPrecisions),
+                                ::testing::Values(planarChannels_5D)),
                         ConcatLayerCPUTest::getTestCaseName);
 
 INSTANTIATE_TEST_SUITE_P(smoke_Concat5D_CPU_Block16inPlace, ConcatLayerCPUTest,
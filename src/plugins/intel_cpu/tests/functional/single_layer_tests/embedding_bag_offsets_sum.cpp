@@ -74,7 +74,9 @@ public:
         size_t defaultIndex;
         std::tie(inputShapes, indices, offsets, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // fp32 tables are accumulated by the jit kernel
+        const bool isJit = inType == ElementType::f32 && InferenceEngine::with_cpu_x86_avx2();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -67,7 +67,9 @@ protected:
         bool withWeights;
         std::tie(inputShapes, indices, withWeights) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // fp32 tables are accumulated by the jit kernel
+        const bool isJit = inType == ElementType::f32 && InferenceEngine::with_cpu_x86_avx2();
+        selectedType = makeSelectedTypeStr(isJit ? getPrimitiveType() : "ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
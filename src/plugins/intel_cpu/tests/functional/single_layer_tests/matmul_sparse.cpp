@@ -11,6 +11,7 @@
 #include <ov_ops/type_relaxed.hpp>
 #include "shared_test_classes/base/utils/generate_inputs.hpp"
 #include "cpu/cpu_config.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -187,7 +188,7 @@ protected:
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         cpuNodeType = "FullyConnected";
-        selectedType = makeSelectedTypeStr(selectedType, element::i8);
+        selectedType = makeSelectedTypeStr(selectedType, weiType == ElementType::f32 ? element::f32 : element::i8);
 
         auto params = builder::makeDynamicParams(inType, {inShapeA});
         auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<opset1::Parameter>(params));
@@ -230,6 +231,17 @@ std::vector<CPUSpecificParams> filterSpecificParams(bool sparseExpected) {
     return specificParams;
 }
 
+std::vector<CPUSpecificParams> filterSpecificParamsFP32() {
+    std::vector<CPUSpecificParams> specificParams;
+    if (with_cpu_x86_avx512_core()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "gemm_sparse_avx512"});
+    } else if (with_cpu_x86_avx2()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "gemm_sparse_avx2"});
+    }
+
+    return specificParams;
+}
+
 /* ============= FullyConnected ============= */
 namespace fullyConnected {
 
@@ -237,6 +249,7 @@ namespace fullyConnected {
 const std::map<std::string, std::string> emptyConfig = {};
 const std::map<std::string, std::string> SparseRate50 = {{CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0.5"}};
 const std::map<std::string, std::string> SparseRate80 = {{CPUConfigParams::KEY_CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE, "0.8"}};
+const std::map<std::string, std::string> SparseFP32KernelRate50 = {{PluginConfigInternalParams::KEY_CPU_SPARSE_FP32_KERNEL_RATE, "0.5"}};
 
 const std::vector<ShapeRelatedParams> IS2D_sparse_smoke = {
     {static_shapes_to_test_representation({{64, 64}, {64, 64}}), {false, true}},
@@ -285,6 +298,18 @@ const auto testParams2D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_I8_sparse, MatMulSparseCPUTest, testParams2D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const auto testParams2D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::ValuesIn(filterSpecificParamsFP32()),
+                                                   ::testing::Values(SparseFP32KernelRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_sparse, MatMulSparseCPUTest, testParams2D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
 const std::vector<ShapeRelatedParams> IS3D_sparse_smoke = {
     {static_shapes_to_test_representation({{1, 64, 64}, {64, 64}}), {false, true}},
     {static_shapes_to_test_representation({{3, 71, 64}, {64, 64}}), {false, true}},
@@ -333,6 +358,18 @@ const auto testParams3D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_I8_sparse, MatMulSparseCPUTest, testParams3D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const auto testParams3D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS3D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::ValuesIn(filterSpecificParamsFP32()),
+                                                   ::testing::Values(SparseFP32KernelRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_FP32_sparse, MatMulSparseCPUTest, testParams3D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
 } // namespace fullyConnected
 
 } // namespace
@@ -435,4 +435,27 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// hard suppression of many boxes, which are processed by several blocks
+const std::vector<InputShapeParams> inShapeParamsManyBoxes = {
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{2, 1000, 3},
+                                                                                            TargetShapeParams{1, 130, 2}}}
+};
+
+const auto nmsParamsManyBoxes = ::testing::Combine(::testing::ValuesIn(inShapeParamsManyBoxes),
+                                                   ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                      ::testing::Values(ElementType::i32),
+                                                                      ::testing::Values(ElementType::f32)),
+                                                   ::testing::Values(300),
+                                                   ::testing::Combine(::testing::ValuesIn(threshold),
+                                                                      ::testing::Values(0.3f),
+                                                                      ::testing::Values(0.0f)),
+                                                   ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::Values(true),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_ManyBoxes, NmsLayerCPUTest, nmsParamsManyBoxes, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
@@ -151,5 +151,24 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// iterations are independent, so they are executed in parallel
+std::vector<std::vector<InputShape>> staticInputs = {
+    {  // slices are contiguous and the body accesses them in place
+        {{1, 12, 10}, {{1, 12, 10}}},
+        {{1, 12, 10}, {{1, 12, 10}}}
+    },
+    {  // slices are strided and copied
+        {{4, 8, 10}, {{4, 8, 10}}},
+        {{4, 8, 10}, {{4, 8, 10}}}
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic, TensorIteratorCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(staticInputs),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::ValuesIn(inputPrecisions)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
@@ -3,9 +3,15 @@
 //
 
 #include <common_test_utils/ov_tensor_utils.hpp>
+#include <openvino/opsets/opset11.hpp>
+#include <chrono>
+#include <numeric>
+#include <random>
 #include "test_utils/cpu_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -53,6 +59,8 @@ public:
         bool staticShape = inputShape.first.rank() == 0;
         if (staticShape)
             result << "k=" << keepK << "_";
+        else
+            result << "minK=" << keepK << "_";
         result << "axis=" << axis << "_";
         result << "mode=" << mode << "_";
         result << "sort=" << sort << "_";
@@ -95,6 +103,7 @@ protected:
         ElementType inPrc, outPrc;
         InputShape inputShape;
         std::tie(keepK, axis, mode, sortTypeStable, netPrecision, inPrc, outPrc, inputShape) = basicParamsSet;
+        minDynamicK = keepK;
         sort = std::get<0>(sortTypeStable);
         stable = std::get<1>(sortTypeStable);
 
@@ -119,6 +128,7 @@ protected:
         auto params = ngraph::builder::makeDynamicParams(netPrecision, {inputDynamicShapes[0]});
 
         // static shape need specific const k to test different sorting algorithms, dynamic shape tests random param k
+        // not less than keepK
         std::shared_ptr<ov::op::v11::TopK> topk;
         if (staticShape) {
             auto k = std::make_shared<ov::op::v0::Constant>(ElementType::i64, ov::Shape{}, &keepK);
@@ -220,8 +230,8 @@ private:
         const auto& kPrecision = funcInputs[1].get_element_type();
         const auto& kShape = targetInputStaticShapes[1];
 
-        const size_t startFrom = 1;
-        const size_t range = targetInputStaticShapes[0][axis];
+        const size_t startFrom = minDynamicK;
+        const size_t range = targetInputStaticShapes[0][axis] - minDynamicK + 1;
         const size_t seed = inferRequestNum++;
         const auto kTensor = ov::test::utils::create_and_fill_tensor(kPrecision, kShape, range, startFrom, 1, seed);
 
@@ -230,6 +240,7 @@ private:
 
 private:
     int64_t axis;
+    int64_t minDynamicK;
     SortType sort;
     bool stable;
     size_t inferRequestNum = 0;
@@ -427,6 +438,132 @@ INSTANTIATE_TEST_CASE_P(smoke_Top1_dynamic, TopKLayerCPUTest,
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+const std::vector<int64_t> k_radix_select = {16, 100, 500};
+
+std::vector<ov::test::InputShape> inputShapes_radix_select = {
+    {{}, {{1, 1, 1, 50000}}},  // a single row is split between the threads
+    {{}, {{2, 3, 2, 5000}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_radix_select = {
+    {{1, {1, 3}, 1, {4096, 50000}}, {{1, 1, 1, 50000}, {1, 3, 1, 4096}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::Values(ElementType::f32, ElementType::i32),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_radix_select)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_radix_select_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_radix_select),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_radix_select)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+/* Compares the radix select with the sorting algorithms (CPU_TOPK_RADIX_SELECT=NO) on the vocabulary sized axes:
+ * the real time of the TopK node is reported for both, the results must be the same.
+ * The values are distinct, so the indices are compared exactly.
+ */
+using TopKRadixSelectBenchmarkParams = std::tuple<ov::Shape,   // input shape, the axis is the last one
+                                                  int64_t>;    // keepK
+
+class TopKRadixSelectBenchmark : public testing::WithParamInterface<TopKRadixSelectBenchmarkParams>,
+                                 public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TopKRadixSelectBenchmarkParams>& obj) {
+        ov::Shape shape;
+        int64_t keepK;
+        std::tie(shape, keepK) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(shape) << "_k=" << keepK;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t iterations = 20;
+
+    // returns the average real time of the TopK node in microseconds
+    static double run(const std::shared_ptr<ov::Model>& model, const ov::Tensor& input, bool radixSelect,
+                      ov::Tensor& values, ov::Tensor& indices) {
+        auto core = ov::test::utils::PluginCache::get().core();
+        auto compiledModel = core->compile_model(model, CommonTestUtils::DEVICE_CPU,
+            {ov::enable_profiling(true),
+             {InferenceEngine::PluginConfigInternalParams::KEY_CPU_TOPK_RADIX_SELECT,
+              radixSelect ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO}});
+        auto req = compiledModel.create_infer_request();
+        req.set_input_tensor(input);
+        req.infer();  // warm-up
+
+        std::chrono::microseconds total(0);
+        for (size_t i = 0; i < iterations; i++) {
+            req.infer();
+            for (const auto& info : req.get_profiling_info()) {
+                if (info.node_type == "TopK")
+                    total += info.real_time;
+            }
+        }
+        values = req.get_output_tensor(0);
+        indices = req.get_output_tensor(1);
+        return static_cast<double>(total.count()) / iterations;
+    }
+};
+
+TEST_P(TopKRadixSelectBenchmark, CompareWithSortingAlgorithms) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    ov::Shape shape;
+    int64_t keepK;
+    std::tie(shape, keepK) = GetParam();
+
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto k = ov::op::v0::Constant::create(ov::element::i64, {}, {keepK});
+    auto topk = std::make_shared<ov::op::v11::TopK>(param, k, shape.size() - 1, SortMode::MAX, SortType::SORT_VALUES,
+                                                    ov::element::i32, true);
+    auto model = std::make_shared<ov::Model>(topk->outputs(), ov::ParameterVector{param}, "TopKRadixSelect");
+
+    ov::Tensor input(ov::element::f32, shape);
+    auto data = input.data<float>();
+    std::iota(data, data + input.get_size(), 0.f);
+    std::shuffle(data, data + input.get_size(), std::mt19937(1));
+
+    ov::Tensor radixValues, radixIndices, sortValues, sortIndices;
+    const auto radixTime = run(model, input, true, radixValues, radixIndices);
+    const auto sortTime = run(model, input, false, sortValues, sortIndices);
+    std::cout << "TopK " << CommonTestUtils::vec2str(shape) << " k=" << keepK << ": radix select " << radixTime
+              << " us, sorting algorithms " << sortTime << " us" << std::endl;
+
+    ASSERT_EQ(radixValues.get_size(), sortValues.get_size());
+    for (size_t i = 0; i < radixValues.get_size(); i++) {
+        ASSERT_EQ(radixValues.data<float>()[i], sortValues.data<float>()[i]) << "element " << i;
+        ASSERT_EQ(radixIndices.data<int32_t>()[i], sortIndices.data<int32_t>()[i]) << "element " << i;
+    }
+}
+
+// beam search and sampling over the vocabulary: a few rows, the axis of 50k-250k elements, k in the hundreds
+INSTANTIATE_TEST_SUITE_P(nightly_TopK_RadixSelectBenchmark, TopKRadixSelectBenchmark,
+    ::testing::Combine(
+        ::testing::Values(ov::Shape{1, 50257}, ov::Shape{4, 50257}, ov::Shape{1, 250000}, ov::Shape{8, 250000}),
+        ::testing::Values(100, 500)),
+    TopKRadixSelectBenchmark::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
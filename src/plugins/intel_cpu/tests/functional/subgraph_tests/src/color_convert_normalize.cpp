@@ -0,0 +1,111 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/op/nv12_to_rgb.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Preprocessing chain produced by PrePostProcessor:
+ *  convert_color(RGB/BGR) -> convert_element_type(f32) -> mean() -> scale()
+ *
+ *      Parameter(u8, Y)  Parameter(u8, UV)
+ *               \           /
+ *              NV12toRGB (u8)
+ *                   |
+ *              Convert (f32)
+ *                   |
+ *         Subtract (per-channel mean)
+ *                   |
+ *        Multiply (per-channel scale)
+ *                   |
+ *                Result
+ *
+ *  Convert, Subtract and Multiply are fused into ColorConvert and executed in the same pass over the image.
+ */
+using ColorConvertNormalizeParams = std::tuple<ov::Shape,  // NHW of the output image
+                                               bool,       // NV12 (true) or I420 (false)
+                                               bool>;      // single plane
+
+class ColorConvertNormalizeCPUTest : public testing::WithParamInterface<ColorConvertNormalizeParams>,
+                                     virtual public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertNormalizeParams>& obj) {
+        ov::Shape shape;
+        bool isNV12, singlePlane;
+        std::tie(shape, isNV12, singlePlane) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(shape) << "_";
+        result << (isNV12 ? "NV12toRGB" : "I420toBGR") << "_";
+        result << (singlePlane ? "SinglePlane" : "MultiPlane");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ov::Shape shape;
+        bool isNV12, singlePlane;
+        std::tie(shape, isNV12, singlePlane) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const auto n = shape[0], h = shape[1], w = shape[2];
+        std::vector<ov::Shape> planes;
+        if (singlePlane) {
+            planes = {{n, h * 3 / 2, w, 1}};
+        } else if (isNV12) {
+            planes = {{n, h, w, 1}, {n, h / 2, w / 2, 2}};
+        } else {
+            planes = {{n, h, w, 1}, {n, h / 2, w / 2, 1}, {n, h / 2, w / 2, 1}};
+        }
+        init_input_shapes(static_shapes_to_test_representation(planes));
+
+        ov::ParameterVector params;
+        for (const auto& plane : planes)
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(element::u8, plane));
+        OutputVector inputs(params.begin(), params.end());
+        std::shared_ptr<ov::Node> colorConvert;
+        if (isNV12) {
+            colorConvert = singlePlane ? std::make_shared<ov::op::v8::NV12toRGB>(inputs[0])
+                                       : std::make_shared<ov::op::v8::NV12toRGB>(inputs[0], inputs[1]);
+        } else {
+            colorConvert = singlePlane ? std::make_shared<ov::op::v8::I420toBGR>(inputs[0])
+                                       : std::make_shared<ov::op::v8::I420toBGR>(inputs[0], inputs[1], inputs[2]);
+        }
+        auto convert = builder::makeConversion(colorConvert, element::f32, ::helpers::ConversionTypes::CONVERT);
+        auto mean = builder::makeConstant(element::f32, {1, 1, 1, 3}, std::vector<float>{123.675f, 116.28f, 103.53f});
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(convert, mean);
+        auto scale = builder::makeConstant(element::f32, {1, 1, 1, 3}, std::vector<float>{0.0171f, 0.0175f, 0.0174f});
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+
+        function = std::make_shared<ov::Model>(multiply, params, "ColorConvertNormalize");
+    }
+};
+
+TEST_P(ColorConvertNormalizeCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ColorConvert", 1);
+    CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+}
+
+namespace {
+const std::vector<ov::Shape> shapes = {
+    {1, 16, 16},
+    {2, 32, 30},  // width is not a multiple of the vector length
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertNormalize,
+                         ColorConvertNormalizeCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(shapes),
+                                            ::testing::Bool(),
+                                            ::testing::Bool()),
+                         ColorConvertNormalizeCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The dims before the concat axis are not equal to 1, so the inputs of Concat are the strided views of its output.
+ *  The Eltwise nodes write directly into the views, so Concat is executed in place without any reorders.
+ *
+ *    Parameter  Parameter   Parameter  Parameter
+ *          \     /                \     /
+ *            Add                   Multiply
+ *              \                    /
+ *                      Concat
+ *                        |
+ *                      Result
+ */
+using ConcatStridedInPlaceParams = std::tuple<int64_t,            // Concat axis
+                                              InputShape>;        // Input shape
+
+class ConcatStridedInPlaceCPUTest : public testing::WithParamInterface<ConcatStridedInPlaceParams>,
+                                    virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ConcatStridedInPlaceParams>& obj) {
+        int64_t axis;
+        InputShape inputShape;
+        std::tie(axis, inputShape) = obj.param;
+        std::ostringstream result;
+        result << "axis=" << axis << "_";
+        result << "IS=" << inputShape;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the Eltwise nodes are checked, so they are not tokenized to Subgraphs
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+        int64_t axis;
+        InputShape inputShape;
+        std::tie(axis, inputShape) = GetParam();
+        selectedType = makeSelectedTypeStr("unknown", ov::element::f32);
+        init_input_shapes({inputShape, inputShape, inputShape, inputShape});
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto add = std::make_shared<ov::opset1::Add>(params[0], params[1]);
+        const auto multiply = std::make_shared<ov::opset1::Multiply>(params[2], params[3]);
+        const auto concat = std::make_shared<ov::opset1::Concat>(ov::OutputVector{add, multiply}, axis);
+        function = std::make_shared<ov::Model>(concat, params, "ConcatStridedInPlace");
+    }
+};
+
+TEST_P(ConcatStridedInPlaceCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckPluginRelatedResults(compiledModel, "Concatenation");
+    CheckNumberOfNodesWithType(compiledModel, "Reorder", 0);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatStridedInPlace_4D, ConcatStridedInPlaceCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(1, 2, 3),
+                                 ::testing::Values(InputShape{{}, {{2, 8, 5, 7}}})),
+                         ConcatStridedInPlaceCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatStridedInPlace_3D, ConcatStridedInPlaceCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(1, 2),
+                                 ::testing::Values(InputShape{{}, {{3, 4, 35}}})),
+                         ConcatStridedInPlaceCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The eltwise chain is tokenized to a Subgraph with dynamic shapes, so the Snippet node generates
+ *  shape-agnostic kernels: one per broadcasting pattern of the input shapes. The shapes with a known pattern
+ *  take the kernel from the cache, the test checks the minimal number of such cache hits.
+ *
+ *     Parameter   Parameter
+ *          \       /
+ *            Add      Parameter
+ *              \       /
+ *              Multiply
+ *                 |
+ *               Relu
+ *                 |
+ *               Result
+ */
+using DynamicSnippetsEltwiseParams = std::tuple<std::vector<InputShape>,  // input shapes
+                                                size_t>;                  // minimal number of kernel cache hits
+
+class DynamicSnippetsEltwiseCPUTest : public testing::WithParamInterface<DynamicSnippetsEltwiseParams>,
+                                      virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicSnippetsEltwiseParams>& obj) {
+        std::vector<InputShape> shapes;
+        size_t minCacheHits;
+        std::tie(shapes, minCacheHits) = obj.param;
+        std::ostringstream result;
+        for (const auto& shape : shapes) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "minCacheHits=" << minCacheHits;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<InputShape> shapes;
+        std::tie(shapes, minCacheHits) = GetParam();
+        init_input_shapes(shapes);
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto add = std::make_shared<ov::opset1::Add>(params[0], params[1]);
+        const auto multiply = std::make_shared<ov::opset1::Multiply>(add, params[2]);
+        const auto relu = std::make_shared<ov::opset1::Relu>(multiply);
+        function = std::make_shared<ov::Model>(relu, params, "DynamicSnippetsEltwise");
+    }
+
+    size_t minCacheHits = 0;
+};
+
+TEST_P(DynamicSnippetsEltwiseCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    const auto cacheHits =
+        compiledModel.get_property(InferenceEngine::PluginConfigInternalParams::KEY_CPU_SNIPPETS_KERNEL_CACHE_HITS).as<int>();
+    ASSERT_GE(static_cast<size_t>(cacheHits), minCacheHits);
+}
+
+namespace {
+const std::vector<DynamicSnippetsEltwiseParams> inputShapes = {
+    // the work amounts with and without tails, the same broadcasting pattern for all the shapes,
+    // so the kernel generated for the first shapes is used by the other ones
+    {
+        {
+            {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 5, 7, 17}, {1, 1, 1, 3}, {1, 3, 16, 16}}},
+            {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 5, 7, 17}, {1, 1, 1, 3}, {1, 3, 16, 16}}},
+            {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 5, 7, 17}, {1, 1, 1, 3}, {1, 3, 16, 16}}},
+        },
+        3
+    },
+    // the broadcasting pattern changes between the inferences, the pattern of the first shapes comes back at the end
+    {
+        {
+            {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 3, 10, 33}, {1, 3, 16, 16}, {2, 4, 9, 1}, {1, 3, 16, 16}}},
+            {{-1, -1, -1, -1}, {{1, 3, 16, 1}, {2, 3, 1, 33}, {1, 1, 1, 1}, {2, 4, 9, 1}, {1, 3, 16, 1}}},
+            {{-1, -1, -1}, {{3, 1, 16}, {3, 10, 33}, {3, 16, 16}, {4, 1, 1}, {3, 1, 16}}},
+        },
+        1
+    },
+    // per-channel broadcasting
+    {
+        {
+            {{1, -1, {1, 64}, {1, 64}}, {{1, 8, 5, 5}, {1, 16, 7, 3}, {1, 8, 1, 1}, {1, 8, 5, 5}}},
+            {{1, -1, 1, 1}, {{1, 8, 1, 1}, {1, 16, 1, 1}, {1, 8, 1, 1}, {1, 8, 1, 1}}},
+            {{1, -1, 1, 1}, {{1, 8, 1, 1}, {1, 16, 1, 1}, {1, 8, 1, 1}, {1, 8, 1, 1}}},
+        },
+        1
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicSnippetsEltwise, DynamicSnippetsEltwiseCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         DynamicSnippetsEltwiseCPUTest::getTestCaseName);
+}  // namespace
+
+// The kernel cache is shared by the streams: the kernel is generated by the graph of the first stream only
+TEST(SnippetsKernelCacheCPUTest, smoke_SharedByStreams) {
+    const auto params = ngraph::builder::makeParams(ov::element::f32, {{1, 3, 16, 16}, {1, 3, 16, 16}});
+    const auto add = std::make_shared<ov::opset1::Add>(params[0], params[1]);
+    const auto relu = std::make_shared<ov::opset1::Relu>(add);
+    const auto model = std::make_shared<ov::Model>(relu, params, "SnippetsKernelCache");
+
+    const size_t streams = 4;
+    ov::Core core;
+    const ov::AnyMap config = {ov::num_streams(streams),
+                               {InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                                InferenceEngine::PluginConfigInternalParams::IGNORE_CALLBACK}};
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    const auto cacheHits =
+        compiledModel.get_property(InferenceEngine::PluginConfigInternalParams::KEY_CPU_SNIPPETS_KERNEL_CACHE_HITS).as<int>();
+    ASSERT_GE(static_cast<size_t>(cacheHits), streams - 1);
+}
+}  // namespace SubgraphTestsDefinitions
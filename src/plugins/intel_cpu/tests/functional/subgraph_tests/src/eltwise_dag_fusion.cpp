@@ -0,0 +1,134 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Eltwise DAGs which are executed as a single Eltwise node:
+ *
+ *  SharedInput:         Diamond:                  SameChild:          Reshape:
+ *
+ *   x                    a   b                     a   b               x
+ *   | \                   \ /                       \ /                |
+ *   |  Tanh               Add                       Add             Sigmoid
+ *   | /                   |  \                      | |                |
+ *   Multiply   r          |  Tanh                  Multiply         Reshape   r
+ *       \     /           | /                                           \    /
+ *         Add            Multiply                                        Add
+ */
+enum class EltwiseDagType { SharedInput, Diamond, SameChild, Reshape };
+
+std::ostream& operator<<(std::ostream& os, EltwiseDagType type) {
+    switch (type) {
+        case EltwiseDagType::SharedInput: return os << "SharedInput";
+        case EltwiseDagType::Diamond: return os << "Diamond";
+        case EltwiseDagType::SameChild: return os << "SameChild";
+        case EltwiseDagType::Reshape: return os << "Reshape";
+    }
+    return os;
+}
+
+using EltwiseDagFusionParams = std::tuple<InputShape,        // input shape
+                                          EltwiseDagType>;   // pattern
+
+class EltwiseDagFusionCPUTest : public testing::WithParamInterface<EltwiseDagFusionParams>,
+                                virtual public SubgraphBaseTest,
+                                public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EltwiseDagFusionParams>& obj) {
+        InputShape inputShape;
+        EltwiseDagType type;
+        std::tie(inputShape, type) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << CommonTestUtils::vec2str(shape) << "_";
+        result << "Pattern=" << type;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape inputShape;
+        EltwiseDagType type;
+        std::tie(inputShape, type) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+
+        // the reshape pattern is static only: the residual input is flattened in the spatial dimensions
+        InputShape secondShape = inputShape;
+        if (type == EltwiseDagType::Reshape) {
+            const auto& shape = inputShape.second.front();
+            secondShape = {{}, {{shape[0], shape[1], ov::shape_size(shape) / (shape[0] * shape[1])}}};
+        }
+        init_input_shapes({inputShape, secondShape});
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+
+        std::shared_ptr<ov::Node> result;
+        switch (type) {
+            case EltwiseDagType::SharedInput: {
+                auto tanh = std::make_shared<ov::op::v0::Tanh>(params[0]);
+                auto mul = std::make_shared<ov::op::v1::Multiply>(params[0], tanh);
+                result = std::make_shared<ov::op::v1::Add>(mul, params[1]);
+                break;
+            }
+            case EltwiseDagType::Diamond: {
+                auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+                auto tanh = std::make_shared<ov::op::v0::Tanh>(add);
+                result = std::make_shared<ov::op::v1::Multiply>(add, tanh);
+                break;
+            }
+            case EltwiseDagType::SameChild: {
+                auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+                result = std::make_shared<ov::op::v1::Multiply>(add, add);
+                break;
+            }
+            case EltwiseDagType::Reshape: {
+                auto sigmoid = std::make_shared<ov::op::v0::Sigmoid>(params[0]);
+                const auto& shape = targetStaticShapes.front()[1];
+                auto target = std::make_shared<ov::op::v0::Constant>(element::i64, ov::Shape{shape.size()}, shape);
+                auto reshape = std::make_shared<ov::op::v1::Reshape>(sigmoid, target, false);
+                result = std::make_shared<ov::op::v1::Add>(reshape, params[1]);
+                break;
+            }
+        }
+        function = std::make_shared<ov::Model>(result, params, "EltwiseDagFusion");
+    }
+};
+
+TEST_P(EltwiseDagFusionCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 1);
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 3, 16, 16}}},
+    {{-1, 3, -1, 16}, {{1, 3, 16, 16}, {2, 3, 5, 16}, {1, 3, 16, 16}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EltwiseDagFusion,
+                         EltwiseDagFusionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(EltwiseDagType::SharedInput,
+                                                              EltwiseDagType::Diamond,
+                                                              EltwiseDagType::SameChild)),
+                         EltwiseDagFusionCPUTest::getTestCaseName);
+
+// the Reshape is moved after the Add, so Sigmoid and Add are fused
+INSTANTIATE_TEST_SUITE_P(smoke_EltwiseDagFusion_Reshape,
+                         EltwiseDagFusionCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 3, 16, 16}}}),
+                                            ::testing::Values(EltwiseDagType::Reshape)),
+                         EltwiseDagFusionCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
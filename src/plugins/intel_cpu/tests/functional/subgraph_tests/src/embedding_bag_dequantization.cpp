@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset3.hpp>
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Embedding table quantized per row:
+ *
+ *      Constant (i8/u8, table)
+ *               |
+ *          Convert (f32)
+ *               |
+ *     [Subtract (per-row zero points)]
+ *               |
+ *     Multiply (per-row scales)      Constant (indices)      Parameter (per sample weights)
+ *                          \                 |                 /
+ *                                 EmbeddingBagPackedSum
+ *                                            |
+ *                                          Result
+ *
+ *  The table stays in int8/uint8, Convert, Subtract and Multiply are fused into EmbeddingBagPackedSum
+ *  and each row is dequantized while it's accumulated.
+ */
+using EmbeddingBagDequantizationParams = std::tuple<ov::Shape,      // embedding table shape
+                                                    ElementType,    // table precision
+                                                    bool>;          // with zero points
+
+class EmbeddingBagDequantizationCPUTest : public testing::WithParamInterface<EmbeddingBagDequantizationParams>,
+                                          virtual public SubgraphBaseTest,
+                                          public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EmbeddingBagDequantizationParams>& obj) {
+        ov::Shape shape;
+        ElementType tablePrecision;
+        bool withZeroPoints;
+        std::tie(shape, tablePrecision, withZeroPoints) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(shape) << "_";
+        result << "tablePRC=" << tablePrecision << "_";
+        result << "ZP=" << withZeroPoints;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        ov::Shape shape;
+        ElementType tablePrecision;
+        bool withZeroPoints;
+        std::tie(shape, tablePrecision, withZeroPoints) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        const std::vector<std::vector<size_t>> indices = {{0, 2, 7}, {5, 5, 1}, {3, 6, 4}, {7, 0, 2}};
+        const ov::Shape weightsShape = {indices.size(), indices[0].size()};
+        init_input_shapes(static_shapes_to_test_representation({weightsShape}));
+
+        auto weights = std::make_shared<ov::op::v0::Parameter>(element::f32, weightsShape);
+        ov::Shape rowShape(shape.size(), 1);
+        rowShape[0] = shape[0];
+        std::shared_ptr<ov::Node> table = builder::makeConstant<int>(tablePrecision, shape, {}, true, 120, 0);
+        table = builder::makeConversion(table, element::f32, ::helpers::ConversionTypes::CONVERT);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, rowShape, {}, true, 10.f, -10.f);
+            table = std::make_shared<ov::op::v1::Subtract>(table, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, rowShape, {}, true, 0.1f, 0.01f);
+        table = std::make_shared<ov::op::v1::Multiply>(table, scales);
+
+        std::vector<size_t> flatIndices;
+        for (const auto& bag : indices)
+            flatIndices.insert(flatIndices.end(), bag.begin(), bag.end());
+        auto indicesNode = std::make_shared<ov::op::v0::Constant>(element::i32, weightsShape, flatIndices);
+        auto embBag = std::make_shared<ov::opset3::EmbeddingBagPackedSum>(table, indicesNode, weights);
+
+        function = std::make_shared<ov::Model>(embBag, ov::ParameterVector{weights}, "EmbeddingBagDequantization");
+    }
+};
+
+TEST_P(EmbeddingBagDequantizationCPUTest, CompareWithRefs) {
+    run();
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNumberOfNodesWithType(compiledModel, "EmbeddingBagPackedSum", 1);
+        CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+    }
+}
+
+namespace {
+const std::vector<ov::Shape> shapes = {
+    {8, 64},
+    {8, 3, 30},  // row size is not a multiple of the vector length
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagDequantization,
+                         EmbeddingBagDequantizationCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(shapes),
+                                            ::testing::Values(ElementType::i8, ElementType::u8),
+                                            ::testing::Bool()),
+                         EmbeddingBagDequantizationCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,203 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Compressed weights decompressed per output channel or per group of input channels:
+ *
+ *                    Constant (u8/i8/u4, weights [N, K] or [N, G, K / G])
+ *                               |
+ *                          Convert (f32)
+ *                               |
+ *                    [Subtract (zero points)]
+ *                               |
+ *                       Multiply (scales)
+ *                               |
+ *                   [Reshape [N, K], grouped only]
+ *                               |
+ *      Parameter           /
+ *              \          /
+ *                 MatMul
+ *                   |
+ *      [Multiply (per channel), Relu]
+ *                   |
+ *                 Result
+ *
+ *  The weights stay compressed, Convert, Subtract and Multiply are fused into FullyConnected
+ *  and the weights are decompressed in the kernel. The post-ops are fused into the same FullyConnected.
+ */
+using FCWeightsDecompressionParams = std::tuple<InputShape,     // activations shape
+                                                ov::Shape,      // weights shape
+                                                ElementType,    // weights precision
+                                                bool,           // transpose weights
+                                                bool,           // with zero points
+                                                bool,           // with post-ops
+                                                ElementType>;   // inference precision
+
+class FCWeightsDecompressionCPUTest : public testing::WithParamInterface<FCWeightsDecompressionParams>,
+                                      virtual public SubgraphBaseTest,
+                                      public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FCWeightsDecompressionParams>& obj) {
+        InputShape inputShape;
+        ov::Shape weightsShape;
+        ElementType weightsPrecision;
+        bool transposeB, withZeroPoints, withPostOps;
+        ElementType inferencePrecision;
+        std::tie(inputShape, weightsShape, weightsPrecision, transposeB, withZeroPoints, withPostOps, inferencePrecision) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << CommonTestUtils::vec2str(shape) << "_";
+        result << "WS=" << CommonTestUtils::vec2str(weightsShape) << "_";
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "ZP=" << withZeroPoints << "_";
+        result << "postOps=" << withPostOps << "_";
+        result << "inferPRC=" << inferencePrecision;
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ov::Node> makeWeights(ElementType precision, const ov::Shape& shape) {
+        if (precision == ElementType::u4) {
+            std::vector<uint8_t> values(ov::shape_size(shape));
+            for (size_t i = 0; i < values.size(); i++)
+                values[i] = static_cast<uint8_t>((i * 7 + 3) % 16);
+            return std::make_shared<ov::op::v0::Constant>(precision, shape, values);
+        }
+        if (precision == ElementType::i8)
+            return builder::makeConstant<int>(precision, shape, {}, true, 127, -128);
+        return builder::makeConstant<int>(precision, shape, {}, true, 255, 0);
+    }
+
+    void SetUp() override {
+        InputShape inputShape;
+        ov::Shape weightsShape;
+        ElementType weightsPrecision;
+        bool transposeB, withZeroPoints, withPostOps;
+        ElementType inferencePrecision;
+        std::tie(inputShape, weightsShape, weightsPrecision, transposeB, withZeroPoints, withPostOps, inferencePrecision) =
+            this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::hint::inference_precision(inferencePrecision));
+        if (inferencePrecision == ElementType::bf16) {
+            abs_threshold = 5e-2f;
+            rel_threshold = 2e-2f;
+        } else {
+            abs_threshold = 1e-2f;
+            rel_threshold = 1e-4f;
+        }
+
+        init_input_shapes({inputShape});
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+
+        const bool grouped = weightsShape.size() == 3;
+        ov::Shape decompressionShape(weightsShape.size(), 1);
+        if (grouped) {
+            decompressionShape[0] = weightsShape[0];
+            decompressionShape[1] = weightsShape[1];
+        } else {
+            decompressionShape[transposeB ? 0 : 1] = weightsShape[transposeB ? 0 : 1];
+        }
+
+        std::shared_ptr<ov::Node> weights = makeWeights(weightsPrecision, weightsShape);
+        weights = builder::makeConversion(weights, element::f32, ::helpers::ConversionTypes::CONVERT);
+        if (withZeroPoints) {
+            auto zeroPoints = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 8.f, 0.f);
+            weights = std::make_shared<ov::op::v1::Subtract>(weights, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, decompressionShape, {}, true, 0.01f, 0.001f);
+        weights = std::make_shared<ov::op::v1::Multiply>(weights, scales);
+        if (grouped) {
+            const std::vector<int64_t> targetShape = {static_cast<int64_t>(weightsShape[0]),
+                                                      static_cast<int64_t>(weightsShape[1] * weightsShape[2])};
+            auto shapeNode = std::make_shared<ov::op::v0::Constant>(element::i64, ov::Shape{2}, targetShape);
+            weights = std::make_shared<ov::op::v1::Reshape>(weights, shapeNode, false);
+        }
+
+        std::shared_ptr<ov::Node> output = std::make_shared<ov::op::v0::MatMul>(params[0], weights, false, transposeB);
+        if (withPostOps) {
+            const size_t channels = weightsShape[transposeB ? 0 : 1];
+            auto channelScales = builder::makeConstant<float>(element::f32, ov::Shape{channels}, {}, true, 2.f, 0.5f);
+            output = std::make_shared<ov::op::v1::Multiply>(output, channelScales);
+            output = std::make_shared<ov::op::v0::Relu>(output);
+        }
+        function = std::make_shared<ov::Model>(output, params, "FCWeightsDecompression");
+    }
+};
+
+TEST_P(FCWeightsDecompressionCPUTest, CompareWithRefs) {
+    if (std::get<6>(GetParam()) == ElementType::bf16 && !InferenceEngine::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+    run();
+    // without AVX2 the decompression is not kept and it's constant folded
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    CheckNumberOfNodesWithTypes(compiledModel, {"Convert", "Eltwise", "Subgraph"}, 0);
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{1, 64}}},
+    {{}, {{3, 5, 64}}},
+    {{-1, 64}, {{1, 64}, {7, 64}, {2, 64}}},
+    // the inputs with many rows reuse the weights of a tile unpacked once by a thread
+    {{}, {{300, 64}}},
+    {{-1, 64}, {{1, 64}, {300, 64}, {2, 64}}},
+};
+
+// the number of output channels is not a multiple of the block
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_PerChannel,
+                         FCWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{40, 64}),
+                                            ::testing::Values(ElementType::u8, ElementType::i8, ElementType::u4),
+                                            ::testing::Values(true),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::f32)),
+                         FCWeightsDecompressionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_NotTransposed,
+                         FCWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{64, 40}),
+                                            ::testing::Values(ElementType::u8, ElementType::u4),
+                                            ::testing::Values(false),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::f32)),
+                         FCWeightsDecompressionCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_Grouped,
+                         FCWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{40, 4, 16}),
+                                            ::testing::Values(ElementType::u8, ElementType::i8, ElementType::u4),
+                                            ::testing::Values(true),
+                                            ::testing::Bool(),
+                                            ::testing::Values(false),
+                                            ::testing::Values(ElementType::f32)),
+                         FCWeightsDecompressionCPUTest::getTestCaseName);
+
+// the post-ops are applied to each output tile, the bf16 activations and output are read and written as is
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsDecompression_PostOps,
+                         FCWeightsDecompressionCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(ov::Shape{40, 64}),
+                                            ::testing::Values(ElementType::u8),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(true),
+                                            ::testing::Values(ElementType::f32, ElementType::bf16)),
+                         FCWeightsDecompressionCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
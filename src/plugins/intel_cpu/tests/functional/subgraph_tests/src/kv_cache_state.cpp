@@ -0,0 +1,178 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset6.hpp>
+#include <openvino/op/util/variable.hpp>
+#include <numeric>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ov;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Key/value cache of autoregressive decoding:
+ *
+ *     ReadValue (init: Constant with no elements)     Parameter (new tokens)
+ *                               \                       /
+ *                                 Concat (sequence axis)
+ *                                   |               |
+ *                                 Assign      Multiply (2.f) or MatMul (the state by the transposed state)
+ *                                                   |
+ *                                                 Result
+ *
+ *  ReadValue, Concat and Assign are fused: the new tokens are appended to the state in place.
+ *  MatMul accepts any batch strides, so it reads the state right from its store without a reorder.
+ */
+struct KVCacheStateParamType {
+    PartialShape shape;
+    size_t axis;
+    bool matmul;
+};
+
+class KVCacheStateCPUTest : public ::testing::TestWithParam<KVCacheStateParamType> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<KVCacheStateParamType> obj) {
+        std::ostringstream result;
+        result << "shape=" << obj.param.shape << "_";
+        result << "axis=" << obj.param.axis << "_";
+        result << "consumer=" << (obj.param.matmul ? "MatMul" : "Multiply");
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<Model> createModel(const PartialShape& shape, size_t axis, bool matmul) {
+        auto param = std::make_shared<opset6::Parameter>(element::f32, shape);
+
+        auto initShape = shape.get_min_shape();
+        initShape[axis] = 0;
+        auto init = opset6::Constant::create(element::f32, initShape, std::vector<float>{});
+        auto variable = std::make_shared<op::util::Variable>(op::util::VariableInfo{shape, element::f32, "kv_cache"});
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto concat = std::make_shared<opset6::Concat>(OutputVector{readValue, param}, axis);
+        auto assign = std::make_shared<opset6::Assign>(concat, variable);
+        std::shared_ptr<Node> consumer;
+        if (matmul) {
+            consumer = std::make_shared<opset6::MatMul>(concat, concat, false, true);
+        } else {
+            auto scale = opset6::Constant::create(element::f32, {1}, {2.f});
+            consumer = std::make_shared<opset6::Multiply>(concat, scale);
+        }
+        auto result = std::make_shared<opset6::Result>(consumer);
+
+        return std::make_shared<Model>(ResultVector{result}, SinkVector{assign}, ParameterVector{param});
+    }
+
+    // concatenation of the tokens along the axis, multiplied by 2 or by itself transposed
+    static std::vector<float> reference(const std::vector<std::vector<float>>& tokens,
+                                        const std::vector<Shape>& shapes,
+                                        size_t axis,
+                                        bool matmul) {
+        const auto& shape = shapes.front();
+        const size_t outer = shape_size(Shape(shape.begin(), shape.begin() + axis));
+        const size_t inner = shape_size(Shape(shape.begin() + axis + 1, shape.end()));
+        std::vector<float> state;
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t t = 0; t < tokens.size(); t++) {
+                const size_t rowSize = shapes[t][axis] * inner;
+                for (size_t i = 0; i < rowSize; i++)
+                    state.push_back(tokens[t][o * rowSize + i]);
+            }
+        }
+        if (!matmul) {
+            for (auto& value : state)
+                value *= 2.f;
+            return state;
+        }
+
+        // the state is [outer][length][inner] with the inner dimension being the last one
+        const size_t length = state.size() / (outer * inner);
+        std::vector<float> expected;
+        for (size_t o = 0; o < outer; o++) {
+            const float* matrix = state.data() + o * length * inner;
+            for (size_t i = 0; i < length; i++) {
+                for (size_t j = 0; j < length; j++) {
+                    float sum = 0.f;
+                    for (size_t k = 0; k < inner; k++)
+                        sum += matrix[i * inner + k] * matrix[j * inner + k];
+                    expected.push_back(sum);
+                }
+            }
+        }
+        return expected;
+    }
+
+    void Run() {
+        const auto& shape = GetParam().shape;
+        const auto axis = GetParam().axis;
+        const auto matmul = GetParam().matmul;
+        std::shared_ptr<Core> core = ov::test::utils::PluginCache::get().core();
+        // the sums of the integer products are exact in f32
+        auto compiledModel = core->compile_model(createModel(shape, axis, matmul), "CPU",
+                                                 ov::hint::inference_precision(element::f32));
+        auto req = compiledModel.create_infer_request();
+
+        // prompt and then single tokens, the state grows past the initial reservation several times
+        const std::vector<size_t> lengths = {5, 1, 1, 3, 1, 1, 1, 1, 7, 1};
+        std::vector<std::vector<float>> tokens;
+        std::vector<Shape> shapes;
+        for (size_t step = 0; step < lengths.size(); step++) {
+            auto tokenShape = shape.get_min_shape();
+            tokenShape[axis] = lengths[step];
+            std::vector<float> data(shape_size(tokenShape));
+            for (size_t i = 0; i < data.size(); i++)
+                data[i] = static_cast<float>(step * 100 + i);
+            tokens.push_back(data);
+            shapes.push_back(tokenShape);
+
+            req.set_input_tensor(Tensor(element::f32, tokenShape, data.data()));
+            req.infer();
+
+            const auto expected = reference(tokens, shapes, axis, matmul);
+            const auto actual = req.get_output_tensor();
+            ASSERT_EQ(actual.get_size(), expected.size());
+            for (size_t i = 0; i < expected.size(); i++)
+                ASSERT_EQ(actual.data<float>()[i], expected[i]) << "step " << step << ", element " << i;
+        }
+
+        auto states = req.query_state();
+        ASSERT_EQ(states.size(), 1);
+        auto stateShape = shapes.front();
+        stateShape[axis] = std::accumulate(lengths.begin(), lengths.end(), size_t(0));
+        ASSERT_EQ(states.front().get_state().get_shape(), stateShape);
+
+        // the next sequence starts with the empty state
+        states.front().reset();
+        req.set_input_tensor(Tensor(element::f32, shapes.back(), tokens.back().data()));
+        req.infer();
+        const auto expected = reference({tokens.back()}, {shapes.back()}, axis, matmul);
+        const auto actual = req.get_output_tensor();
+        ASSERT_EQ(actual.get_size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_EQ(actual.data<float>()[i], expected[i]) << "after reset, element " << i;
+
+        CheckNumberOfNodesWithType(compiledModel, "Concatenation", 0);
+        CheckNumberOfNodesWithType(compiledModel, "Reorder", 0);
+    }
+};
+
+TEST_P(KVCacheStateCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+namespace {
+const std::vector<KVCacheStateParamType> params = {
+    { PartialShape{1, Dimension::dynamic(), 4}, 1, false },
+    { PartialShape{2, 3, Dimension::dynamic(), 4}, 2, false },  // the state is stored with a margin in each of the outer rows
+    { PartialShape{1, Dimension::dynamic(), 4}, 1, true },
+    { PartialShape{2, 3, Dimension::dynamic(), 4}, 2, true },   // MatMul reads the strided view of the store
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_KVCacheState,
+                         KVCacheStateCPUTest,
+                         ::testing::ValuesIn(params),
+                         KVCacheStateCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
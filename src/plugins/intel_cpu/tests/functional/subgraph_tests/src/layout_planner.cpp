@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The greedy selection keeps the planar layout of the input for Relu, so each Convolution gets its own reorder
+ *  to the blocked layout. The layout planner selects the blocked layout for Relu instead and leaves a single reorder
+ *  after the Parameter. The reorders before the Results are needed in both cases.
+ *
+ *                 Parameter
+ *                     |
+ *                   Relu
+ *              /      |      \
+ *      Convolution Convolution Convolution
+ *             |       |       |
+ *          Result   Result   Result
+ */
+using LayoutPlannerParams = std::tuple<InputShape,  // input shape
+                                       bool>;       // layout planner enabled
+
+class LayoutPlannerCPUTest : public testing::WithParamInterface<LayoutPlannerParams>,
+                             virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayoutPlannerParams>& obj) {
+        InputShape inputShape;
+        bool planner;
+        std::tie(inputShape, planner) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << inputShape << "_";
+        result << "planner=" << planner;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape inputShape;
+        bool planner;
+        std::tie(inputShape, planner) = GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // Relu is kept as a separate node to be planned
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_LAYOUT_PLANNER,
+                              planner ? InferenceEngine::PluginConfigParams::YES : InferenceEngine::PluginConfigParams::NO});
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        init_input_shapes({inputShape});
+        const size_t channels = inputDynamicShapes.front()[1].get_length();
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto relu = std::make_shared<ov::opset1::Relu>(params[0]);
+        ov::ResultVector results;
+        for (size_t i = 0; i < convolutions; i++) {
+            const auto conv = ngraph::builder::makeConvolution(relu, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                               ov::op::PadType::EXPLICIT, channels);
+            results.push_back(std::make_shared<ov::opset1::Result>(conv));
+        }
+        function = std::make_shared<ov::Model>(results, params, "LayoutPlanner");
+    }
+
+    static constexpr size_t convolutions = 3;
+};
+
+TEST_P(LayoutPlannerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+
+    const bool planner = std::get<1>(GetParam());
+    const auto saved = compiledModel.get_property(InferenceEngine::PluginConfigInternalParams::KEY_CPU_SAVED_REORDERS).as<int>();
+    if (planner) {
+        ASSERT_GT(saved, 0);
+        CheckNumberOfNodesWithType(compiledModel, "Reorder", 1 + convolutions);
+    } else {
+        ASSERT_EQ(saved, 0);
+        CheckNumberOfNodesWithType(compiledModel, "Reorder", 2 * convolutions);
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_LayoutPlanner, LayoutPlannerCPUTest,
+                         ::testing::Combine(::testing::Values(InputShape{{}, {{1, 16, 10, 10}}},
+                                                              InputShape{{}, {{2, 32, 7, 7}}}),
+                                            ::testing::Bool()),
+                         LayoutPlannerCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -149,6 +149,84 @@ static std::shared_ptr<ov::Model> initMHASubgraph1(std::vector<ov::PartialShape>
     return std::make_shared<ngraph::Function>(results, ngraphParam, "mha");
 }
 
+/* The elementwise consumers of MatMul0 are fused into brgemm epilogue: the mask Add as bias, the scale and Tanh as post-ops.
+ * The optional per-tensor FakeQuantize after Tanh is decomposed and fused as clip, linear and round post-ops
+ *  Transpose0 Transpose1
+ *        \     /
+ *        MatMul0   Mask
+ *            \     /
+ *              Add
+ *               |
+ *        Multiply(scalar)
+ *               |
+ *             Tanh
+ *               |
+ *        [FakeQuantize]
+ *               |
+ *            Softmax  Transpose2
+ *                 \     /
+ *                 MatMul1
+ *                    |
+ *                Transpose3
+ */
+static std::shared_ptr<ov::Model> initMHAEpilogueSubgraph(std::vector<ov::PartialShape>& inputDynamicShapes,
+                                                          std::vector<ElementType>& inputPrecisions,
+                                                          bool withFakeQuantize) {
+    ngraph::ParameterVector ngraphParam;
+    for (size_t i = 0; i < inputDynamicShapes.size(); ++i)
+        ngraphParam.push_back(std::make_shared<ngraph::opset1::Parameter>(inputPrecisions[i], inputDynamicShapes[i]));
+
+    const auto rank = ov::Shape{inputDynamicShapes[0].size()};
+    const auto transpose0Const = ngraph::builder::makeConstant(ElementType::i64, rank, std::vector<int64_t>{0, 2, 1, 3});
+    const auto transpose1Const = ngraph::builder::makeConstant(ElementType::i64, rank, std::vector<int64_t>{0, 2, 3, 1});
+    const auto transpose2Const = ngraph::builder::makeConstant(ElementType::i64, rank, std::vector<int64_t>{0, 2, 1, 3});
+    const auto transpose3Const = ngraph::builder::makeConstant(ElementType::i64, rank, std::vector<int64_t>{0, 2, 1, 3});
+    const auto scaleConst = ngraph::builder::makeConstant(inputPrecisions[2], ov::Shape{1}, std::vector<float>{0.125f});
+
+    const auto transpose0 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[0], transpose0Const);
+    const auto transpose1 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[1], transpose1Const);
+    const auto matMul0 = std::make_shared<ngraph::opset3::MatMul>(transpose0, transpose1);
+    const auto add = std::make_shared<ngraph::opset3::Add>(matMul0, ngraphParam[2]);
+    const auto scale = std::make_shared<ngraph::opset3::Multiply>(add, scaleConst);
+    std::shared_ptr<ov::Node> epilogue = std::make_shared<ngraph::opset1::Tanh>(scale);
+    if (withFakeQuantize)
+        epilogue = ngraph::builder::makeFakeQuantize(epilogue, inputPrecisions[2], 256, {}, {-1.f}, {1.f}, {-1.f}, {1.f});
+    const auto softMax = std::make_shared<ngraph::opset1::Softmax>(epilogue, 3);
+    const auto transpose2 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[3], transpose2Const);
+    const auto matMul1 = std::make_shared<ngraph::opset3::MatMul>(softMax, transpose2);
+    const auto transpose3 = std::make_shared<ov::op::v1::Transpose>(matMul1, transpose3Const);
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(transpose3)};
+    return std::make_shared<ngraph::Function>(results, ngraphParam, "mha");
+}
+
+static std::shared_ptr<ov::Model> initMHADynamicSubgraph(std::vector<ov::PartialShape>& inputDynamicShapes,
+                                                         std::vector<ElementType>& inputPrecisions) {
+    ngraph::ParameterVector ngraphParam;
+    for (size_t i = 0; i < 4; i++) {
+        ngraphParam.push_back(std::make_shared<ngraph::opset1::Parameter>(inputPrecisions[i], inputDynamicShapes[i]));
+    }
+
+    auto transpose0Const = ngraph::builder::makeConstant(ElementType::i64, ov::Shape{4}, std::vector<int64_t>{0, 2, 1, 3});
+    auto transpose1Const = ngraph::builder::makeConstant(ElementType::i64, ov::Shape{4}, std::vector<int64_t>{0, 2, 3, 1});
+    auto transpose2Const = ngraph::builder::makeConstant(ElementType::i64, ov::Shape{4}, std::vector<int64_t>{0, 2, 1, 3});
+    auto transpose3Const = ngraph::builder::makeConstant(ElementType::i64, ov::Shape{4}, std::vector<int64_t>{0, 2, 1, 3});
+    auto mulConst = ngraph::builder::makeConstant(inputPrecisions[0], ov::Shape{1}, std::vector<float>{0.125f});
+
+    const auto transpose0 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[0], transpose0Const);
+    const auto transpose1 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[1], transpose1Const);
+    const auto matMul0 = std::make_shared<ngraph::opset3::MatMul>(transpose0, transpose1);
+    const auto mul = std::make_shared<ngraph::opset3::Multiply>(matMul0, mulConst);
+    const auto add = std::make_shared<ngraph::opset3::Add>(mul, ngraphParam[2]);
+    const auto softMax = std::make_shared<ngraph::opset1::Softmax>(add, 3);
+    const auto transpose2 = std::make_shared<ov::op::v1::Transpose>(ngraphParam[3], transpose2Const);
+    const auto matMul1 = std::make_shared<ngraph::opset3::MatMul>(softMax, transpose2);
+    const auto transpose3 = std::make_shared<ov::op::v1::Transpose>(matMul1, transpose3Const);
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(transpose3)};
+    return std::make_shared<ngraph::Function>(results, ngraphParam, "mha");
+}
+
 class MHATest : public testing::WithParamInterface<MHATuple>,
                          virtual public SubgraphBaseTest, public CPUTestsBase {
 public:
@@ -208,6 +286,10 @@ protected:
             function = initMHASubgraph0(inputDynamicShapes, inputPrecisions);
         } else if (patternType == 1) {
             function = initMHASubgraph1(inputDynamicShapes, inputPrecisions);
+        } else if (patternType == 2) {
+            function = initMHADynamicSubgraph(inputDynamicShapes, inputPrecisions);
+        } else if (patternType == 3 || patternType == 4) {
+            function = initMHAEpilogueSubgraph(inputDynamicShapes, inputPrecisions, patternType == 4);
         } else {
             FAIL() << "Unsupported MHA pattern type";
         }
@@ -246,6 +328,11 @@ TEST_P(MHATest, CompareWithRefs) {
 
     run();
     CheckNumberOfNodesWithType(compiledModel, expectedNode, 1);
+    if (patternType == 3 || patternType == 4) {
+        // The epilogue ops must be fused into the MHA Subgraph instead of being executed by separate nodes
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+        CheckNumberOfNodesWithType(compiledModel, "FakeQuantize", 0);
+    }
 }
 
 namespace {
@@ -288,6 +375,44 @@ INSTANTIATE_TEST_SUITE_P(smoke_MHA, MHATest,
                                  ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                          MHATest::getTestCaseName);
 
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_MHA_Epilogue, MHATest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(static_shapes_to_test_representation(inputShapes)),
+                                 ::testing::Values(std::vector<ElementType>{ ElementType::f32, ElementType::f32, ElementType::f32, ElementType::f32 }),
+                                 ::testing::ValuesIn(matMulIn0Precisions),
+                                 ::testing::Values(3, 4),
+                                 ::testing::Values("Subgraph"),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         MHATest::getTestCaseName);
+
+std::vector<std::vector<InputShape>> inputShapesDynamic = {
+    // causal mask, sequence lengths cover single keys block, several blocks and the blocks tail
+    {
+        {{-1, -1, 4, 64}, {{1, 20, 4, 64}, {2, 300, 4, 64}, {1, 512, 4, 64}}},
+        {{-1, -1, 4, 64}, {{1, 20, 4, 64}, {2, 300, 4, 64}, {1, 512, 4, 64}}},
+        {{1, 1, -1, -1}, {{1, 1, 20, 20}, {1, 1, 300, 300}, {1, 1, 512, 512}}},
+        {{-1, -1, 4, 64}, {{1, 20, 4, 64}, {2, 300, 4, 64}, {1, 512, 4, 64}}}
+    },
+    // padding mask, long sequence is executed by the tiled implementation as well
+    {
+        {{-1, -1, 2, 32}, {{2, 16, 2, 32}, {1, 1100, 2, 32}}},
+        {{-1, -1, 2, 32}, {{2, 16, 2, 32}, {1, 1100, 2, 32}}},
+        {{-1, 1, 1, -1}, {{2, 1, 1, 16}, {1, 1, 1, 1100}}},
+        {{-1, -1, 2, 32}, {{2, 16, 2, 32}, {1, 1100, 2, 32}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Dynamic, MHATest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapesDynamic),
+                                 ::testing::Values(std::vector<ElementType>{ ElementType::f32, ElementType::f32, ElementType::f32, ElementType::f32 },
+                                                   std::vector<ElementType>{ ElementType::bf16, ElementType::bf16, ElementType::bf16, ElementType::bf16 }),
+                                 ::testing::ValuesIn(matMulIn0Precisions),
+                                 ::testing::Values(2),
+                                 ::testing::Values("MHA"),
+                                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                         MHATest::getTestCaseName);
+
 } // namespace
 
 static std::shared_ptr<ov::Model> initMHAQuantSubgraph0(std::vector<ov::PartialShape>& inputDynamicShapes, std::vector<ElementType>& inputPrecisions,
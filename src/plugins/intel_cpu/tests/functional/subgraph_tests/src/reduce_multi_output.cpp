@@ -0,0 +1,145 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Sibling reductions of the same input are merged into a single Reduce node with several outputs:
+ *
+ *  MeanVariance:                              Statistics:
+ *
+ *            Parameter                                  Parameter
+ *            /   |    \                               /     |     \
+ *           |    |   Multiply (x * x)          ReduceSum ReduceMax ReduceMin
+ *           |    |      |                          |        |         |
+ *           | ReduceMean ReduceMean              Result   Result    Result
+ *           |    |      |
+ *           |    |   Subtract (mean(x^2) - mean(x)^2)
+ *           |    |      |
+ *           |  Result Result
+ */
+enum class ReduceMultiOutputType { MeanVariance, Statistics };
+
+std::ostream& operator<<(std::ostream& os, ReduceMultiOutputType type) {
+    switch (type) {
+        case ReduceMultiOutputType::MeanVariance: return os << "MeanVariance";
+        case ReduceMultiOutputType::Statistics: return os << "Statistics";
+    }
+    return os;
+}
+
+using ReduceMultiOutputParams = std::tuple<InputShape,              // input shape
+                                           std::vector<int64_t>,    // axes
+                                           bool,                    // keep dims
+                                           ReduceMultiOutputType>;  // pattern
+
+class ReduceMultiOutputCPUTest : public testing::WithParamInterface<ReduceMultiOutputParams>,
+                                 virtual public SubgraphBaseTest,
+                                 public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ReduceMultiOutputParams>& obj) {
+        InputShape inputShape;
+        std::vector<int64_t> axes;
+        bool keepDims;
+        ReduceMultiOutputType type;
+        std::tie(inputShape, axes, keepDims, type) = obj.param;
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second)
+            result << CommonTestUtils::vec2str(shape) << "_";
+        result << "axes=" << CommonTestUtils::vec2str(axes) << "_";
+        result << "keepDims=" << keepDims << "_";
+        result << "Pattern=" << type;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        InputShape inputShape;
+        std::vector<int64_t> axes;
+        bool keepDims;
+        ReduceMultiOutputType type;
+        std::tie(inputShape, axes, keepDims, type) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+
+        init_input_shapes({inputShape});
+        auto params = builder::makeDynamicParams(element::f32, inputDynamicShapes);
+        auto axesNode = std::make_shared<ov::op::v0::Constant>(element::i64, ov::Shape{axes.size()}, axes);
+
+        ov::ResultVector results;
+        if (type == ReduceMultiOutputType::MeanVariance) {
+            auto mean = std::make_shared<ov::op::v1::ReduceMean>(params[0], axesNode, keepDims);
+            auto square = std::make_shared<ov::op::v1::Multiply>(params[0], params[0]);
+            auto meanSquare = std::make_shared<ov::op::v1::ReduceMean>(square, axesNode, keepDims);
+            auto squareMean = std::make_shared<ov::op::v1::Multiply>(mean, mean);
+            auto variance = std::make_shared<ov::op::v1::Subtract>(meanSquare, squareMean);
+            results.push_back(std::make_shared<ov::op::v0::Result>(mean));
+            results.push_back(std::make_shared<ov::op::v0::Result>(variance));
+        } else {
+            results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v1::ReduceSum>(params[0], axesNode, keepDims)));
+            results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v1::ReduceMax>(params[0], axesNode, keepDims)));
+            results.push_back(std::make_shared<ov::op::v0::Result>(std::make_shared<ov::op::v1::ReduceMin>(params[0], axesNode, keepDims)));
+        }
+        function = std::make_shared<ov::Model>(results, params, "ReduceMultiOutput");
+    }
+};
+
+TEST_P(ReduceMultiOutputCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Reduce", 1);
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    {{}, {{2, 19, 5, 37}}},
+    {{-1, 19, -1, 37}, {{2, 19, 5, 37}, {1, 19, 1, 37}, {3, 19, 7, 37}}},
+};
+
+const std::vector<std::vector<int64_t>> axes = {
+    {-1},
+    {2, 3},
+    {1, 2},
+    {0, 1, 2, 3},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReduceMultiOutput,
+                         ReduceMultiOutputCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(axes),
+                                            ::testing::Bool(),
+                                            ::testing::Values(ReduceMultiOutputType::MeanVariance,
+                                                              ReduceMultiOutputType::Statistics)),
+                         ReduceMultiOutputCPUTest::getTestCaseName);
+
+// few outputs with a large reduced dimension: the threads split the reduced dimension as well
+const std::vector<InputShape> inputShapesSplitReduced = {
+    {{}, {{2, 3, 65536}}},
+    {{-1, -1, 64}, {{1, 2048, 64}, {2, 1024, 64}}},
+};
+
+const std::vector<std::vector<int64_t>> axesSplitReduced = {
+    {-1},
+    {1},
+    {1, 2},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ReduceMultiOutput_SplitReduced,
+                         ReduceMultiOutputCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapesSplitReduced),
+                                            ::testing::ValuesIn(axesSplitReduced),
+                                            ::testing::Values(true),
+                                            ::testing::Values(ReduceMultiOutputType::MeanVariance,
+                                                              ReduceMultiOutputType::Statistics)),
+                         ReduceMultiOutputCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,99 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The identical eltwise branches are tokenized to two Subgraphs with the same body, so the second Snippet node
+ *  takes the kernel generated for the first one from the runtime cache if the shapes are the same as well.
+ *
+ *    Parameter  Parameter   Parameter  Parameter
+ *          \     /                \     /
+ *            Add                    Add
+ *             |                      |
+ *         Multiply(c)            Multiply(c)
+ *             |                      |
+ *           Relu                   Relu
+ *              \                    /
+ *                      Concat
+ *                        |
+ *                      Result
+ */
+using SnippetsKernelCacheParams = std::vector<InputShape>;
+
+class SnippetsKernelCacheCPUTest : public testing::WithParamInterface<SnippetsKernelCacheParams>,
+                                   virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsKernelCacheParams>& obj) {
+        std::ostringstream result;
+        for (const auto& shape : obj.param) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes(GetParam());
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        auto makeBranch = [](const ov::Output<ov::Node>& lhs, const ov::Output<ov::Node>& rhs) {
+            const auto add = std::make_shared<ov::opset1::Add>(lhs, rhs);
+            const auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+            const auto multiply = std::make_shared<ov::opset1::Multiply>(add, scale);
+            return std::make_shared<ov::opset1::Relu>(multiply);
+        };
+        const auto branch0 = makeBranch(params[0], params[1]);
+        const auto branch1 = makeBranch(params[2], params[3]);
+        const auto concat = std::make_shared<ov::opset1::Concat>(ov::OutputVector{branch0, branch1}, 1);
+        function = std::make_shared<ov::Model>(concat, params, "SnippetsKernelCache");
+    }
+};
+
+TEST_P(SnippetsKernelCacheCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 2);
+}
+
+namespace {
+const std::vector<SnippetsKernelCacheParams> inputShapes = {
+    // the same shapes: the kernel is shared
+    {
+        {{}, {{1, 3, 16, 16}}},
+        {{}, {{1, 3, 16, 16}}},
+        {{}, {{1, 3, 16, 16}}},
+        {{}, {{1, 3, 16, 16}}},
+    },
+    // the same body with the different shapes: each node generates its own kernel
+    {
+        {{}, {{1, 3, 16, 16}}},
+        {{}, {{1, 3, 16, 1}}},
+        {{}, {{1, 5, 16, 16}}},
+        {{}, {{1, 5, 16, 16}}},
+    },
+    // dynamic shapes: the shape-agnostic kernels are shared as well
+    {
+        {{1, -1, -1, -1}, {{1, 3, 16, 16}, {1, 2, 7, 17}}},
+        {{1, -1, -1, -1}, {{1, 3, 16, 16}, {1, 2, 7, 17}}},
+        {{1, -1, -1, -1}, {{1, 3, 16, 16}, {1, 4, 7, 17}}},
+        {{1, -1, -1, -1}, {{1, 3, 16, 16}, {1, 4, 7, 17}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsKernelCache, SnippetsKernelCacheCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         SnippetsKernelCacheCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,157 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The normalization blocks with last-axis reductions are tokenized to a single Subgraph:
+ *  the reductions are accumulated in vector registers, and the reduced values are applied in the next Loop.
+ *
+ *  RMSNorm:                          L2Norm:                            AbsMaxNorm:
+ *     Parameter                         Parameter                          Parameter
+ *      |     \                           |     \                            |     \
+ *      |    Multiply(x, x)               |    Multiply(x, x)                |     Abs
+ *      |       |                         |       |                          |      |
+ *      |    ReduceMean                   |    ReduceSum                     |    ReduceMax
+ *      |       |                         |       |                          |      |
+ *      |    Add(eps)                     |    Add(eps)                      |    Add(eps)
+ *      |       |                         |       |                          |      |
+ *      |    Power(-0.5)                  |    Power(-0.5)                   |    Power(-1)
+ *       \      /                          \      /                            \     /
+ *       Multiply                          Multiply                           Multiply
+ *          |                                 |                                  |
+ *       Multiply(gamma)                    Result                             Result
+ *          |
+ *        Result
+ *
+ *  The other blocks keep the Reduce nodes:
+ *   - MeanVarNorm: the mean of x and the mean of x * x are merged into one Reduce node, which reads x once;
+ *   - InnerAxisRMSNorm: RMSNorm over the second-to-last axis (like GroupNorm), only the last axis is tokenized.
+ */
+enum class NormType { RMSNorm, L2Norm, AbsMaxNorm, MeanVarNorm, InnerAxisRMSNorm };
+
+std::ostream& operator<<(std::ostream& os, NormType normType) {
+    switch (normType) {
+    case NormType::RMSNorm: return os << "RMSNorm";
+    case NormType::L2Norm: return os << "L2Norm";
+    case NormType::AbsMaxNorm: return os << "AbsMaxNorm";
+    case NormType::MeanVarNorm: return os << "MeanVarNorm";
+    case NormType::InnerAxisRMSNorm: return os << "InnerAxisRMSNorm";
+    }
+    return os;
+}
+
+using SnippetsReduceNormParams = std::tuple<NormType, InputShape>;
+
+class SnippetsReduceNormCPUTest : public testing::WithParamInterface<SnippetsReduceNormParams>,
+                                  virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsReduceNormParams>& obj) {
+        NormType normType;
+        InputShape inputShape;
+        std::tie(normType, inputShape) = obj.param;
+        std::ostringstream result;
+        result << normType << "_";
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& item : inputShape.second)
+            result << CommonTestUtils::vec2str(item) << "_";
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        InputShape inputShape;
+        std::tie(normType, inputShape) = GetParam();
+        init_input_shapes({inputShape});
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto axis = ov::opset1::Constant::create(ov::element::i64, ov::Shape{1},
+                                                       {normType == NormType::InnerAxisRMSNorm ? -2 : -1});
+        const auto eps = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {1e-5f});
+        const auto exponent = ov::opset1::Constant::create(ov::element::f32, ov::Shape{},
+                                                           {normType == NormType::AbsMaxNorm ? -1.f : -0.5f});
+        const auto x = params[0];
+        std::shared_ptr<ov::Node> reduced;
+        std::shared_ptr<ov::Node> centered = x;
+        switch (normType) {
+        case NormType::RMSNorm:
+        case NormType::InnerAxisRMSNorm:
+            reduced = std::make_shared<ov::opset1::ReduceMean>(std::make_shared<ov::opset1::Multiply>(x, x), axis, true);
+            break;
+        case NormType::L2Norm:
+            reduced = std::make_shared<ov::opset1::ReduceSum>(std::make_shared<ov::opset1::Multiply>(x, x), axis, true);
+            break;
+        case NormType::AbsMaxNorm:
+            reduced = std::make_shared<ov::opset1::ReduceMax>(std::make_shared<ov::opset1::Abs>(x), axis, true);
+            break;
+        case NormType::MeanVarNorm: {
+            // var = E[x * x] - E[x] ^ 2
+            const auto mean = std::make_shared<ov::opset1::ReduceMean>(x, axis, true);
+            const auto meanSquare = std::make_shared<ov::opset1::ReduceMean>(std::make_shared<ov::opset1::Multiply>(x, x), axis, true);
+            reduced = std::make_shared<ov::opset1::Subtract>(meanSquare, std::make_shared<ov::opset1::Multiply>(mean, mean));
+            centered = std::make_shared<ov::opset1::Subtract>(x, mean);
+            break;
+        }
+        }
+        const auto add = std::make_shared<ov::opset1::Add>(reduced, eps);
+        const auto power = std::make_shared<ov::opset1::Power>(add, exponent);
+        std::shared_ptr<ov::Node> norm = std::make_shared<ov::opset1::Multiply>(centered, power);
+        if (normType == NormType::RMSNorm) {
+            const auto gamma_shape = ov::Shape{static_cast<size_t>(inputDynamicShapes[0].rbegin()->get_length())};
+            const auto gamma = ngraph::builder::makeConstant<float>(ov::element::f32, gamma_shape, {}, true);
+            norm = std::make_shared<ov::opset1::Multiply>(norm, gamma);
+        }
+        function = std::make_shared<ov::Model>(norm, params, "SnippetsReduceNorm");
+    }
+
+    NormType normType = NormType::RMSNorm;
+};
+
+TEST_P(SnippetsReduceNormCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    if (normType == NormType::MeanVarNorm || normType == NormType::InnerAxisRMSNorm) {
+        CheckNumberOfNodesWithType(compiledModel, "Reduce", 1);
+    } else {
+        CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+        CheckNumberOfNodesWithType(compiledModel, "Reduce", 0);
+    }
+}
+
+namespace {
+const std::vector<InputShape> inputShapes = {
+    // the work amounts with and without tails
+    {{}, {{1, 8, 64}}},
+    {{}, {{2, 10, 17}}},
+    // a single row
+    {{}, {{1, 1, 35}}},
+    {{}, {{4, 7, 1, 128}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsReduceNorm, SnippetsReduceNormCPUTest,
+                         ::testing::Combine(
+                             ::testing::Values(NormType::RMSNorm, NormType::L2Norm, NormType::AbsMaxNorm),
+                             ::testing::ValuesIn(inputShapes)),
+                         SnippetsReduceNormCPUTest::getTestCaseName);
+
+const std::vector<InputShape> reduceNodeInputShapes = {
+    {{}, {{1, 8, 64}}},
+    {{}, {{2, 10, 17}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsReduceNorm_ReduceNode, SnippetsReduceNormCPUTest,
+                         ::testing::Combine(
+                             ::testing::Values(NormType::MeanVarNorm, NormType::InnerAxisRMSNorm),
+                             ::testing::ValuesIn(reduceNodeInputShapes)),
+                         SnippetsReduceNormCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,80 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The input of Split is in the nspc layout and the dims before the split axis are not equal to 1,
+ *  so the outputs of Split are the strided views of its input. The Eltwise nodes read directly from the views,
+ *  so Split is executed in place.
+ *
+ *           Parameter
+ *               |
+ *             Split
+ *            /     \
+ *         Relu     Relu
+ *          |         |
+ *        Result   Result
+ */
+using SplitStridedInPlaceParams = std::tuple<int64_t,            // Split axis
+                                             InputShape>;        // Input shape
+
+class SplitStridedInPlaceCPUTest : public testing::WithParamInterface<SplitStridedInPlaceParams>,
+                                   virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SplitStridedInPlaceParams>& obj) {
+        int64_t axis;
+        InputShape inputShape;
+        std::tie(axis, inputShape) = obj.param;
+        std::ostringstream result;
+        result << "axis=" << axis << "_";
+        result << "IS=" << inputShape;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the Eltwise nodes are the consumers of the views, so they are not tokenized to Subgraphs
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+        int64_t axis;
+        InputShape inputShape;
+        std::tie(axis, inputShape) = GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = CPUSpecificParams{{nhwc}, {nhwc}, {}, "unknown"};
+        selectedType = makeSelectedTypeStr(selectedType, ov::element::f32);
+        init_input_shapes({inputShape});
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto split = ngraph::builder::makeSplit(params[0], ov::element::f32, 2, axis);
+        split->get_rt_info() = getCPUInfo();
+        ov::ResultVector results;
+        for (const auto& output : split->outputs())
+            results.push_back(std::make_shared<ov::opset1::Result>(std::make_shared<ov::opset1::Relu>(output)));
+        function = std::make_shared<ov::Model>(results, params, "SplitStridedInPlace");
+    }
+};
+
+TEST_P(SplitStridedInPlaceCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+    CheckPluginRelatedResults(compiledModel, "Split");
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_SplitStridedInPlace_4D, SplitStridedInPlaceCPUTest,
+                         ::testing::Combine(
+                                 ::testing::Values(2, 3),
+                                 ::testing::Values(InputShape{{}, {{2, 8, 6, 10}}})),
+                         SplitStridedInPlaceCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
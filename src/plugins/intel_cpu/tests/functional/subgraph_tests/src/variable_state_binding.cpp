@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset6.hpp>
+#include <openvino/op/util/variable.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ov;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  Running sum, the output is the state before the update:
+ *
+ *     ReadValue     Parameter
+ *       |     \      /
+ *       |       Add
+ *       |        |
+ *    Multiply  Assign
+ *     (2.f)
+ *       |
+ *     Result
+ *
+ *  Assign doesn't depend on Multiply, so it may be executed before the consumer of ReadValue has read the state.
+ *  Each infer request has its own state, which is bound to the nodes of the shared graph: Multiply reads the state
+ *  memory and Add writes the next value right to it.
+ */
+struct VariableStateBindingParamType {
+    PartialShape shape;
+    Shape dataShape;
+};
+
+class VariableStateBindingCPUTest : public ::testing::TestWithParam<VariableStateBindingParamType> {
+public:
+    static std::string getTestCaseName(::testing::TestParamInfo<VariableStateBindingParamType> obj) {
+        std::ostringstream result;
+        result << "shape=" << obj.param.shape << "_";
+        result << "dataShape=" << obj.param.dataShape;
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<Model> createModel(const PartialShape& shape, const Shape& dataShape) {
+        auto param = std::make_shared<opset6::Parameter>(element::f32, shape);
+        auto init = opset6::Constant::create(element::f32, dataShape, std::vector<float>{0.f});
+        auto variable = std::make_shared<op::util::Variable>(op::util::VariableInfo{shape, element::f32, "sum"});
+        auto readValue = std::make_shared<opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<opset6::Add>(readValue, param);
+        auto assign = std::make_shared<opset6::Assign>(add, variable);
+        auto scale = opset6::Constant::create(element::f32, {1}, {2.f});
+        auto multiply = std::make_shared<opset6::Multiply>(readValue, scale);
+        auto result = std::make_shared<opset6::Result>(multiply);
+
+        return std::make_shared<Model>(ResultVector{result}, SinkVector{assign}, ParameterVector{param});
+    }
+
+    static void check(InferRequest& req, const std::vector<float>& sum, const std::string& message) {
+        const auto actual = req.get_output_tensor();
+        ASSERT_EQ(actual.get_size(), sum.size());
+        for (size_t i = 0; i < sum.size(); i++)
+            ASSERT_EQ(actual.data<float>()[i], 2.f * sum[i]) << message << ", element " << i;
+    }
+
+    void Run() {
+        const auto& shape = GetParam().shape;
+        const auto& dataShape = GetParam().dataShape;
+        std::shared_ptr<Core> core = ov::test::utils::PluginCache::get().core();
+        // the sums of the integers are exact in f32
+        auto compiledModel = core->compile_model(createModel(shape, dataShape), "CPU",
+                                                 ov::hint::inference_precision(element::f32));
+        std::vector<InferRequest> requests = {compiledModel.create_infer_request(),
+                                              compiledModel.create_infer_request()};
+
+        // the requests are interleaved, their sums are independent
+        std::vector<std::vector<float>> sums(requests.size(), std::vector<float>(shape_size(dataShape), 0.f));
+        for (size_t step = 0; step < 4; step++) {
+            for (size_t r = 0; r < requests.size(); r++) {
+                std::vector<float> data(shape_size(dataShape));
+                for (size_t i = 0; i < data.size(); i++)
+                    data[i] = static_cast<float>((r + 1) * 10 + step + i);
+                requests[r].set_input_tensor(Tensor(element::f32, dataShape, data.data()));
+                requests[r].infer();
+                check(requests[r], sums[r], "request " + std::to_string(r) + ", step " + std::to_string(step));
+                for (size_t i = 0; i < data.size(); i++)
+                    sums[r][i] += data[i];
+            }
+        }
+
+        for (size_t r = 0; r < requests.size(); r++) {
+            auto states = requests[r].query_state();
+            ASSERT_EQ(states.size(), 1);
+            auto value = states.front().get_state();
+            ASSERT_EQ(value.get_shape(), dataShape);
+            for (size_t i = 0; i < sums[r].size(); i++)
+                ASSERT_EQ(value.data<float>()[i], sums[r][i]) << "request " << r << ", element " << i;
+        }
+
+        // the state set by the user is read by the next inference
+        std::vector<float> newSum(shape_size(dataShape), 3.f);
+        std::vector<float> zeros(newSum.size(), 0.f);
+        requests[0].query_state().front().set_state(Tensor(element::f32, dataShape, newSum.data()));
+        requests[0].set_input_tensor(Tensor(element::f32, dataShape, zeros.data()));
+        requests[0].infer();
+        check(requests[0], newSum, "after set_state");
+
+        requests[1].query_state().front().reset();
+        requests[1].set_input_tensor(Tensor(element::f32, dataShape, zeros.data()));
+        requests[1].infer();
+        check(requests[1], zeros, "after reset");
+    }
+};
+
+TEST_P(VariableStateBindingCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    Run();
+}
+
+namespace {
+const std::vector<VariableStateBindingParamType> params = {
+    { PartialShape{2, 8}, Shape{2, 8} },
+    { PartialShape{2, 3, 4, 4}, Shape{2, 3, 4, 4} },
+    { PartialShape{Dimension::dynamic(), 8}, Shape{3, 8} },  // the output points to the state memory
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_VariableStateBinding,
+                         VariableStateBindingCPUTest,
+                         ::testing::ValuesIn(params),
+                         VariableStateBindingCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
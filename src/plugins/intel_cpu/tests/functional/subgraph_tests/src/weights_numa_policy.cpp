@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset1.hpp>
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "ie_system_conf.h"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+/*  The weights of the FullyConnected nodes are cached and shared between the streams, they are placed on the NUMA nodes
+ *  according to the CPU_WEIGHTS_NUMA_POLICY. The placement is reported by the CPU_WEIGHTS_PLACEMENT metric.
+ *
+ *     Parameter
+ *         |
+ *     MatMul(W0)
+ *         |
+ *       Relu
+ *         |
+ *     MatMul(W1)
+ *         |
+ *      Result
+ */
+using WeightsNumaPolicyParams = std::string;
+
+class WeightsNumaPolicyCPUTest : public testing::WithParamInterface<WeightsNumaPolicyParams>,
+                                 virtual public SubgraphBaseTest, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightsNumaPolicyParams>& obj) {
+        return "Policy=" + (obj.param.empty() ? std::string("DEFAULT") : obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the weights cache is used if the model is compiled for several streams
+        configuration.insert(ov::num_streams(2));
+        // the empty policy checks the default one
+        if (!GetParam().empty())
+            configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, GetParam()});
+        init_input_shapes({{{}, {{4, 256}}}});
+
+        const auto params = ngraph::builder::makeDynamicParams(ov::element::f32, inputDynamicShapes);
+        const auto w0 = ngraph::builder::makeConstant<float>(ov::element::f32, {256, 512}, {}, true);
+        const auto matmul0 = std::make_shared<ov::opset1::MatMul>(params[0], w0);
+        const auto relu = std::make_shared<ov::opset1::Relu>(matmul0);
+        const auto w1 = ngraph::builder::makeConstant<float>(ov::element::f32, {512, 128}, {}, true);
+        const auto matmul1 = std::make_shared<ov::opset1::MatMul>(relu, w1);
+        function = std::make_shared<ov::Model>(matmul1, params, "WeightsNumaPolicy");
+    }
+};
+
+TEST_P(WeightsNumaPolicyCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run();
+
+    const auto placement = compiledModel.get_property(InferenceEngine::PluginConfigInternalParams::KEY_CPU_WEIGHTS_PLACEMENT)
+                                        .as<std::map<std::string, std::string>>();
+    ASSERT_FALSE(placement.empty());
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    for (const auto& item : placement) {
+        std::istringstream stream(item.second);
+        std::string location;
+        size_t copies = 0;
+        while (std::getline(stream, location, ',')) {
+            copies++;
+            if (location == "INTERLEAVE")
+                continue;
+            ASSERT_EQ(0, location.rfind("NUMA", 0)) << item.first << ": " << item.second;
+            const auto numaNode = std::stoi(location.substr(4));
+            ASSERT_NE(std::find(numaNodes.begin(), numaNodes.end(), numaNode), numaNodes.end()) << item.first << ": " << item.second;
+        }
+        ASSERT_LE(copies, numaNodes.size()) << item.first << ": " << item.second;
+        // the weights are replicated by default, AUTO is opt-in
+        if (GetParam().empty() || GetParam() == InferenceEngine::PluginConfigInternalParams::REPLICATE) {
+            ASSERT_EQ(item.second.find("INTERLEAVE"), std::string::npos) << item.first << ": " << item.second;
+        }
+        // the single copy policies don't replicate the weights
+        if (GetParam() != InferenceEngine::PluginConfigInternalParams::REPLICATE &&
+            GetParam() != InferenceEngine::PluginConfigInternalParams::AUTO) {
+            ASSERT_EQ(copies, 1) << item.first << ": " << item.second;
+        }
+    }
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsNumaPolicy, WeightsNumaPolicyCPUTest,
+                         ::testing::Values("",
+                                           InferenceEngine::PluginConfigInternalParams::AUTO,
+                                           InferenceEngine::PluginConfigInternalParams::REPLICATE,
+                                           InferenceEngine::PluginConfigInternalParams::INTERLEAVE,
+                                           InferenceEngine::PluginConfigInternalParams::FIRST_TOUCH),
+                         WeightsNumaPolicyCPUTest::getTestCaseName);
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -232,6 +232,59 @@ TEST_F(MoveEltwiseUpThroughDataMovTest, SingleBinaryEltwiseWithNotScalarOnSecond
     manager.register_pass<ov::intel_cpu::MoveEltwiseUpThroughDataMov>();
 }
 
+TEST_F(MoveEltwiseUpThroughDataMovTest, BinaryEltwiseWithFullShapeSecondInputAfterReshape) {
+    const ngraph::Shape shape{1, 3, 16, 16};
+    const ngraph::Shape reshaped{1, 3, 256};
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, shape);
+        auto residual = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, reshaped);
+
+        auto sigmoid = std::make_shared<ngraph::opset8::Sigmoid>(input);
+
+        auto reshape_const = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{reshaped.size()}, reshaped);
+        auto reshape = std::make_shared<ngraph::opset8::Reshape>(sigmoid, reshape_const, false);
+
+        auto add = std::make_shared<ngraph::opset8::Add>(reshape, residual);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input, residual});
+        manager.register_pass<ov::intel_cpu::MoveEltwiseUpThroughDataMov>();
+    }
+    {
+        auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, shape);
+        auto residual = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, reshaped);
+
+        auto sigmoid = std::make_shared<ngraph::opset8::Sigmoid>(input);
+
+        auto residual_reshape_const = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{shape.size()}, shape);
+        auto residual_reshape = std::make_shared<ngraph::opset8::Reshape>(residual, residual_reshape_const, false);
+
+        auto add = std::make_shared<ngraph::opset8::Add>(sigmoid, residual_reshape);
+
+        auto reshape_const = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{reshaped.size()}, reshaped);
+        auto reshape = std::make_shared<ngraph::opset8::Reshape>(add, reshape_const, false);
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{reshape}, ngraph::ParameterVector{input, residual});
+    }
+}
+
+TEST_F(MoveEltwiseUpThroughDataMovTest, BinaryEltwiseWithFullShapeSecondInputAfterTranspose) {
+    const ngraph::Shape shape{1, 3, 16, 16};
+    const std::vector<int64_t> input_order = {0, 2, 3, 1};
+
+    auto input = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, shape);
+    auto residual = std::make_shared<ngraph::opset8::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 16, 3});
+
+    auto sigmoid = std::make_shared<ngraph::opset8::Sigmoid>(input);
+
+    auto transpose_const = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape{input_order.size()}, input_order);
+    auto transpose = std::make_shared<ngraph::opset8::Transpose>(sigmoid, transpose_const);
+
+    auto add = std::make_shared<ngraph::opset8::Add>(transpose, residual);
+
+    function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input, residual});
+    manager.register_pass<ov::intel_cpu::MoveEltwiseUpThroughDataMov>();
+}
+
 TEST_F(MoveEltwiseUpThroughDataMovTest, SingleUnaryEltwiseDynamicShape) {
     const std::vector<int64_t> input_order = {3, 2, 1, 0};
     const int64_t unsqueeze_axis = 2;
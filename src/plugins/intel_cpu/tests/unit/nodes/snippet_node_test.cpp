@@ -0,0 +1,77 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/pass/manager.hpp>
+#include <snippets/pass/tokenization.hpp>
+
+#include "graph.h"
+#include "nodes/subgraph.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// two identical Add -> Multiply -> Relu branches, each of them is tokenized to a separate Subgraph
+std::shared_ptr<ov::Model> makeTwoBranchModel(const std::vector<ov::Shape>& shapes) {
+    ov::ParameterVector params;
+    for (const auto& shape : shapes)
+        params.push_back(std::make_shared<ov::opset1::Parameter>(ov::element::f32, shape));
+    auto makeBranch = [](const ov::Output<ov::Node>& lhs, const ov::Output<ov::Node>& rhs) {
+        const auto add = std::make_shared<ov::opset1::Add>(lhs, rhs);
+        const auto scale = ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.5f});
+        const auto multiply = std::make_shared<ov::opset1::Multiply>(add, scale);
+        return std::make_shared<ov::opset1::Relu>(multiply);
+    };
+    const auto branch0 = makeBranch(params[0], params[1]);
+    const auto branch1 = makeBranch(params[2], params[3]);
+    const auto concat = std::make_shared<ov::opset1::Concat>(ov::OutputVector{branch0, branch1}, 1);
+    auto model = std::make_shared<ov::Model>(concat, params);
+
+    ov::pass::Manager manager;
+    manager.register_pass<ngraph::snippets::pass::SnippetsTokenization>();
+    manager.run_passes(model);
+    return model;
+}
+
+std::vector<const void*> getKernelCodes(const std::shared_ptr<const ov::Model>& model, Graph& graph) {
+    Config config;
+    auto context = std::make_shared<GraphContext>(config, std::make_shared<ExtensionManager>(), nullptr, false);
+    graph.CreateGraph(model, context);
+
+    std::vector<const void*> codes;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() != Type::Subgraph)
+            continue;
+        const auto snippet = std::dynamic_pointer_cast<node::Snippet>(node);
+        if (!snippet)
+            IE_THROW() << "Cannot cast " << node->getName() << " to Snippet";
+        codes.push_back(snippet->getKernelCode());
+    }
+    return codes;
+}
+}   // namespace
+
+TEST(SnippetKernelCacheTest, same_body_and_shapes_share_kernel) {
+    const ov::Shape shape{1, 3, 16, 16};
+    std::shared_ptr<const ov::Model> model = makeTwoBranchModel({shape, shape, shape, shape});
+    Graph graph;
+    const auto codes = getKernelCodes(model, graph);
+
+    ASSERT_EQ(codes.size(), 2);
+    ASSERT_NE(codes[0], nullptr);
+    // the second node takes the kernel generated for the first one from the runtime cache
+    ASSERT_EQ(codes[0], codes[1]);
+}
+
+TEST(SnippetKernelCacheTest, different_shapes_dont_share_kernel) {
+    std::shared_ptr<const ov::Model> model = makeTwoBranchModel({{1, 3, 16, 16}, {1, 3, 16, 1}, {1, 5, 16, 16}, {1, 5, 16, 16}});
+    Graph graph;
+    const auto codes = getKernelCodes(model, graph);
+
+    ASSERT_EQ(codes.size(), 2);
+    ASSERT_NE(codes[0], nullptr);
+    ASSERT_NE(codes[1], nullptr);
+    ASSERT_NE(codes[0], codes[1]);
+}
@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/hetero/properties.hpp"
+
+#ifdef ENABLE_INTEL_CPU
+
+using namespace ov;
+
+namespace {
+
+/*  The subgraphs are executed on different devices, so the stages of consecutive infer requests overlap:
+ *
+ *     Parameter -> Relu        TEMPLATE
+ *                   |
+ *                 Sigmoid      CPU
+ *                   |
+ *     Multiply (2.f) -> Result TEMPLATE
+ */
+std::shared_ptr<Model> createHeteroPipelineModel(const Shape& shape) {
+    auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+    auto relu = std::make_shared<opset8::Relu>(param);
+    auto sigmoid = std::make_shared<opset8::Sigmoid>(relu);
+    auto scale = opset8::Constant::create(element::f32, {1}, {2.f});
+    auto multiply = std::make_shared<opset8::Multiply>(sigmoid, scale);
+    auto result = std::make_shared<opset8::Result>(multiply);
+    auto model = std::make_shared<Model>(ResultVector{result}, ParameterVector{param});
+
+    for (auto&& node : model->get_ordered_ops()) {
+        node->get_rt_info()["affinity"] = node == sigmoid ? "CPU" : "TEMPLATE";
+    }
+    return model;
+}
+
+std::vector<float> heteroPipelineReference(const std::vector<float>& input) {
+    std::vector<float> expected;
+    for (auto value : input) {
+        expected.push_back(2.f / (1.f + std::exp(-std::max(value, 0.f))));
+    }
+    return expected;
+}
+
+TEST(HeteroPipelineTest, smoke_OverlappedRequests) {
+    const Shape shape{1, 8, 64, 64};
+    auto core = test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(createHeteroPipelineModel(shape),
+                                             "HETERO:TEMPLATE,CPU",
+                                             hetero::pipeline_requests(2));
+    ASSERT_EQ(compiledModel.get_property(hetero::pipeline_requests), 2u);
+
+    // more requests than the sub-requests of a stage, so some of them wait in the queue of the pool
+    const size_t numRequests = 5;
+    std::vector<InferRequest> requests;
+    std::vector<std::vector<float>> inputs;
+    for (size_t r = 0; r < numRequests; r++) {
+        std::vector<float> input(shape_size(shape));
+        for (size_t i = 0; i < input.size(); i++) {
+            input[i] = static_cast<float>(static_cast<int>((i + r * 7) % 19) - 9) / 3.f;
+        }
+        inputs.push_back(input);
+        requests.push_back(compiledModel.create_infer_request());
+    }
+
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (size_t r = 0; r < numRequests; r++) {
+            requests[r].set_input_tensor(Tensor(element::f32, shape, inputs[r].data()));
+            requests[r].start_async();
+        }
+        for (size_t r = 0; r < numRequests; r++) {
+            requests[r].wait();
+            const auto expected = heteroPipelineReference(inputs[r]);
+            const auto actual = requests[r].get_output_tensor();
+            ASSERT_EQ(actual.get_size(), expected.size());
+            for (size_t i = 0; i < expected.size(); i++) {
+                ASSERT_NEAR(actual.data<float>()[i], expected[i], 1e-5f) << "request " << r << ", element " << i;
+            }
+        }
+    }
+
+    // the synchronous inference runs the same stages
+    requests[0].set_input_tensor(Tensor(element::f32, shape, inputs[1].data()));
+    requests[0].infer();
+    const auto expected = heteroPipelineReference(inputs[1]);
+    const auto actual = requests[0].get_output_tensor();
+    for (size_t i = 0; i < expected.size(); i++) {
+        ASSERT_NEAR(actual.data<float>()[i], expected[i], 1e-5f) << "element " << i;
+    }
+
+    // the stages of different requests were running at the same time and each inference passed the outputs of the
+    // first two stages to the following ones without copying
+    const auto inferences = 3 * numRequests + 1;
+    EXPECT_GT(compiledModel.get_property("HETERO_PIPELINE_MAX_RUNNING_STAGES").as<uint32_t>(), 1u);
+    EXPECT_EQ(compiledModel.get_property("HETERO_PIPELINE_SHARED_TENSORS").as<uint32_t>(), 2 * inferences);
+    EXPECT_EQ(compiledModel.get_property("HETERO_PIPELINE_COPIED_TENSORS").as<uint32_t>(), 0u);
+}
+
+TEST(HeteroPipelineTest, smoke_WrongPipelineRequests) {
+    auto core = test::utils::PluginCache::get().core();
+    for (auto&& value : {"abc", "-1", "2x", "99999999999"}) {
+        EXPECT_THROW(core->compile_model(createHeteroPipelineModel(Shape{1, 3, 4, 4}),
+                                         "HETERO:TEMPLATE,CPU",
+                                         {{hetero::pipeline_requests.name(), value}}),
+                     ov::Exception)
+            << value;
+    }
+}
+
+}  // namespace
+
+#endif  // ENABLE_INTEL_CPU